@@ -1,17 +1,57 @@
 #pragma once
 
+#include "fixed_containers/concepts.hpp"
 #include "fixed_containers/memory.hpp"
 
+#include <concepts>
+#include <cstddef>
+#include <cstring>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace fixed_containers::algorithm
 {
+namespace algorithm_detail
+{
+// Relocation between two contiguous ranges of the same trivially relocatable type is a single
+// `std::memmove`, which also handles overlapping ranges in either direction.
+template <class It1, class It2>
+concept IsMemmoveRelocatable =
+    std::contiguous_iterator<It1> && std::contiguous_iterator<It2> &&
+    std::same_as<std::iter_value_t<It1>, std::iter_value_t<It2>> &&
+    TriviallyRelocatable<std::iter_value_t<It1>>;
+
+template <class It1, class It2>
+void memmove_relocate(It1 first, const std::iter_difference_t<It1> count, It2 d_first)
+{
+    // Dereferencing an end iterator is not allowed, so bail before `std::to_address()` does
+    if (count <= 0)
+    {
+        return;
+    }
+    std::memmove(static_cast<void*>(std::to_address(d_first)),
+                 static_cast<const void*>(std::to_address(first)),
+                 static_cast<std::size_t>(count) * sizeof(std::iter_value_t<It1>));
+}
+}  // namespace algorithm_detail
+
 // Similar to https://en.cppreference.com/w/cpp/memory/uninitialized_move
 // but also destroys the source range
 template <class FwdIt1, class FwdIt2>
 constexpr FwdIt2 uninitialized_relocate(FwdIt1 first, FwdIt1 last, FwdIt2 d_first)
 {
+    if constexpr (algorithm_detail::IsMemmoveRelocatable<FwdIt1, FwdIt2>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto count = std::distance(first, last);
+            algorithm_detail::memmove_relocate(first, count, d_first);
+            return std::next(d_first, count);
+        }
+    }
+
     while (first != last)
     {
         memory::construct_at_address_of(*d_first, std::move(*first));
@@ -27,6 +67,17 @@ constexpr FwdIt2 uninitialized_relocate(FwdIt1 first, FwdIt1 last, FwdIt2 d_firs
 template <class BidirIt1, class BidirIt2>
 constexpr BidirIt2 uninitialized_relocate_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
+    if constexpr (algorithm_detail::IsMemmoveRelocatable<BidirIt1, BidirIt2>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            const auto count = std::distance(first, last);
+            const BidirIt2 d_first = std::prev(d_last, count);
+            algorithm_detail::memmove_relocate(first, count, d_first);
+            return d_first;
+        }
+    }
+
     while (first != last)
     {
         --d_last;
@@ -100,6 +100,20 @@ concept TriviallyDestructible = std::is_trivially_destructible_v<T>;
 template <class T>
 concept NotTriviallyDestructible = not TriviallyDestructible<T>;
 
+// A type is trivially relocatable if moving an object to a new address and destroying the old one
+// is equivalent to copying its bytes, e.g. with `std::memmove`. Every trivially copyable type
+// qualifies. Other types can opt in by specializing this trait, as long as they hold no pointers
+// into themselves.
+template <class T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{
+};
+
+template <class T>
+concept TriviallyRelocatable = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+template <class T>
+concept NotTriviallyRelocatable = not TriviallyRelocatable<T>;
+
 template <class T>
 concept Aggregate = std::is_aggregate_v<T>;
 template <class T>
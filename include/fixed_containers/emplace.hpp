@@ -7,40 +7,70 @@
 
 namespace fixed_containers::emplace_detail
 {
-template <typename Container, typename... Args>
+// `try_emplace` is called with the key and the mapped value's constructor arguments, after
+// unpacking a pair or a piecewise construction.
+template <typename TryEmplace, typename... Args>
     requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
-constexpr std::pair<typename Container::iterator, bool> emplace_in_terms_of_try_emplace_impl(
-    Container& container, Args&&... args)
+constexpr auto emplace_in_terms_of(TryEmplace&& try_emplace, Args&&... args)
 {
     return [&]<typename First, typename... Rest>(First&& first, Rest&&... rest)
     {
         if constexpr (sizeof...(Rest) == 0 && IsStdPair<First>)
         {
             // Lambda to avoid compilation errors with .first/.second when passing a non-pair
-            return [&container]<typename Pair>(Pair&& pair)
+            return [&try_emplace]<typename Pair>(Pair&& pair)
             {
-                return container.try_emplace(std::forward<decltype(pair.first)>(pair.first),
-                                             std::forward<decltype(pair.second)>(pair.second));
+                return try_emplace(std::forward<decltype(pair.first)>(pair.first),
+                                   std::forward<decltype(pair.second)>(pair.second));
             }(std::forward<First>(first));
         }
         else if constexpr (sizeof...(Rest) == 2 &&
                            std::same_as<std::piecewise_construct_t, std::decay_t<First>>)
         {
-            return [&container]<typename P1, typename P2>(P1&& piece1, P2&& piece2)
+            return [&try_emplace]<typename P1, typename P2>(P1&& piece1, P2&& piece2)
             {
                 return
-                    [&container, &piece1, &piece2]<std::size_t... INDEX_1, std::size_t... INDEX_2>(
+                    [&try_emplace, &piece1, &piece2]<std::size_t... INDEX_1,
+                                                     std::size_t... INDEX_2>(
                         std::index_sequence<INDEX_1...>, std::index_sequence<INDEX_2...>) {
-                        return container.try_emplace(std::get<INDEX_1>(piece1)...,
-                                                     std::get<INDEX_2>(piece2)...);
+                        return try_emplace(std::get<INDEX_1>(piece1)...,
+                                           std::get<INDEX_2>(piece2)...);
                     }(std::make_index_sequence<std::tuple_size_v<P1>>{},
                       std::make_index_sequence<std::tuple_size_v<P2>>{});
             }(std::forward<Rest>(rest)...);
         }
         else
         {
-            return container.try_emplace(std::forward<First>(first), std::forward<Rest>(rest)...);
+            return try_emplace(std::forward<First>(first), std::forward<Rest>(rest)...);
         }
     }(std::forward<Args>(args)...);
 }
+
+template <typename Container, typename... Args>
+    requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+constexpr std::pair<typename Container::iterator, bool> emplace_in_terms_of_try_emplace_impl(
+    Container& container, Args&&... args)
+{
+    return emplace_in_terms_of([&container]<typename... TryEmplaceArgs>(
+                                   TryEmplaceArgs&&... try_emplace_args)
+                               {
+                                   return container.try_emplace(
+                                       std::forward<TryEmplaceArgs>(try_emplace_args)...);
+                               },
+                               std::forward<Args>(args)...);
+}
+
+template <typename Container, typename... Args>
+    requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+constexpr std::pair<typename Container::iterator, bool> emplace_hint_in_terms_of_try_emplace_impl(
+    Container& container, typename Container::const_iterator hint, Args&&... args)
+{
+    return emplace_in_terms_of([&container, &hint]<typename... TryEmplaceArgs>(
+                                   TryEmplaceArgs&&... try_emplace_args)
+                               {
+                                   return container.try_emplace(
+                                       hint, std::forward<TryEmplaceArgs>(try_emplace_args)...);
+                               },
+                               std::forward<Args>(args)...);
+}
 }  // namespace fixed_containers::emplace_detail
@@ -6,7 +6,9 @@ template <typename Container, class Predicate>
 constexpr typename Container::size_type erase_if_impl(Container& container, Predicate predicate)
 {
     const auto original_size = container.size();
-    for (auto it = container.begin(), last = container.end(); it != last;)
+    // `end()` is re-read after every erasure, since it moves for containers whose iterators are
+    // plain indices
+    for (auto it = container.begin(); it != container.end();)
     {
         if (predicate(*it))
         {
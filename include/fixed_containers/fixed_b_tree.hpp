@@ -0,0 +1,1251 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// A B+-tree with a fixed capacity. Entries live in the leaves, which are doubly linked together in
+// key order. Internal nodes only hold copies of keys (separators) to route lookups, so a lookup
+// touches O(log_B(N)) nodes of a few cache lines each, instead of the O(log2(N)) scattered nodes of
+// a red-black tree.
+//
+// Nodes are allocated from `FixedIndexBasedPoolStorage`s and refer to each other by index, so the
+// tree has no pointers and is trivially copyable when the keys and values are.
+//
+// Every node other than the root is at least half full, which bounds how many nodes the tree can
+// need for MAXIMUM_SIZE entries. The pools are sized for that worst case, so a B-tree takes up to
+// ~2x the memory of the entries themselves.
+//
+// Good resources:
+// 1) Introduction to Algorithms (CLRS), chapter 18.
+// 2) Open Data Structures, chapter 14: https://opendatastructures.org/ods-cpp/14_2_B_Trees.html
+
+namespace fixed_containers::fixed_b_tree_detail
+{
+using NodeIndex = std::uint32_t;
+static constexpr NodeIndex NULL_NODE = (std::numeric_limits<NodeIndex>::max)();
+
+// Default node sizes make the keys of a node span 4 cache lines, which is what one lookup step
+// searches through.
+static constexpr std::size_t NODE_KEY_BYTES = 4 * 64;
+
+template <typename K>
+constexpr std::size_t default_leaf_capacity()
+{
+    return std::clamp<std::size_t>(NODE_KEY_BYTES / sizeof(K), 4, 64);
+}
+
+template <typename K>
+constexpr std::size_t default_branching_factor()
+{
+    return std::clamp<std::size_t>(NODE_KEY_BYTES / sizeof(K), 4, 64);
+}
+
+// Number of nodes above `node_count` nodes of a level, given that every node other than the root
+// has at least `min_children` children.
+constexpr std::size_t max_node_count_above(std::size_t node_count, std::size_t min_children)
+{
+    std::size_t total = 0;
+    while (node_count > 1)
+    {
+        node_count = (std::max<std::size_t>)(1, node_count / min_children);
+        total += node_count;
+    }
+    return total;
+}
+
+constexpr std::size_t max_level_count_above(std::size_t node_count, std::size_t min_children)
+{
+    std::size_t levels = 0;
+    while (node_count > 1)
+    {
+        node_count = (std::max<std::size_t>)(1, node_count / min_children);
+        levels++;
+    }
+    return levels;
+}
+
+// Position of an entry: a leaf and a slot in it.
+struct EntryIndex
+{
+    NodeIndex leaf;
+    NodeIndex slot;
+
+    constexpr bool operator==(const EntryIndex& other) const = default;
+};
+
+template <class K, class V, std::size_t LEAF_CAPACITY_>
+struct LeafNode
+{
+    static constexpr bool HAS_ASSOCIATED_VALUE = IsNotEmpty<V>;
+    // One extra slot: an entry is inserted before an overflowing leaf is split
+    static constexpr std::size_t SLOT_COUNT = LEAF_CAPACITY_ + 1;
+
+    std::array<optional_storage_detail::OptionalStorage<K>, SLOT_COUNT> keys{};
+    std::array<optional_storage_detail::OptionalStorage<V>, HAS_ASSOCIATED_VALUE ? SLOT_COUNT : 0>
+        values{};
+    NodeIndex count{};
+    NodeIndex prev{NULL_NODE};
+    NodeIndex next{NULL_NODE};
+};
+
+template <class K, std::size_t BRANCHING_FACTOR_>
+struct InternalNode
+{
+    // One extra slot: a child is inserted before an overflowing node is split
+    static constexpr std::size_t CHILD_SLOT_COUNT = BRANCHING_FACTOR_ + 1;
+
+    // `separators[i]` is greater than every key under `children[i]`, and less than or equal to
+    // every key under `children[i + 1]`. Erasures can leave separators that are not keys anymore.
+    std::array<optional_storage_detail::OptionalStorage<K>, CHILD_SLOT_COUNT - 1> separators{};
+    std::array<NodeIndex, CHILD_SLOT_COUNT> children{};
+    NodeIndex child_count{};
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t LEAF_CAPACITY,
+          std::size_t BRANCHING_FACTOR>
+class FixedBTreeBase
+{
+    static_assert(std::is_copy_constructible_v<K>,
+                  "Internal nodes hold copies of keys, so keys must be copy constructible");
+    static_assert(std::is_move_constructible_v<K> && std::is_move_constructible_v<V>,
+                  "Splits and merges move entries between nodes, so they must be movable");
+    static_assert(LEAF_CAPACITY >= 2);
+    static_assert(BRANCHING_FACTOR >= 3);
+
+public:
+    using KeyType = K;
+    using ValueType = V;
+    using KeyCompareType = Compare;
+    static constexpr bool HAS_ASSOCIATED_VALUE = IsNotEmpty<V>;
+    static constexpr bool HAS_TRANSPARENT_LOOKUP = IsTransparent<Compare>;
+
+    static constexpr std::size_t CAPACITY = MAXIMUM_SIZE;
+    // A single leaf is enough for small capacities
+    static constexpr std::size_t LEAF_ENTRY_COUNT =
+        std::clamp<std::size_t>(MAXIMUM_SIZE, 2, LEAF_CAPACITY);
+    static constexpr std::size_t MIN_LEAF_ENTRY_COUNT = LEAF_ENTRY_COUNT / 2;
+    static constexpr std::size_t MIN_CHILD_COUNT = (BRANCHING_FACTOR + 1) / 2;
+
+    static constexpr std::size_t LEAF_NODE_COUNT =
+        MAXIMUM_SIZE <= LEAF_ENTRY_COUNT ? 1 : MAXIMUM_SIZE / MIN_LEAF_ENTRY_COUNT;
+    static constexpr std::size_t INTERNAL_NODE_COUNT =
+        max_node_count_above(LEAF_NODE_COUNT, MIN_CHILD_COUNT);
+    // Maximum number of internal levels
+    static constexpr std::size_t MAXIMUM_HEIGHT =
+        max_level_count_above(LEAF_NODE_COUNT, MIN_CHILD_COUNT);
+
+    static_assert(LEAF_NODE_COUNT < NULL_NODE && INTERNAL_NODE_COUNT < NULL_NODE);
+    // When a single leaf holds every entry, it never overflows or underflows, and the code paths
+    // that maintain internal nodes are not even instantiated.
+    static constexpr bool HAS_INTERNAL_NODES = INTERNAL_NODE_COUNT > 0;
+
+    using LeafNodeType = LeafNode<K, V, LEAF_ENTRY_COUNT>;
+    using InternalNodeType = InternalNode<K, BRANCHING_FACTOR>;
+
+    struct OpaqueIndexType
+    {
+        // Where the key is, or where it would be inserted if it is not in the tree
+        EntryIndex entry;
+        bool found;
+    };
+
+    using OpaqueIteratedType = EntryIndex;
+
+protected:
+    // The internal nodes visited on the way to a leaf, and which child was taken in each
+    struct PathStep
+    {
+        NodeIndex node;
+        NodeIndex child_position;
+    };
+    using Path = std::array<PathStep, MAXIMUM_HEIGHT>;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedIndexBasedPoolStorage<LeafNodeType, LEAF_NODE_COUNT>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_;
+    FixedIndexBasedPoolStorage<InternalNodeType, INTERNAL_NODE_COUNT>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_internal_nodes_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_root_;
+    // The leftmost leaf never changes: splits keep the left half in place and merges keep the
+    // left node.
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_;
+    // The rightmost leaf, so that iterating backwards from the end does not descend the tree
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_;
+    // Number of internal levels. The root is a leaf when this is zero.
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_height_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedBTreeBase() noexcept
+      : FixedBTreeBase(Compare{})
+    {
+    }
+
+    explicit constexpr FixedBTreeBase(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_internal_nodes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_root_{NULL_NODE}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_{NULL_NODE}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_{NULL_NODE}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_height_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr std::size_t height() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_height_;
+    }
+    [[nodiscard]] constexpr const Compare& key_comp() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType begin_index() const
+    {
+        if (size() == 0)
+        {
+            return end_index();
+        }
+        return {first_leaf(), 0};
+    }
+
+    static constexpr OpaqueIteratedType invalid_index() { return {NULL_NODE, 0}; }
+
+    [[nodiscard]] constexpr OpaqueIteratedType end_index() const { return invalid_index(); }
+
+    // The entry after `entry`. The end wraps around to the first entry, so that the end is also
+    // what comes before the first entry.
+    [[nodiscard]] constexpr OpaqueIteratedType next_of(const OpaqueIteratedType& entry) const
+    {
+        if (entry == end_index())
+        {
+            return begin_index();
+        }
+        const LeafNodeType& leaf = leaf_at(entry.leaf);
+        if (entry.slot + 1 < leaf.count)
+        {
+            return {entry.leaf, entry.slot + 1};
+        }
+        return first_entry_of(leaf.next);
+    }
+
+    // The entry before `entry`. The first entry is preceded by the end, which is preceded by the
+    // last entry.
+    [[nodiscard]] constexpr OpaqueIteratedType prev_of(const OpaqueIteratedType& entry) const
+    {
+        if (entry == end_index())
+        {
+            return last_entry_of(last_leaf());
+        }
+        if (entry.slot > 0)
+        {
+            return {entry.leaf, entry.slot - 1};
+        }
+        return last_entry_of(leaf_at(entry.leaf).prev);
+    }
+
+    [[nodiscard]] constexpr const K& key_at(const OpaqueIteratedType& entry) const
+    {
+        return leaf_at(entry.leaf).keys[entry.slot].get();
+    }
+
+    [[nodiscard]] constexpr const V& value_at(const OpaqueIteratedType& entry) const
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return leaf_at(entry.leaf).values[entry.slot].get();
+    }
+
+    constexpr V& value_at(const OpaqueIteratedType& entry)
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return leaf_at(entry.leaf).values[entry.slot].get();
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType iterated_index_from(
+        const OpaqueIndexType& index) const
+    {
+        return index.entry;
+    }
+
+    // `Key` is either `K`, or any type that the (transparent) `Compare` accepts.
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const Key& key) const
+    {
+        if (root() == NULL_NODE)
+        {
+            return {invalid_index(), false};
+        }
+
+        const NodeIndex leaf_index = leaf_index_of(key);
+        const LeafNodeType& leaf = leaf_at(leaf_index);
+        const NodeIndex slot = lower_bound_slot(leaf, key);
+        const bool found = slot < leaf.count && !compare(key, leaf.keys[slot].get());
+        return {{leaf_index, slot}, found};
+    }
+
+    [[nodiscard]] constexpr bool exists(const OpaqueIndexType& index) const { return index.found; }
+
+    [[nodiscard]] constexpr const V& value(const OpaqueIndexType& index) const
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return value_at(index.entry);
+    }
+
+    constexpr V& value(const OpaqueIndexType& index)
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return value_at(index.entry);
+    }
+
+    // First entry whose key is not less than `key`
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIteratedType lower_bound_index(const Key& key) const
+    {
+        if (root() == NULL_NODE)
+        {
+            return end_index();
+        }
+        const NodeIndex leaf_index = leaf_index_of(key);
+        return entry_or_next_leaf(leaf_index, lower_bound_slot(leaf_at(leaf_index), key));
+    }
+
+    // First entry whose key is greater than `key`
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIteratedType upper_bound_index(const Key& key) const
+    {
+        if (root() == NULL_NODE)
+        {
+            return end_index();
+        }
+        const NodeIndex leaf_index = leaf_index_of(key);
+        return entry_or_next_leaf(leaf_index, upper_bound_slot(leaf_at(leaf_index), key));
+    }
+
+    template <typename KeyArg, typename... Args>
+    constexpr OpaqueIndexType emplace(const OpaqueIndexType& index,
+                                      KeyArg&& key,
+                                      Args&&... args)
+    {
+        assert_or_abort(!index.found);
+        EntryIndex entry = index.entry;
+        if (root() == NULL_NODE)
+        {
+            set_root(leaves().emplace_and_return_index());
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_ = root();
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_ = root();
+            entry = {root(), 0};
+        }
+
+        LeafNodeType& leaf = leaf_at(entry.leaf);
+        shift_entries_right(leaf, entry.slot);
+        memory::construct_at_address_of(
+            leaf.keys[entry.slot], std::in_place, std::forward<KeyArg>(key));
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            memory::construct_at_address_of(
+                leaf.values[entry.slot], std::in_place, std::forward<Args>(args)...);
+        }
+        leaf.count++;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+
+        if constexpr (HAS_INTERNAL_NODES)
+        {
+            if (leaf.count > LEAF_ENTRY_COUNT)
+            {
+                return {split_leaf(entry), true};
+            }
+        }
+        return {entry, true};
+    }
+
+    // Builds the tree out of `count` entries that are produced in ascending key order with no
+    // duplicates, in O(N) and without comparing any keys. `emplace_next(leaf, slot)` must construct
+    // the next entry in `slot` of `leaf`.
+    //
+    // The leaves are filled left to right, and each internal level is then built over the level
+    // below it. Every level spreads its items evenly over as few nodes as possible, so that all
+    // nodes other than the root are at least half full, and nothing is split.
+    template <class EmplaceNext>
+    constexpr void build_from_sorted_unique(const std::size_t count, EmplaceNext&& emplace_next)
+    {
+        assert_or_abort(size() == 0);
+        assert_or_abort(count <= MAXIMUM_SIZE);
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Size of node `i`, when `item_count` items are spread over `node_count` nodes
+        const auto node_size = [](std::size_t item_count, std::size_t node_count, std::size_t i)
+        { return (item_count / node_count) + (i < item_count % node_count ? 1 : 0); };
+        const auto ceil_div = [](std::size_t numerator, std::size_t denominator)
+        { return (numerator + denominator - 1) / denominator; };
+
+        // Node counts per level, leaves first
+        std::array<std::size_t, MAXIMUM_HEIGHT + 1> node_counts{};
+        node_counts[0] = ceil_div(count, LEAF_ENTRY_COUNT);
+        std::size_t height = 0;
+        if constexpr (HAS_INTERNAL_NODES)
+        {
+            while (node_counts[height] > 1)
+            {
+                node_counts[height + 1] = ceil_div(node_counts[height], BRANCHING_FACTOR);
+                height++;
+            }
+        }
+
+        // The internal node being filled at each level, the smallest key under it, and how many
+        // nodes of that level are complete
+        std::array<NodeIndex, MAXIMUM_HEIGHT> open_nodes{};
+        std::array<const K*, MAXIMUM_HEIGHT> open_node_min_keys{};
+        std::array<std::size_t, MAXIMUM_HEIGHT> complete_node_counts{};
+        open_nodes.fill(NULL_NODE);
+
+        NodeIndex previous_leaf = NULL_NODE;
+        for (std::size_t leaf_number = 0; leaf_number < node_counts[0]; leaf_number++)
+        {
+            const NodeIndex leaf_index = leaves().emplace_and_return_index();
+            LeafNodeType& leaf = leaf_at(leaf_index);
+            const std::size_t leaf_size = node_size(count, node_counts[0], leaf_number);
+            for (NodeIndex slot = 0; slot < leaf_size; slot++)
+            {
+                emplace_next(leaf, slot);
+                leaf.count++;
+            }
+            if (previous_leaf == NULL_NODE)
+            {
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_ = leaf_index;
+            }
+            else
+            {
+                leaf_at(previous_leaf).next = leaf_index;
+                leaf.prev = previous_leaf;
+            }
+            previous_leaf = leaf_index;
+            set_root(leaf_index);
+
+            if constexpr (HAS_INTERNAL_NODES)
+            {
+                // Registers the complete leaf with its parent, and every node that this completes
+                // with its own parent
+                NodeIndex child = leaf_index;
+                const K* child_min_key = &leaf.keys[0].get();
+                for (std::size_t level = 0; level < height; level++)
+                {
+                    if (open_nodes[level] == NULL_NODE)
+                    {
+                        open_nodes[level] = internal_nodes().emplace_and_return_index();
+                        open_node_min_keys[level] = child_min_key;
+                    }
+                    InternalNodeType& node = internal_at(open_nodes[level]);
+                    if (node.child_count > 0)
+                    {
+                        construct_separator(node, node.child_count - 1, *child_min_key);
+                    }
+                    node.children[node.child_count] = child;
+                    node.child_count++;
+
+                    if (node.child_count < node_size(node_counts[level],
+                                                     node_counts[level + 1],
+                                                     complete_node_counts[level]))
+                    {
+                        break;
+                    }
+                    child = open_nodes[level];
+                    child_min_key = open_node_min_keys[level];
+                    open_nodes[level] = NULL_NODE;
+                    complete_node_counts[level]++;
+                    set_root(child);
+                }
+            }
+        }
+
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_ = previous_leaf;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_height_ = height;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = count;
+    }
+
+    constexpr OpaqueIteratedType erase(const OpaqueIndexType& index)
+    {
+        assert_or_abort(index.found);
+        const EntryIndex entry = index.entry;
+        LeafNodeType& leaf = leaf_at(entry.leaf);
+
+        bool will_underflow = false;
+        // The path is found with the key that is being erased, so do it while it still exists
+        Path path{};
+        if constexpr (HAS_INTERNAL_NODES)
+        {
+            will_underflow = height() > 0 && leaf.count - 1 < MIN_LEAF_ENTRY_COUNT;
+            if (will_underflow)
+            {
+                find_path_to_leaf(leaf.keys[entry.slot].get(), path);
+            }
+        }
+
+        destroy_entry(leaf, entry.slot);
+        shift_entries_left(leaf, entry.slot + 1);
+        leaf.count--;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_--;
+
+        EntryIndex successor = entry_or_next_leaf(entry.leaf, entry.slot);
+        if constexpr (HAS_INTERNAL_NODES)
+        {
+            if (will_underflow)
+            {
+                rebalance_leaf(entry.leaf, path, successor);
+            }
+        }
+        return successor;
+    }
+
+    constexpr OpaqueIteratedType erase_range(const OpaqueIteratedType& start_index,
+                                             const OpaqueIteratedType& end_index)
+    {
+        // Erasing rebalances nodes, which moves entries around. So instead of comparing against
+        // `end_index`, which might move, count how many entries to erase
+        std::size_t count = 0;
+        for (EntryIndex entry = start_index; entry != end_index; entry = next_of(entry))
+        {
+            count++;
+        }
+
+        EntryIndex entry = start_index;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            entry = erase({entry, true});
+        }
+        return entry;
+    }
+
+    constexpr void clear()
+    {
+        if (root() == NULL_NODE)
+        {
+            return;
+        }
+        destroy_subtree(root(), height());
+        set_root(NULL_NODE);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_ = NULL_NODE;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_ = NULL_NODE;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_height_ = 0;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+    }
+
+protected:
+    [[nodiscard]] constexpr NodeIndex root() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_root_;
+    }
+    constexpr void set_root(NodeIndex node) { IMPLEMENTATION_DETAIL_DO_NOT_USE_root_ = node; }
+    [[nodiscard]] constexpr NodeIndex first_leaf() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_;
+    }
+    [[nodiscard]] constexpr NodeIndex last_leaf() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_;
+    }
+
+    constexpr auto& leaves() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_; }
+    constexpr auto& internal_nodes() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_internal_nodes_; }
+
+    [[nodiscard]] constexpr const LeafNodeType& leaf_at(NodeIndex node) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_.at(node);
+    }
+    constexpr LeafNodeType& leaf_at(NodeIndex node) { return leaves().at(node); }
+    [[nodiscard]] constexpr const InternalNodeType& internal_at(NodeIndex node) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_internal_nodes_.at(node);
+    }
+    constexpr InternalNodeType& internal_at(NodeIndex node) { return internal_nodes().at(node); }
+
+    template <typename K1, typename K2>
+    [[nodiscard]] constexpr bool compare(const K1& lhs, const K2& rhs) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(lhs, rhs);
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType first_entry_of(NodeIndex leaf) const
+    {
+        if (leaf == NULL_NODE)
+        {
+            return end_index();
+        }
+        return {leaf, 0};
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType entry_or_next_leaf(NodeIndex leaf,
+                                                                  NodeIndex slot) const
+    {
+        if (slot < leaf_at(leaf).count)
+        {
+            return {leaf, slot};
+        }
+        return first_entry_of(leaf_at(leaf).next);
+    }
+
+    // Points the leaf after `leaf_index` back at it, or makes it the last leaf if there is none
+    constexpr void link_next_leaf_back_to(NodeIndex leaf_index)
+    {
+        const NodeIndex next_index = leaf_at(leaf_index).next;
+        if (next_index == NULL_NODE)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_ = leaf_index;
+        }
+        else
+        {
+            leaf_at(next_index).prev = leaf_index;
+        }
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType last_entry_of(NodeIndex leaf) const
+    {
+        if (leaf == NULL_NODE)
+        {
+            return end_index();
+        }
+        return {leaf, leaf_at(leaf).count - 1};
+    }
+
+    // Number of separators that are not greater than `key`, which is the child to descend into
+    template <typename Key>
+    [[nodiscard]] constexpr NodeIndex child_position_of(const InternalNodeType& node,
+                                                        const Key& key) const
+    {
+        NodeIndex first = 0;
+        NodeIndex count = node.child_count - 1;
+        while (count > 0)
+        {
+            const NodeIndex half = count / 2;
+            if (!compare(key, node.separators[first + half].get()))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+        return first;
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr NodeIndex lower_bound_slot(const LeafNodeType& leaf,
+                                                       const Key& key) const
+    {
+        NodeIndex first = 0;
+        NodeIndex count = leaf.count;
+        while (count > 0)
+        {
+            const NodeIndex half = count / 2;
+            if (compare(leaf.keys[first + half].get(), key))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+        return first;
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr NodeIndex upper_bound_slot(const LeafNodeType& leaf,
+                                                       const Key& key) const
+    {
+        NodeIndex first = 0;
+        NodeIndex count = leaf.count;
+        while (count > 0)
+        {
+            const NodeIndex half = count / 2;
+            if (!compare(key, leaf.keys[first + half].get()))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+        return first;
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr NodeIndex leaf_index_of(const Key& key) const
+    {
+        NodeIndex node = root();
+        if constexpr (HAS_INTERNAL_NODES)
+        {
+            for (std::size_t level = height(); level > 0; level--)
+            {
+                const InternalNodeType& internal = internal_at(node);
+                node = internal.children[child_position_of(internal, key)];
+            }
+        }
+        return node;
+    }
+
+    template <typename Key>
+    constexpr NodeIndex find_path_to_leaf(const Key& key, Path& path) const
+    {
+        NodeIndex node = root();
+        for (std::size_t depth = 0; depth < height(); depth++)
+        {
+            const InternalNodeType& internal = internal_at(node);
+            const NodeIndex child_position = child_position_of(internal, key);
+            path[depth] = {node, child_position};
+            node = internal.children[child_position];
+        }
+        return node;
+    }
+
+    template <typename T>
+    static constexpr void relocate(optional_storage_detail::OptionalStorage<T>& destination,
+                                   optional_storage_detail::OptionalStorage<T>& source)
+    {
+        memory::construct_at_address_of(destination, std::move(source));
+        memory::destroy_at_address_of(source.value);
+    }
+
+    static constexpr void relocate_entry(LeafNodeType& destination,
+                                         NodeIndex destination_slot,
+                                         LeafNodeType& source,
+                                         NodeIndex source_slot)
+    {
+        relocate(destination.keys[destination_slot], source.keys[source_slot]);
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            relocate(destination.values[destination_slot], source.values[source_slot]);
+        }
+    }
+
+    static constexpr void destroy_entry(LeafNodeType& leaf, NodeIndex slot)
+    {
+        memory::destroy_at_address_of(leaf.keys[slot].value);
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            memory::destroy_at_address_of(leaf.values[slot].value);
+        }
+    }
+
+    // Opens up `slot` by moving the entries from `slot` onwards one slot to the right
+    static constexpr void shift_entries_right(LeafNodeType& leaf, NodeIndex slot)
+    {
+        for (NodeIndex i = leaf.count; i > slot; i--)
+        {
+            relocate_entry(leaf, i, leaf, i - 1);
+        }
+    }
+
+    // Closes the gap before `slot` by moving the entries from `slot` onwards one slot to the left
+    static constexpr void shift_entries_left(LeafNodeType& leaf, NodeIndex slot)
+    {
+        for (NodeIndex i = slot; i < leaf.count; i++)
+        {
+            relocate_entry(leaf, i - 1, leaf, i);
+        }
+    }
+
+    constexpr void construct_separator(InternalNodeType& node,
+                                       NodeIndex position,
+                                       const K& key) const
+    {
+        memory::construct_at_address_of(node.separators[position], std::in_place, key);
+    }
+
+    constexpr void replace_separator(InternalNodeType& node, NodeIndex position, const K& key)
+    {
+        memory::destroy_at_address_of(node.separators[position].value);
+        construct_separator(node, position, key);
+    }
+
+    // Splits the overflowing leaf of `entry` in two. Returns where the entry ended up.
+    constexpr EntryIndex split_leaf(EntryIndex entry)
+    {
+        Path path{};
+        const NodeIndex left_index =
+            find_path_to_leaf(leaf_at(entry.leaf).keys[entry.slot].get(), path);
+
+        const NodeIndex right_index = leaves().emplace_and_return_index();
+        LeafNodeType& left = leaf_at(left_index);
+        LeafNodeType& right = leaf_at(right_index);
+
+        const auto left_count = static_cast<NodeIndex>(left.count / 2);
+        for (NodeIndex i = left_count; i < left.count; i++)
+        {
+            relocate_entry(right, i - left_count, left, i);
+        }
+        right.count = left.count - left_count;
+        left.count = left_count;
+        right.prev = left_index;
+        right.next = left.next;
+        left.next = right_index;
+        link_next_leaf_back_to(right_index);
+
+        insert_into_parent(path, height(), left_index, right.keys[0].get(), right_index);
+
+        if (entry.slot < left_count)
+        {
+            return entry;
+        }
+        return {right_index, entry.slot - left_count};
+    }
+
+    // Registers `right_child`, which was split off of `left_child`, in the parent of `left_child`.
+    // `depth` is the depth of `left_child` (the number of internal nodes above it).
+    constexpr void insert_into_parent(const Path& path,
+                                      std::size_t depth,
+                                      NodeIndex left_child,
+                                      const K& separator,
+                                      NodeIndex right_child)
+    {
+        if (depth == 0)
+        {
+            // `left_child` was the root, so the tree grows a level
+            const NodeIndex new_root = internal_nodes().emplace_and_return_index();
+            InternalNodeType& node = internal_at(new_root);
+            construct_separator(node, 0, separator);
+            node.children[0] = left_child;
+            node.children[1] = right_child;
+            node.child_count = 2;
+            set_root(new_root);
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_height_++;
+            return;
+        }
+
+        const PathStep& step = path[depth - 1];
+        InternalNodeType& node = internal_at(step.node);
+        const NodeIndex position = step.child_position;
+        for (NodeIndex i = node.child_count - 1; i > position; i--)
+        {
+            relocate(node.separators[i], node.separators[i - 1]);
+            node.children[i + 1] = node.children[i];
+        }
+        construct_separator(node, position, separator);
+        node.children[position + 1] = right_child;
+        node.child_count++;
+
+        if (node.child_count > BRANCHING_FACTOR)
+        {
+            split_internal(path, depth - 1);
+        }
+    }
+
+    constexpr void split_internal(const Path& path, std::size_t depth)
+    {
+        const NodeIndex left_index = path[depth].node;
+        const NodeIndex right_index = internal_nodes().emplace_and_return_index();
+        InternalNodeType& left = internal_at(left_index);
+        InternalNodeType& right = internal_at(right_index);
+
+        // The separator between the two halves moves up to the parent
+        const auto left_count = static_cast<NodeIndex>(left.child_count / 2);
+        for (NodeIndex i = left_count; i < left.child_count; i++)
+        {
+            right.children[i - left_count] = left.children[i];
+        }
+        for (NodeIndex i = left_count; i + 1 < left.child_count; i++)
+        {
+            relocate(right.separators[i - left_count], left.separators[i]);
+        }
+        right.child_count = left.child_count - left_count;
+        left.child_count = left_count;
+
+        // The separator is copied on the way up, so destroy the leftover after that
+        insert_into_parent(
+            path, depth, left_index, left.separators[left_count - 1].get(), right_index);
+        memory::destroy_at_address_of(internal_at(left_index).separators[left_count - 1].value);
+    }
+
+    // Restores the minimum occupancy of `leaf_index` after an erasure, by borrowing an entry from
+    // a sibling or merging with it. Keeps `successor` pointing at the same entry.
+    constexpr void rebalance_leaf(NodeIndex leaf_index, const Path& path, EntryIndex& successor)
+    {
+        const PathStep& step = path[height() - 1];
+        InternalNodeType& parent = internal_at(step.node);
+        const NodeIndex position = step.child_position;
+        LeafNodeType& leaf = leaf_at(leaf_index);
+
+        if (position > 0)
+        {
+            const NodeIndex left_index = parent.children[position - 1];
+            LeafNodeType& left = leaf_at(left_index);
+            if (left.count > MIN_LEAF_ENTRY_COUNT)
+            {
+                shift_entries_right(leaf, 0);
+                relocate_entry(leaf, 0, left, left.count - 1);
+                left.count--;
+                leaf.count++;
+                replace_separator(parent, position - 1, leaf.keys[0].get());
+                if (successor.leaf == leaf_index)
+                {
+                    successor.slot++;
+                }
+                return;
+            }
+        }
+
+        if (position + 1 < parent.child_count)
+        {
+            const NodeIndex right_index = parent.children[position + 1];
+            LeafNodeType& right = leaf_at(right_index);
+            if (right.count > MIN_LEAF_ENTRY_COUNT)
+            {
+                relocate_entry(leaf, leaf.count, right, 0);
+                shift_entries_left(right, 1);
+                right.count--;
+                leaf.count++;
+                replace_separator(parent, position, right.keys[0].get());
+                if (successor.leaf == right_index)
+                {
+                    successor = successor.slot == 0
+                                    ? EntryIndex{leaf_index, leaf.count - 1}
+                                    : EntryIndex{right_index, successor.slot - 1};
+                }
+                return;
+            }
+        }
+
+        // Neither sibling can spare an entry, so merge with one of them. The right node of the
+        // pair is always merged into the left one.
+        const NodeIndex merge_position = position > 0 ? position - 1 : position;
+        const NodeIndex left_index = parent.children[merge_position];
+        const NodeIndex right_index = parent.children[merge_position + 1];
+        LeafNodeType& left = leaf_at(left_index);
+        LeafNodeType& right = leaf_at(right_index);
+        const NodeIndex left_count = left.count;
+        for (NodeIndex i = 0; i < right.count; i++)
+        {
+            relocate_entry(left, left_count + i, right, i);
+        }
+        left.count += right.count;
+        left.next = right.next;
+        link_next_leaf_back_to(left_index);
+        if (successor.leaf == right_index)
+        {
+            successor = {left_index, left_count + successor.slot};
+        }
+        leaves().delete_at_and_return_repositioned_index(right_index);
+
+        remove_child(path, height() - 1, merge_position + 1);
+    }
+
+    // Removes child `child_position` of the internal node at `depth` along with the separator to
+    // its left, and restores the minimum occupancy of that node.
+    constexpr void remove_child(const Path& path, std::size_t depth, NodeIndex child_position)
+    {
+        const NodeIndex node_index = path[depth].node;
+        InternalNodeType& node = internal_at(node_index);
+        memory::destroy_at_address_of(node.separators[child_position - 1].value);
+        for (NodeIndex i = child_position; i < node.child_count - 1; i++)
+        {
+            relocate(node.separators[i - 1], node.separators[i]);
+            node.children[i] = node.children[i + 1];
+        }
+        node.child_count--;
+
+        if (depth == 0)
+        {
+            // The root only needs one child, and then the tree shrinks a level
+            if (node.child_count == 1)
+            {
+                set_root(node.children[0]);
+                internal_nodes().delete_at_and_return_repositioned_index(node_index);
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_height_--;
+            }
+            return;
+        }
+
+        if (node.child_count < MIN_CHILD_COUNT)
+        {
+            rebalance_internal(path, depth);
+        }
+    }
+
+    constexpr void rebalance_internal(const Path& path, std::size_t depth)
+    {
+        const NodeIndex node_index = path[depth].node;
+        const PathStep& step = path[depth - 1];
+        InternalNodeType& parent = internal_at(step.node);
+        const NodeIndex position = step.child_position;
+        InternalNodeType& node = internal_at(node_index);
+
+        if (position > 0)
+        {
+            InternalNodeType& left = internal_at(parent.children[position - 1]);
+            if (left.child_count > MIN_CHILD_COUNT)
+            {
+                // Rotate the last child of `left` through the parent
+                for (NodeIndex i = node.child_count; i > 0; i--)
+                {
+                    node.children[i] = node.children[i - 1];
+                }
+                for (NodeIndex i = node.child_count - 1; i > 0; i--)
+                {
+                    relocate(node.separators[i], node.separators[i - 1]);
+                }
+                node.children[0] = left.children[left.child_count - 1];
+                relocate(node.separators[0], parent.separators[position - 1]);
+                relocate(parent.separators[position - 1], left.separators[left.child_count - 2]);
+                node.child_count++;
+                left.child_count--;
+                return;
+            }
+        }
+
+        if (position + 1 < parent.child_count)
+        {
+            InternalNodeType& right = internal_at(parent.children[position + 1]);
+            if (right.child_count > MIN_CHILD_COUNT)
+            {
+                // Rotate the first child of `right` through the parent
+                node.children[node.child_count] = right.children[0];
+                relocate(node.separators[node.child_count - 1], parent.separators[position]);
+                relocate(parent.separators[position], right.separators[0]);
+                for (NodeIndex i = 1; i < right.child_count; i++)
+                {
+                    right.children[i - 1] = right.children[i];
+                }
+                for (NodeIndex i = 1; i + 1 < right.child_count; i++)
+                {
+                    relocate(right.separators[i - 1], right.separators[i]);
+                }
+                node.child_count++;
+                right.child_count--;
+                return;
+            }
+        }
+
+        // Merge the right node of the pair into the left one, pulling down their separator
+        const NodeIndex merge_position = position > 0 ? position - 1 : position;
+        const NodeIndex left_index = parent.children[merge_position];
+        const NodeIndex right_index = parent.children[merge_position + 1];
+        InternalNodeType& left = internal_at(left_index);
+        InternalNodeType& right = internal_at(right_index);
+        const NodeIndex left_count = left.child_count;
+        construct_separator(left, left_count - 1, parent.separators[merge_position].get());
+        for (NodeIndex i = 0; i < right.child_count; i++)
+        {
+            left.children[left_count + i] = right.children[i];
+        }
+        for (NodeIndex i = 0; i + 1 < right.child_count; i++)
+        {
+            relocate(left.separators[left_count + i], right.separators[i]);
+        }
+        left.child_count += right.child_count;
+        internal_nodes().delete_at_and_return_repositioned_index(right_index);
+
+        remove_child(path, depth - 1, merge_position + 1);
+    }
+
+    constexpr void destroy_subtree(NodeIndex node_index, std::size_t level)
+    {
+        if constexpr (HAS_INTERNAL_NODES)
+        {
+            if (level > 0)
+            {
+                InternalNodeType& node = internal_at(node_index);
+                for (NodeIndex i = 0; i < node.child_count; i++)
+                {
+                    destroy_subtree(node.children[i], level - 1);
+                }
+                for (NodeIndex i = 0; i + 1 < node.child_count; i++)
+                {
+                    memory::destroy_at_address_of(node.separators[i].value);
+                }
+                internal_nodes().delete_at_and_return_repositioned_index(node_index);
+                return;
+            }
+        }
+
+        LeafNodeType& leaf = leaf_at(node_index);
+        for (NodeIndex i = 0; i < leaf.count; i++)
+        {
+            destroy_entry(leaf, i);
+        }
+        leaves().delete_at_and_return_repositioned_index(node_index);
+    }
+};
+
+}  // namespace fixed_containers::fixed_b_tree_detail
+
+namespace fixed_containers::fixed_b_tree_detail::specializations
+{
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t LEAF_CAPACITY,
+          std::size_t BRANCHING_FACTOR>
+class FixedBTree
+  : public FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare, LEAF_CAPACITY, BRANCHING_FACTOR>
+{
+    using Base = FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare, LEAF_CAPACITY, BRANCHING_FACTOR>;
+
+public:
+    constexpr FixedBTree() noexcept
+      : Base()
+    {
+    }
+    explicit constexpr FixedBTree(const Compare& comparator) noexcept
+      : Base(comparator)
+    {
+    }
+
+    constexpr FixedBTree(const FixedBTree& other)
+        requires TriviallyCopyConstructible<K> && TriviallyCopyConstructible<V>
+    = default;
+    constexpr FixedBTree(FixedBTree&& other) noexcept
+        requires TriviallyMoveConstructible<K> && TriviallyMoveConstructible<V>
+    = default;
+    constexpr FixedBTree& operator=(const FixedBTree& other)
+        requires TriviallyCopyAssignable<K> && TriviallyCopyAssignable<V>
+    = default;
+    constexpr FixedBTree& operator=(FixedBTree&& other) noexcept
+        requires TriviallyMoveAssignable<K> && TriviallyMoveAssignable<V>
+    = default;
+
+    constexpr FixedBTree(const FixedBTree& other)
+      : FixedBTree(other.key_comp())
+    {
+        this->build_from_sorted_unique(other.size(), emplace_next_from<false>(other));
+    }
+    constexpr FixedBTree(FixedBTree&& other) noexcept
+      : FixedBTree(other.key_comp())
+    {
+        this->build_from_sorted_unique(other.size(), emplace_next_from<true>(other));
+        // Clear the moved-out-of-map. This is consistent with both std::map
+        // as well as the trivial move constructor of this class.
+        other.clear();
+    }
+    constexpr FixedBTree& operator=(const FixedBTree& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->build_from_sorted_unique(other.size(), emplace_next_from<false>(other));
+        return *this;
+    }
+    constexpr FixedBTree& operator=(FixedBTree&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->build_from_sorted_unique(other.size(), emplace_next_from<true>(other));
+        // The trivial assignment operator does not `other.clear()`, so don't do it here either for
+        // consistency across FixedMaps. std::map<T> does clear it, so behavior is different.
+        // Both choices are fine, because the state of a moved object is intentionally unspecified
+        // as per the standard and use-after-move is undefined behavior.
+        return *this;
+    }
+
+    constexpr ~FixedBTree() noexcept { this->clear(); }
+
+private:
+    // The entries of `other` are already sorted and unique, so they are copied (or moved) over with
+    // `build_from_sorted_unique()` in O(N) instead of being inserted one by one.
+    template <bool MOVE_ENTRIES, class OtherTree>
+    static constexpr auto emplace_next_from(OtherTree& other)
+    {
+        return [&other, entry = other.begin_index()](auto& leaf, NodeIndex slot) mutable
+        {
+            auto& other_leaf = other.leaf_at(entry.leaf);
+            if constexpr (MOVE_ENTRIES)
+            {
+                memory::construct_at_address_of(
+                    leaf.keys[slot], std::in_place, std::move(other_leaf.keys[entry.slot].get()));
+            }
+            else
+            {
+                memory::construct_at_address_of(
+                    leaf.keys[slot], std::in_place, other_leaf.keys[entry.slot].get());
+            }
+            if constexpr (MOVE_ENTRIES && Base::HAS_ASSOCIATED_VALUE)
+            {
+                memory::construct_at_address_of(leaf.values[slot],
+                                                std::in_place,
+                                                std::move(other_leaf.values[entry.slot].get()));
+            }
+            else if constexpr (Base::HAS_ASSOCIATED_VALUE)
+            {
+                memory::construct_at_address_of(
+                    leaf.values[slot], std::in_place, other_leaf.values[entry.slot].get());
+            }
+            entry = other.next_of(entry);
+        };
+    }
+};
+
+template <TriviallyCopyable K,
+          TriviallyCopyable V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t LEAF_CAPACITY,
+          std::size_t BRANCHING_FACTOR>
+class FixedBTree<K, V, MAXIMUM_SIZE, Compare, LEAF_CAPACITY, BRANCHING_FACTOR>
+  : public FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare, LEAF_CAPACITY, BRANCHING_FACTOR>
+{
+    using Base = FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare, LEAF_CAPACITY, BRANCHING_FACTOR>;
+
+public:
+    constexpr FixedBTree() noexcept
+      : Base()
+    {
+    }
+    explicit constexpr FixedBTree(const Compare& comparator) noexcept
+      : Base(comparator)
+    {
+    }
+};
+
+}  // namespace fixed_containers::fixed_b_tree_detail::specializations
+
+namespace fixed_containers::fixed_b_tree_detail
+{
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          std::size_t LEAF_CAPACITY = default_leaf_capacity<K>(),
+          std::size_t BRANCHING_FACTOR = default_branching_factor<K>()>
+using FixedBTree = fixed_b_tree_detail::specializations::
+    FixedBTree<K, V, MAXIMUM_SIZE, Compare, LEAF_CAPACITY, BRANCHING_FACTOR>;
+}  // namespace fixed_containers::fixed_b_tree_detail
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "fixed_containers/fixed_b_tree.hpp"
+#include "fixed_containers/fixed_map_adapter.hpp"
+#include "fixed_containers/map_checking.hpp"
+
+#include <array>
+#include <functional>
+
+namespace fixed_containers
+{
+
+// An ordered map like `FixedMap`, but backed by a B+-tree instead of a red-black tree. Lookups
+// binary-search a few wide nodes instead of chasing one pointer per level, and iteration walks
+// contiguous leaves, at the cost of more memory (see `FixedBTreeBase`) and of keys having to be
+// copy constructible. Iterators are bidirectional iterators.
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare = std::less<K>,
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedBTreeMap
+  : public FixedMapAdapter<K,
+                           V,
+                           fixed_b_tree_detail::FixedBTree<K, V, MAXIMUM_SIZE, Compare>,
+                           CheckingType>
+{
+    using FMA = FixedMapAdapter<K,
+                                V,
+                                fixed_b_tree_detail::FixedBTree<K, V, MAXIMUM_SIZE, Compare>,
+                                CheckingType>;
+
+public:
+    using key_compare = Compare;
+
+public:
+    constexpr FixedBTreeMap() noexcept
+      : FixedBTreeMap{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedBTreeMap(const Compare& comparator) noexcept
+      : FMA{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedBTreeMap(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedBTreeMap{comparator}
+    {
+        this->insert(first, last, loc);
+    }
+
+    constexpr FixedBTreeMap(
+        std::initializer_list<typename FixedBTreeMap::value_type> list,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedBTreeMap{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr key_compare key_comp() const
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_table_.key_comp();
+    }
+};
+
+/**
+ * Construct a FixedBTreeMap with its capacity being deduced from the number of key-value pairs
+ * being passed.
+ */
+template <typename K,
+          typename V,
+          typename Compare = std::less<K>,
+          customize::MapChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedMapType = FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>>
+[[nodiscard]] constexpr FixedMapType make_fixed_b_tree_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    return {std::begin(list), std::end(list), comparator, loc};
+}
+template <typename K,
+          typename V,
+          typename Compare = std::less<K>,
+          customize::MapChecking<K> CheckingType,
+          typename FixedMapType = FixedBTreeMap<K, V, 0, Compare, CheckingType>>
+[[nodiscard]] constexpr FixedMapType make_fixed_b_tree_map(
+    const std::array<std::pair<K, V>, 0>& /*list*/,
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& /*loc*/ =
+        std_transition::source_location::current()) noexcept
+{
+    return FixedMapType{comparator};
+}
+
+template <typename K, typename V, typename Compare = std::less<K>, std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_b_tree_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>;
+    using FixedMapType = FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>;
+    return make_fixed_b_tree_map<K, V, Compare, CheckingType, MAXIMUM_SIZE, FixedMapType>(
+        list, comparator, loc);
+}
+template <typename K, typename V, typename Compare = std::less<K>>
+[[nodiscard]] constexpr auto make_fixed_b_tree_map(
+    const std::array<std::pair<K, V>, 0>& list,
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::MapAbortChecking<K, V, 0>;
+    using FixedMapType = FixedBTreeMap<K, V, 0, Compare, CheckingType>;
+    return make_fixed_b_tree_map<K, V, Compare, CheckingType, FixedMapType>(
+        list, comparator, loc);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<fixed_containers::FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
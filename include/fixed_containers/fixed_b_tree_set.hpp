@@ -0,0 +1,141 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_b_tree.hpp"
+#include "fixed_containers/fixed_set_adapter.hpp"
+#include "fixed_containers/set_checking.hpp"
+
+#include <array>
+#include <functional>
+
+namespace fixed_containers
+{
+
+// Same as `FixedBTreeMap`, for sets. See `FixedBTreeMap` for the trade-offs against `FixedSet`.
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare = std::less<K>,
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+class FixedBTreeSet
+  : public FixedSetAdapter<K,
+                           fixed_b_tree_detail::FixedBTree<K, EmptyValue, MAXIMUM_SIZE, Compare>,
+                           CheckingType>
+{
+    using FSA =
+        FixedSetAdapter<K,
+                        fixed_b_tree_detail::FixedBTree<K, EmptyValue, MAXIMUM_SIZE, Compare>,
+                        CheckingType>;
+
+public:
+    using key_compare = Compare;
+    using value_compare = Compare;
+
+public:
+    constexpr FixedBTreeSet() noexcept
+      : FixedBTreeSet{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedBTreeSet(const Compare& comparator) noexcept
+      : FSA{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedBTreeSet(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedBTreeSet{comparator}
+    {
+        this->insert(first, last, loc);
+    }
+
+    constexpr FixedBTreeSet(
+        std::initializer_list<typename FixedBTreeSet::value_type> list,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedBTreeSet{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr key_compare key_comp() const
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_table_.key_comp();
+    }
+    [[nodiscard]] constexpr value_compare value_comp() const { return key_comp(); }
+};
+
+/**
+ * Construct a FixedBTreeSet with its capacity being deduced from the number of items being passed.
+ */
+template <typename K,
+          typename Compare = std::less<K>,
+          customize::SetChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedSetType = FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>>
+[[nodiscard]] constexpr FixedSetType make_fixed_b_tree_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    return {std::begin(list), std::end(list), comparator, loc};
+}
+template <typename K,
+          typename Compare = std::less<K>,
+          customize::SetChecking<K> CheckingType,
+          typename FixedSetType = FixedBTreeSet<K, 0, Compare, CheckingType>>
+[[nodiscard]] constexpr FixedSetType make_fixed_b_tree_set(
+    const std::array<K, 0>& /*list*/,
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& /*loc*/ =
+        std_transition::source_location::current()) noexcept
+{
+    return FixedSetType{comparator};
+}
+
+template <typename K, typename Compare = std::less<K>, std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_b_tree_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>;
+    using FixedSetType = FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>;
+    return make_fixed_b_tree_set<K, Compare, CheckingType, MAXIMUM_SIZE, FixedSetType>(
+        list, comparator, loc);
+}
+template <typename K, typename Compare = std::less<K>>
+[[nodiscard]] constexpr auto make_fixed_b_tree_set(
+    const std::array<K, 0>& list,
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::SetAbortChecking<K, 0>;
+    using FixedSetType = FixedBTreeSet<K, 0, Compare, CheckingType>;
+    return make_fixed_b_tree_set<K, Compare, CheckingType, FixedSetType>(list, comparator, loc);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          fixed_containers::customize::SetChecking<K> CheckingType>
+struct tuple_size<fixed_containers::FixedBTreeSet<K, MAXIMUM_SIZE, Compare, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
@@ -435,7 +436,16 @@ public:
             destroy_range(write_start_it, std::next(write_start_it, entry_count_to_remove));
 
             // Do the relocation
-            algorithm::uninitialized_relocate(read_start_it, read_end_it, write_start_it);
+            if constexpr (TriviallyRelocatable<T>)
+            {
+                memmove_relocate_towards_front(array_index_of(read_start_it),
+                                               array_index_of(write_start_it),
+                                               static_cast<std::size_t>(entry_count_to_move));
+            }
+            else
+            {
+                algorithm::uninitialized_relocate(read_start_it, read_end_it, write_start_it);
+            }
         }
         else
         {
@@ -614,11 +624,71 @@ private:
         auto read_end_it = std::next(read_start_it, value_count_to_move);
         auto write_end_it =
             std::next(read_start_it, static_cast<std::ptrdiff_t>(n) + value_count_to_move);
+        if constexpr (TriviallyRelocatable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                memmove_relocate_towards_back(array_index_of(read_end_it),
+                                              array_index_of(write_end_it),
+                                              static_cast<std::size_t>(value_count_to_move));
+                return read_start_it;
+            }
+        }
         algorithm::uninitialized_relocate_backward(read_start_it, read_end_it, write_end_it);
 
         return read_start_it;
     }
 
+    [[nodiscard]] constexpr std::size_t array_index_of(const const_iterator it) const
+    {
+        return increment_index_with_wraparound(
+            front_index(), static_cast<std::size_t>(std::distance(cbegin(), it)));
+    }
+
+    // The two functions below relocate `count` entries with as few `std::memmove` calls as the
+    // wraparound allows: a span that wraps around is split at the end of the array. Source and
+    // destination may overlap, so chunks are visited in the direction of the relocation.
+    void memmove_relocate_chunk(const std::size_t source_index,
+                                const std::size_t destination_index,
+                                const std::size_t count)
+    {
+        std::memmove(static_cast<void*>(std::addressof(array()[destination_index])),
+                     static_cast<const void*>(std::addressof(array()[source_index])),
+                     count * sizeof(OptionalT));
+    }
+    void memmove_relocate_towards_front(std::size_t source_index,
+                                        std::size_t destination_index,
+                                        std::size_t count)
+    {
+        while (count > 0)
+        {
+            const std::size_t chunk = std::min(
+                {count, MAXIMUM_SIZE - source_index, MAXIMUM_SIZE - destination_index});
+            memmove_relocate_chunk(source_index, destination_index, chunk);
+            source_index = increment_index_with_wraparound(source_index, chunk);
+            destination_index = increment_index_with_wraparound(destination_index, chunk);
+            count -= chunk;
+        }
+    }
+    // Takes one-past-the-end indices, like `std::move_backward()`
+    void memmove_relocate_towards_back(std::size_t source_end_index,
+                                       std::size_t destination_end_index,
+                                       std::size_t count)
+    {
+        while (count > 0)
+        {
+            // An end index of 0 is the end of the array
+            source_end_index = source_end_index == 0 ? MAXIMUM_SIZE : source_end_index;
+            destination_end_index =
+                destination_end_index == 0 ? MAXIMUM_SIZE : destination_end_index;
+            const std::size_t chunk = std::min({count, source_end_index, destination_end_index});
+            source_end_index -= chunk;
+            destination_end_index -= chunk;
+            memmove_relocate_chunk(source_end_index, destination_end_index, chunk);
+            count -= chunk;
+        }
+    }
+
     template <InputIterator InputIt>
     constexpr iterator insert_internal(std::forward_iterator_tag /*unused*/,
                                        const_iterator pos,
@@ -1024,6 +1094,13 @@ public:
     }
 };
 
+// The entries are stored inline, so the deque can be relocated with its bytes whenever they can
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+struct IsTriviallyRelocatable<FixedDeque<T, MAXIMUM_SIZE, CheckingType>>
+  : std::bool_constant<TriviallyRelocatable<T>>
+{
+};
+
 template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
 [[nodiscard]] constexpr bool is_full(const FixedDeque<T, MAXIMUM_SIZE, CheckingType>& container)
 {
@@ -53,7 +53,18 @@ public:
 
     constexpr void clear() noexcept
     {
-        delete_range_and_return_next_index(front_index(), MAXIMUM_SIZE);
+        // Every value goes, so there is no need to unlink them one at a time. Only the sentinel's
+        // links matter, as the links of free slots are overwritten when they are reused.
+        IndexType idx = front_index();
+        while (idx != MAXIMUM_SIZE)
+        {
+            const IndexType next = next_of(idx);
+            storage().delete_at_and_return_repositioned_index(idx);
+            idx = next;
+        }
+        next_of(MAXIMUM_SIZE) = MAXIMUM_SIZE;
+        prev_of(MAXIMUM_SIZE) = MAXIMUM_SIZE;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
     }
 
     [[nodiscard]] constexpr const T& at(const IndexType index) const { return storage().at(index); }
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "fixed_containers/fixed_map_adapter.hpp"
+#include "fixed_containers/fixed_swiss_hashtable.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <array>
+
+namespace fixed_containers
+{
+
+// Same API as `FixedUnorderedMap`, but backed by a SwissTable-style hashtable instead of Robin Hood
+// hashing. See `FixedSwissHashtable` for the trade-offs.
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          std::size_t SLOT_COUNT = fixed_swiss_hashtable_detail::default_slot_count(MAXIMUM_SIZE),
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedFlatHashMap
+  : public FixedMapAdapter<
+        K,
+        V,
+        fixed_swiss_hashtable_detail::
+            FixedSwissHashtable<K, V, MAXIMUM_SIZE, SLOT_COUNT, Hash, KeyEqual>,
+        CheckingType>
+{
+    using FMA = FixedMapAdapter<
+        K,
+        V,
+        fixed_swiss_hashtable_detail::
+            FixedSwissHashtable<K, V, MAXIMUM_SIZE, SLOT_COUNT, Hash, KeyEqual>,
+        CheckingType>;
+
+public:
+    constexpr FixedFlatHashMap(const Hash& hash = Hash(),
+                               const KeyEqual& equal = KeyEqual()) noexcept
+      : FMA{hash, equal}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedFlatHashMap(
+        InputIt first,
+        InputIt last,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatHashMap{hash, equal}
+    {
+        this->insert(first, last, loc);
+    }
+
+    constexpr FixedFlatHashMap(
+        std::initializer_list<typename FixedFlatHashMap::value_type> list,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatHashMap{hash, equal}
+    {
+        this->insert(list, loc);
+    }
+};
+
+/**
+ * Construct a FixedFlatHashMap with its capacity being deduced from the number of key-value pairs
+ * being passed.
+ */
+template <
+    typename K,
+    typename V,
+    class Hash = wyhash::hash<K>,
+    class KeyEqual = std::equal_to<K>,
+    customize::MapChecking<K> CheckingType,
+    std::size_t MAXIMUM_SIZE,
+    std::size_t SLOT_COUNT = fixed_swiss_hashtable_detail::default_slot_count(MAXIMUM_SIZE),
+    // Exposing this as a template parameter is useful for customization (for example with
+    // child classes that set the CheckingType)
+    typename FixedMapType =
+        FixedFlatHashMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, SLOT_COUNT, CheckingType>>
+[[nodiscard]] constexpr FixedMapType make_fixed_flat_hash_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    return {std::begin(list), std::end(list), hash, key_equal, loc};
+}
+template <typename K,
+          typename V,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          customize::MapChecking<K> CheckingType,
+          typename FixedMapType = FixedFlatHashMap<K, V, 0, Hash, KeyEqual, 0, CheckingType>>
+[[nodiscard]] constexpr FixedMapType make_fixed_flat_hash_map(
+    const std::array<std::pair<K, V>, 0>& /*list*/,
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& /*loc*/ =
+        std_transition::source_location::current()) noexcept
+{
+    return FixedMapType{hash, key_equal};
+}
+
+template <
+    typename K,
+    typename V,
+    class Hash = wyhash::hash<K>,
+    class KeyEqual = std::equal_to<K>,
+    std::size_t MAXIMUM_SIZE,
+    std::size_t SLOT_COUNT = fixed_swiss_hashtable_detail::default_slot_count(MAXIMUM_SIZE)>
+[[nodiscard]] constexpr auto make_fixed_flat_hash_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>;
+    using FixedMapType =
+        FixedFlatHashMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, SLOT_COUNT, CheckingType>;
+    return make_fixed_flat_hash_map<K,
+                                    V,
+                                    Hash,
+                                    KeyEqual,
+                                    CheckingType,
+                                    MAXIMUM_SIZE,
+                                    SLOT_COUNT,
+                                    FixedMapType>(list, hash, key_equal, loc);
+}
+template <typename K, typename V, class Hash = wyhash::hash<K>, class KeyEqual = std::equal_to<K>>
+[[nodiscard]] constexpr auto make_fixed_flat_hash_map(
+    const std::array<std::pair<K, V>, 0> list,
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::MapAbortChecking<K, V, 0>;
+    using FixedMapType = FixedFlatHashMap<K, V, 0, Hash, KeyEqual, 0, CheckingType>;
+    return make_fixed_flat_hash_map<K, V, Hash, KeyEqual, CheckingType, FixedMapType>(
+        list, hash, key_equal, loc);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t SLOT_COUNT,
+          class Hash,
+          class KeyEqual,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<fixed_containers::FixedFlatHashMap<K,
+                                                     V,
+                                                     MAXIMUM_SIZE,
+                                                     Hash,
+                                                     KeyEqual,
+                                                     SLOT_COUNT,
+                                                     CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
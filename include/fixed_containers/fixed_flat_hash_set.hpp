@@ -0,0 +1,159 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_set_adapter.hpp"
+#include "fixed_containers/fixed_swiss_hashtable.hpp"
+#include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <array>
+
+namespace fixed_containers
+{
+
+// Same API as `FixedUnorderedSet`, but backed by a SwissTable-style hashtable instead of Robin Hood
+// hashing. See `FixedSwissHashtable` for the trade-offs.
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          std::size_t SLOT_COUNT = fixed_swiss_hashtable_detail::default_slot_count(MAXIMUM_SIZE),
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+class FixedFlatHashSet
+  : public FixedSetAdapter<
+        K,
+        fixed_swiss_hashtable_detail::
+            FixedSwissHashtable<K, EmptyValue, MAXIMUM_SIZE, SLOT_COUNT, Hash, KeyEqual>,
+        CheckingType>
+{
+    using FSA = FixedSetAdapter<
+        K,
+        fixed_swiss_hashtable_detail::
+            FixedSwissHashtable<K, EmptyValue, MAXIMUM_SIZE, SLOT_COUNT, Hash, KeyEqual>,
+        CheckingType>;
+
+public:
+    constexpr FixedFlatHashSet(const Hash& hash = Hash(),
+                               const KeyEqual& equal = KeyEqual()) noexcept
+      : FSA{hash, equal}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedFlatHashSet(
+        InputIt first,
+        InputIt last,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatHashSet{hash, equal}
+    {
+        this->insert(first, last, loc);
+    }
+
+    constexpr FixedFlatHashSet(
+        std::initializer_list<typename FixedFlatHashSet::value_type> list,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatHashSet{hash, equal}
+    {
+        this->insert(list, loc);
+    }
+};
+
+/**
+ * Construct a FixedFlatHashSet with its capacity being deduced from the number of key-value pairs
+ * being passed.
+ */
+template <
+    typename K,
+    class Hash = wyhash::hash<K>,
+    class KeyEqual = std::equal_to<K>,
+    customize::SetChecking<K> CheckingType,
+    std::size_t MAXIMUM_SIZE,
+    std::size_t SLOT_COUNT = fixed_swiss_hashtable_detail::default_slot_count(MAXIMUM_SIZE),
+    // Exposing this as a template parameter is useful for customization (for example with
+    // child classes that set the CheckingType)
+    typename FixedSetType =
+        FixedFlatHashSet<K, MAXIMUM_SIZE, Hash, KeyEqual, SLOT_COUNT, CheckingType>>
+[[nodiscard]] constexpr FixedSetType make_fixed_flat_hash_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    return {std::begin(list), std::end(list), hash, key_equal, loc};
+}
+template <typename K,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          customize::SetChecking<K> CheckingType,
+          typename FixedSetType = FixedFlatHashSet<K, 0, Hash, KeyEqual, 0, CheckingType>>
+[[nodiscard]] constexpr FixedSetType make_fixed_flat_hash_set(
+    const std::array<K, 0>& /*list*/,
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& /*loc*/ =
+        std_transition::source_location::current()) noexcept
+{
+    return {hash, key_equal};
+}
+
+template <
+    typename K,
+    class Hash = wyhash::hash<K>,
+    class KeyEqual = std::equal_to<K>,
+    std::size_t MAXIMUM_SIZE,
+    std::size_t SLOT_COUNT = fixed_swiss_hashtable_detail::default_slot_count(MAXIMUM_SIZE)>
+[[nodiscard]] constexpr auto make_fixed_flat_hash_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>;
+    using FixedSetType =
+        FixedFlatHashSet<K, MAXIMUM_SIZE, Hash, KeyEqual, SLOT_COUNT, CheckingType>;
+    return make_fixed_flat_hash_set<K,
+                                    Hash,
+                                    KeyEqual,
+                                    CheckingType,
+                                    MAXIMUM_SIZE,
+                                    SLOT_COUNT,
+                                    FixedSetType>(list, hash, key_equal, loc);
+}
+template <typename K, class Hash = wyhash::hash<K>, class KeyEqual = std::equal_to<K>>
+[[nodiscard]] constexpr auto make_fixed_flat_hash_set(
+    const std::array<K, 0>& list,
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::SetAbortChecking<K, 0>;
+    using FixedSetType = FixedFlatHashSet<K, 0, Hash, KeyEqual, 0, CheckingType>;
+    return make_fixed_flat_hash_set<K, Hash, KeyEqual, CheckingType, FixedSetType>(
+        list, hash, key_equal, loc);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t SLOT_COUNT,
+          class Hash,
+          class KeyEqual,
+          fixed_containers::customize::SetChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::FixedFlatHashSet<K, MAXIMUM_SIZE, Hash, KeyEqual, SLOT_COUNT, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,260 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_flat_table.hpp"
+#include "fixed_containers/fixed_map_adapter.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/sorted_unique.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+
+namespace fixed_containers
+{
+
+// An ordered map like `FixedMap`, but with the keys kept in a sorted array and the values in a
+// parallel one (see `FixedFlatTable`). Lookups and iteration are faster and the map takes no more
+// memory than its entries, but inserting or erasing a single entry is O(N). Inserting a range sorts
+// it and merges it in one go, so prefer building the map from a range over inserting entries one
+// at a time. Keys and values must be move-assignable. Iterators are random-access iterators, and
+// any insertion or erasure invalidates all of them.
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY,
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedFlatMap
+  : public FixedMapAdapter<
+        K,
+        V,
+        fixed_flat_table_detail::FixedFlatTable<K, V, MAXIMUM_SIZE, Compare, SEARCH>,
+        CheckingType>
+{
+    using FMA = FixedMapAdapter<
+        K,
+        V,
+        fixed_flat_table_detail::FixedFlatTable<K, V, MAXIMUM_SIZE, Compare, SEARCH>,
+        CheckingType>;
+
+public:
+    using key_compare = Compare;
+
+public:
+    constexpr FixedFlatMap() noexcept
+      : FixedFlatMap{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedFlatMap(const Compare& comparator) noexcept
+      : FMA{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedFlatMap(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatMap{comparator}
+    {
+        this->insert(first, last, loc);
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedFlatMap(
+        std_transition::sorted_unique_t /*tag*/,
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatMap{comparator}
+    {
+        this->insert(std_transition::sorted_unique, first, last, loc);
+    }
+
+    constexpr FixedFlatMap(
+        std::initializer_list<typename FixedFlatMap::value_type> list,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatMap{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    // Builds the map from entries in any order, sorting them in one go (see `FixedFlatTable`). Same
+    // as the range constructor, but names what it does at call sites that build lookup tables at
+    // compile time, e.g. `static constexpr auto TABLE = FixedFlatMap<...>::from_unsorted(...)`.
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedFlatMap from_unsorted(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return FixedFlatMap{first, last, comparator, loc};
+    }
+
+    [[nodiscard]] static constexpr FixedFlatMap from_unsorted(
+        std::initializer_list<typename FixedFlatMap::value_type> list,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return FixedFlatMap{list.begin(), list.end(), comparator, loc};
+    }
+
+public:
+    using FMA::insert;
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        check_all_inserted(
+            this->IMPLEMENTATION_DETAIL_DO_NOT_USE_table_.insert_unsorted(first, last), last, loc);
+    }
+
+    // `[first, last)` must be sorted by key, with no two keys being equivalent
+    template <InputIterator InputIt>
+    constexpr void insert(std_transition::sorted_unique_t /*tag*/,
+                          InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        check_all_inserted(
+            this->IMPLEMENTATION_DETAIL_DO_NOT_USE_table_.insert_sorted_unique(first, last),
+            last,
+            loc);
+    }
+
+    constexpr void insert(std::initializer_list<typename FixedFlatMap::value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    [[nodiscard]] constexpr key_compare key_comp() const
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_table_.key_comp();
+    }
+
+private:
+    template <InputIterator InputIt>
+    static constexpr void check_all_inserted(InputIt first_not_inserted,
+                                             InputIt last,
+                                             const std_transition::source_location& loc)
+    {
+        if (first_not_inserted == last)
+        {
+            return;
+        }
+
+        std::size_t excess_element_count = 0;
+        for (; first_not_inserted != last; ++first_not_inserted)
+        {
+            excess_element_count++;
+        }
+        CheckingType::length_error(MAXIMUM_SIZE + excess_element_count, loc);
+    }
+};
+
+/**
+ * Construct a FixedFlatMap with its capacity being deduced from the number of key-value pairs
+ * being passed.
+ */
+template <typename K,
+          typename V,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY,
+          customize::MapChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedMapType = FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, SEARCH, CheckingType>>
+[[nodiscard]] constexpr FixedMapType make_fixed_flat_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    return {std::begin(list), std::end(list), comparator, loc};
+}
+template <typename K,
+          typename V,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY,
+          customize::MapChecking<K> CheckingType,
+          typename FixedMapType = FixedFlatMap<K, V, 0, Compare, SEARCH, CheckingType>>
+[[nodiscard]] constexpr FixedMapType make_fixed_flat_map(
+    const std::array<std::pair<K, V>, 0>& /*list*/,
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& /*loc*/ =
+        std_transition::source_location::current()) noexcept
+{
+    return FixedMapType{comparator};
+}
+
+template <typename K,
+          typename V,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY,
+          std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_flat_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>;
+    using FixedMapType = FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, SEARCH, CheckingType>;
+    return make_fixed_flat_map<K, V, Compare, SEARCH, CheckingType, MAXIMUM_SIZE, FixedMapType>(
+        list, comparator, loc);
+}
+template <typename K,
+          typename V,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY>
+[[nodiscard]] constexpr auto make_fixed_flat_map(
+    const std::array<std::pair<K, V>, 0>& list,
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::MapAbortChecking<K, V, 0>;
+    using FixedMapType = FixedFlatMap<K, V, 0, Compare, SEARCH, CheckingType>;
+    return make_fixed_flat_map<K, V, Compare, SEARCH, CheckingType, FixedMapType>(
+        list, comparator, loc);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          fixed_containers::fixed_flat_table_detail::FlatTableSearch SEARCH,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::FixedFlatMap<K, V, MAXIMUM_SIZE, Compare, SEARCH, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_flat_table.hpp"
+#include "fixed_containers/fixed_set_adapter.hpp"
+#include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/sorted_unique.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+
+namespace fixed_containers
+{
+
+// Same as `FixedFlatMap`, for sets. See `FixedFlatMap` for the trade-offs against `FixedSet`.
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY,
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+class FixedFlatSet
+  : public FixedSetAdapter<
+        K,
+        fixed_flat_table_detail::FixedFlatTable<K, EmptyValue, MAXIMUM_SIZE, Compare, SEARCH>,
+        CheckingType>
+{
+    using FSA = FixedSetAdapter<
+        K,
+        fixed_flat_table_detail::FixedFlatTable<K, EmptyValue, MAXIMUM_SIZE, Compare, SEARCH>,
+        CheckingType>;
+
+public:
+    using key_compare = Compare;
+    using value_compare = Compare;
+
+public:
+    constexpr FixedFlatSet() noexcept
+      : FixedFlatSet{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedFlatSet(const Compare& comparator) noexcept
+      : FSA{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedFlatSet(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatSet{comparator}
+    {
+        this->insert(first, last, loc);
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedFlatSet(
+        std_transition::sorted_unique_t /*tag*/,
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatSet{comparator}
+    {
+        this->insert(std_transition::sorted_unique, first, last, loc);
+    }
+
+    constexpr FixedFlatSet(
+        std::initializer_list<typename FixedFlatSet::value_type> list,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedFlatSet{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    // Same as `FixedFlatMap::from_unsorted()`, for keys
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedFlatSet from_unsorted(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return FixedFlatSet{first, last, comparator, loc};
+    }
+
+    [[nodiscard]] static constexpr FixedFlatSet from_unsorted(
+        std::initializer_list<typename FixedFlatSet::value_type> list,
+        const Compare& comparator = Compare{},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return FixedFlatSet{list.begin(), list.end(), comparator, loc};
+    }
+
+public:
+    using FSA::insert;
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        check_all_inserted(
+            this->IMPLEMENTATION_DETAIL_DO_NOT_USE_table_.insert_unsorted(first, last), last, loc);
+    }
+
+    // `[first, last)` must be sorted, with no two keys being equivalent
+    template <InputIterator InputIt>
+    constexpr void insert(std_transition::sorted_unique_t /*tag*/,
+                          InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        check_all_inserted(
+            this->IMPLEMENTATION_DETAIL_DO_NOT_USE_table_.insert_sorted_unique(first, last),
+            last,
+            loc);
+    }
+
+    constexpr void insert(std::initializer_list<typename FixedFlatSet::value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    [[nodiscard]] constexpr key_compare key_comp() const
+    {
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_table_.key_comp();
+    }
+    [[nodiscard]] constexpr value_compare value_comp() const { return key_comp(); }
+
+private:
+    template <InputIterator InputIt>
+    static constexpr void check_all_inserted(InputIt first_not_inserted,
+                                             InputIt last,
+                                             const std_transition::source_location& loc)
+    {
+        if (first_not_inserted == last)
+        {
+            return;
+        }
+
+        std::size_t excess_element_count = 0;
+        for (; first_not_inserted != last; ++first_not_inserted)
+        {
+            excess_element_count++;
+        }
+        CheckingType::length_error(MAXIMUM_SIZE + excess_element_count, loc);
+    }
+};
+
+/**
+ * Construct a FixedFlatSet with its capacity being deduced from the number of items being passed.
+ */
+template <typename K,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY,
+          customize::SetChecking<K> CheckingType,
+          std::size_t MAXIMUM_SIZE,
+          // Exposing this as a template parameter is useful for customization (for example with
+          // child classes that set the CheckingType)
+          typename FixedSetType = FixedFlatSet<K, MAXIMUM_SIZE, Compare, SEARCH, CheckingType>>
+[[nodiscard]] constexpr FixedSetType make_fixed_flat_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    return {std::begin(list), std::end(list), comparator, loc};
+}
+template <typename K,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY,
+          customize::SetChecking<K> CheckingType,
+          typename FixedSetType = FixedFlatSet<K, 0, Compare, SEARCH, CheckingType>>
+[[nodiscard]] constexpr FixedSetType make_fixed_flat_set(
+    const std::array<K, 0>& /*list*/,
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& /*loc*/ =
+        std_transition::source_location::current()) noexcept
+{
+    return FixedSetType{comparator};
+}
+
+template <typename K,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY,
+          std::size_t MAXIMUM_SIZE>
+[[nodiscard]] constexpr auto make_fixed_flat_set(
+    const K (&list)[MAXIMUM_SIZE],
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>;
+    using FixedSetType = FixedFlatSet<K, MAXIMUM_SIZE, Compare, SEARCH, CheckingType>;
+    return make_fixed_flat_set<K, Compare, SEARCH, CheckingType, MAXIMUM_SIZE, FixedSetType>(
+        list, comparator, loc);
+}
+template <typename K,
+          typename Compare = std::less<K>,
+          fixed_flat_table_detail::FlatTableSearch SEARCH =
+              fixed_flat_table_detail::FlatTableSearch::BINARY>
+[[nodiscard]] constexpr auto make_fixed_flat_set(
+    const std::array<K, 0>& list,
+    const Compare& comparator = Compare{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::SetAbortChecking<K, 0>;
+    using FixedSetType = FixedFlatSet<K, 0, Compare, SEARCH, CheckingType>;
+    return make_fixed_flat_set<K, Compare, SEARCH, CheckingType, FixedSetType>(
+        list, comparator, loc);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          fixed_containers::fixed_flat_table_detail::FlatTableSearch SEARCH,
+          fixed_containers::customize::SetChecking<K> CheckingType>
+struct tuple_size<fixed_containers::FixedFlatSet<K, MAXIMUM_SIZE, Compare, SEARCH, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
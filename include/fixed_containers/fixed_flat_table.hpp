@@ -0,0 +1,660 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/memory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// A sorted array of keys, with the values in a parallel array. Lookups binary-search the keys
+// alone, so every probe lands on a key instead of on a (key, value) pair, and iteration is a linear
+// scan over plain array indices, which makes iterators random-access. In exchange, insertions and
+// erasures shift every entry after the affected one, which makes them O(N). This is the layout to
+// pick for maps that are built once and then mostly read.
+//
+// The binary search is branchless: each step is a conditional move instead of a hard-to-predict
+// branch. For large tables, the search can instead use a copy of the keys in Eytzinger (BFS) order,
+// where the keys compared in the first few steps of every search share a handful of cache lines
+// and the next levels can be prefetched. The copy is rebuilt after every mutation.
+//
+// Good resources:
+// 1) Khuong, Morin: "Array Layouts for Comparison-Based Searching"
+//    https://arxiv.org/abs/1509.05053
+// 2) https://algorithmica.org/en/eytzinger
+
+namespace fixed_containers::fixed_flat_table_detail
+{
+enum class FlatTableSearch : bool
+{
+    // Branchless binary search over the sorted keys
+    BINARY,
+    // Branchless search over a copy of the keys in Eytzinger order. Costs another copy of the keys.
+    EYTZINGER,
+};
+
+// The keys laid out as an implicit binary search tree: the children of the node at 1-based index
+// `k` are at `2k` and `2k + 1`. `ranks[k - 1]` is the index of `keys[k - 1]` in the sorted array.
+template <typename K, std::size_t CAPACITY>
+struct EytzingerIndex
+{
+    FixedVector<K, CAPACITY> keys;
+    std::array<std::uint32_t, CAPACITY> ranks;
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          FlatTableSearch SEARCH = FlatTableSearch::BINARY>
+class FixedFlatTable
+{
+    static_assert(std::is_move_constructible_v<K> && std::is_move_assignable_v<K> &&
+                      std::is_move_constructible_v<V> && std::is_move_assignable_v<V>,
+                  "Entries are moved around when other entries are inserted or erased");
+    static_assert(SEARCH != FlatTableSearch::EYTZINGER || std::is_copy_constructible_v<K>,
+                  "The Eytzinger index holds copies of the keys");
+    static_assert(MAXIMUM_SIZE < (std::numeric_limits<std::uint32_t>::max)());
+
+public:
+    using KeyType = K;
+    using ValueType = V;
+    using KeyCompareType = Compare;
+    static constexpr bool HAS_ASSOCIATED_VALUE = IsNotEmpty<V>;
+    static constexpr bool HAS_TRANSPARENT_LOOKUP = IsTransparent<Compare>;
+    static constexpr bool HAS_EYTZINGER_INDEX = SEARCH == FlatTableSearch::EYTZINGER;
+
+    static constexpr std::size_t CAPACITY = MAXIMUM_SIZE;
+
+    struct OpaqueIndexType
+    {
+        // Where the key is, or where it would be inserted if it is not in the table
+        std::size_t index;
+        bool found;
+    };
+
+    using OpaqueIteratedType = std::size_t;
+
+private:
+    // Insertion sort is faster than merging for short runs
+    static constexpr std::size_t SORT_RUN_LENGTH = 16;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<K, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    FixedVector<V, HAS_ASSOCIATED_VALUE ? MAXIMUM_SIZE : 0>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    EytzingerIndex<K, HAS_EYTZINGER_INDEX ? MAXIMUM_SIZE : 0>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_eytzinger_index_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedFlatTable() noexcept
+      : FixedFlatTable(Compare{})
+    {
+    }
+
+    explicit constexpr FixedFlatTable(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_eytzinger_index_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t size() const { return keys().size(); }
+    [[nodiscard]] constexpr const Compare& key_comp() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType begin_index() const { return 0; }
+
+    static constexpr OpaqueIteratedType invalid_index()
+    {
+        return (std::numeric_limits<std::size_t>::max)();
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType end_index() const { return size(); }
+
+    [[nodiscard]] constexpr OpaqueIteratedType next_of(const OpaqueIteratedType& index) const
+    {
+        return index + 1;
+    }
+
+    // Stepping back from the first entry wraps around to `invalid_index()`, which is one before it
+    // as far as `distance()` is concerned. Reverse iterators rely on this for their end.
+    [[nodiscard]] constexpr OpaqueIteratedType prev_of(const OpaqueIteratedType& index) const
+    {
+        return index - 1;
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType next_of(const OpaqueIteratedType& index,
+                                                       std::size_t n) const
+    {
+        return index + n;
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType prev_of(const OpaqueIteratedType& index,
+                                                       std::size_t n) const
+    {
+        return index - n;
+    }
+
+    [[nodiscard]] constexpr std::ptrdiff_t distance(const OpaqueIteratedType& from,
+                                                    const OpaqueIteratedType& to) const
+    {
+        return static_cast<std::ptrdiff_t>(to - from);
+    }
+
+    [[nodiscard]] constexpr const K& key_at(const OpaqueIteratedType& index) const
+    {
+        return keys().cbegin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    [[nodiscard]] constexpr const V& value_at(const OpaqueIteratedType& index) const
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return values().cbegin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    constexpr V& value_at(const OpaqueIteratedType& index)
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return values().begin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType iterated_index_from(
+        const OpaqueIndexType& index) const
+    {
+        return index.index;
+    }
+
+    // `Key` is either `K`, or any type that the (transparent) `Compare` accepts.
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const Key& key) const
+    {
+        const std::size_t index =
+            search([&](const K& entry_key) { return compare(entry_key, key); });
+        return {index, index < size() && !compare(key, key_at(index))};
+    }
+
+    [[nodiscard]] constexpr bool exists(const OpaqueIndexType& index) const { return index.found; }
+
+    [[nodiscard]] constexpr const V& value(const OpaqueIndexType& index) const
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return value_at(index.index);
+    }
+
+    constexpr V& value(const OpaqueIndexType& index)
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return value_at(index.index);
+    }
+
+    // First entry whose key is not less than `key`
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIteratedType lower_bound_index(const Key& key) const
+    {
+        return search([&](const K& entry_key) { return compare(entry_key, key); });
+    }
+
+    // First entry whose key is greater than `key`
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIteratedType upper_bound_index(const Key& key) const
+    {
+        return search([&](const K& entry_key) { return !compare(key, entry_key); });
+    }
+
+    template <typename KeyArg, typename... Args>
+    constexpr OpaqueIndexType emplace(const OpaqueIndexType& index,
+                                      KeyArg&& key,
+                                      Args&&... args)
+    {
+        assert_or_abort(!index.found);
+        const auto offset = static_cast<std::ptrdiff_t>(index.index);
+        keys().emplace(std::next(keys().cbegin(), offset), std::forward<KeyArg>(key));
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            values().emplace(std::next(values().cbegin(), offset), std::forward<Args>(args)...);
+        }
+        rebuild_eytzinger_index();
+        return {index.index, true};
+    }
+
+    constexpr OpaqueIteratedType erase(const OpaqueIndexType& index)
+    {
+        assert_or_abort(index.found);
+        return erase_range(index.index, index.index + 1);
+    }
+
+    constexpr OpaqueIteratedType erase_range(const OpaqueIteratedType& start_index,
+                                             const OpaqueIteratedType& end_index)
+    {
+        const std::size_t first = (std::min)(start_index, size());
+        erase_entries(first, (std::min)(end_index, size()));
+        rebuild_eytzinger_index();
+        // The entries after the erased ones were shifted into their place
+        return first;
+    }
+
+    constexpr void clear()
+    {
+        keys().clear();
+        values().clear();
+        eytzinger_index().keys.clear();
+    }
+
+    // Inserts the entries (keys for sets, pairs for maps) of [first, last) whose keys are not in
+    // the table yet. Of entries with equivalent keys, the first one wins. The entries are appended
+    // unsorted, then sorted and merged into the table in one go. The merges are done in place with
+    // rotations, so this takes O(N log N) comparisons and O(N log^2 N) moves, instead of the
+    // O(N^2) moves of inserting the entries one by one.
+    // Returns the first entry that did not fit, or `last` if all of them did. The entries before
+    // it are inserted either way.
+    template <InputIterator InputIt>
+    constexpr InputIt insert_unsorted(InputIt first, InputIt last)
+    {
+        return insert_range<false>(first, last);
+    }
+
+    // Same as above, for entries that are sorted by key with no two keys being equivalent.
+    template <InputIterator InputIt>
+    constexpr InputIt insert_sorted_unique(InputIt first, InputIt last)
+    {
+        return insert_range<true>(first, last);
+    }
+
+private:
+    constexpr auto& keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    [[nodiscard]] constexpr const auto& keys() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+    constexpr auto& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+    [[nodiscard]] constexpr const auto& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr auto& eytzinger_index() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_eytzinger_index_; }
+    [[nodiscard]] constexpr const auto& eytzinger_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_eytzinger_index_;
+    }
+
+    template <typename K1, typename K2>
+    [[nodiscard]] constexpr bool compare(const K1& lhs, const K2& rhs) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(lhs, rhs);
+    }
+
+    constexpr K& mutable_key_at(std::size_t index)
+    {
+        return keys().begin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    // Index of the first key in [0, size()) for which `predicate` is false. The keys for which it
+    // holds must all come before the keys for which it does not.
+    template <typename Predicate>
+    [[nodiscard]] constexpr std::size_t search(Predicate predicate) const
+    {
+        if constexpr (HAS_EYTZINGER_INDEX)
+        {
+            return eytzinger_partition_point(predicate);
+        }
+        else
+        {
+            return partition_point(0, size(), predicate);
+        }
+    }
+
+    // Same as above, in [first, first + count) of the sorted keys
+    template <typename Predicate>
+    [[nodiscard]] constexpr std::size_t partition_point(std::size_t first,
+                                                        std::size_t count,
+                                                        Predicate predicate) const
+    {
+        if (count == 0)
+        {
+            return first;
+        }
+        const auto keys_it = keys().cbegin();
+        std::size_t base = first;
+        while (count > 1)
+        {
+            const std::size_t half = count / 2;
+            // Compiles to a conditional move. The outcome is a coin flip, so a branch would be
+            // mispredicted half of the time.
+            const bool go_right = predicate(keys_it[static_cast<std::ptrdiff_t>(base + half)]);
+            base = go_right ? base + half : base;
+            count -= half;
+        }
+        const bool go_right = predicate(keys_it[static_cast<std::ptrdiff_t>(base)]);
+        return base + static_cast<std::size_t>(go_right);
+    }
+
+    template <typename Predicate>
+    [[nodiscard]] constexpr std::size_t eytzinger_partition_point(Predicate predicate) const
+    {
+        const std::size_t count = size();
+        const auto keys_it = eytzinger_index().keys.cbegin();
+        std::size_t node = 1;
+        while (node <= count)
+        {
+            // The descendants 4 levels down are contiguous, and for small keys share a cache line
+            if (16 * node <= count)
+            {
+                memory::prefetch_for_read(keys_it[static_cast<std::ptrdiff_t>(16 * node - 1)]);
+            }
+            const bool go_right = predicate(keys_it[static_cast<std::ptrdiff_t>(node - 1)]);
+            node = (2 * node) + static_cast<std::size_t>(go_right);
+        }
+        // The answer is the last node where the search went left. The search went right at every
+        // node after it, which appended one set bit each to `node`, after the 0 bit of going left.
+        node >>= std::countr_one(node) + 1;
+        return node == 0 ? count : eytzinger_index().ranks[node - 1];
+    }
+
+    constexpr void rebuild_eytzinger_index()
+    {
+        if constexpr (HAS_EYTZINGER_INDEX)
+        {
+            auto& index = eytzinger_index();
+            const std::size_t count = size();
+
+            // In-order traversal of the implicit tree, which visits the nodes in sorted order.
+            // Start from the leftmost node.
+            std::size_t node = 1;
+            while (2 * node <= count)
+            {
+                node *= 2;
+            }
+            for (std::size_t rank = 0; rank < count; rank++)
+            {
+                index.ranks[node - 1] = static_cast<std::uint32_t>(rank);
+                if (2 * node + 1 <= count)
+                {
+                    // Leftmost node of the right subtree
+                    node = 2 * node + 1;
+                    while (2 * node <= count)
+                    {
+                        node *= 2;
+                    }
+                }
+                else
+                {
+                    // Climb up out of right children, then once more to the parent
+                    node >>= std::countr_one(node) + 1;
+                }
+            }
+
+            index.keys.clear();
+            for (std::size_t node_index = 0; node_index < count; node_index++)
+            {
+                index.keys.push_back(key_at(index.ranks[node_index]));
+            }
+        }
+    }
+
+    template <bool IS_SORTED_UNIQUE, typename InputIt>
+    constexpr InputIt insert_range(InputIt first, InputIt last)
+    {
+        std::size_t sorted_count = size();
+        for (; first != last; ++first)
+        {
+            if (size() == CAPACITY)
+            {
+                // Merging drops the duplicates among the appended entries, which may free up room
+                merge_appended_entries<IS_SORTED_UNIQUE>(sorted_count);
+                sorted_count = size();
+                if (size() == CAPACITY)
+                {
+                    const std::size_t index = partition_point(
+                        0,
+                        size(),
+                        [&](const K& entry_key) { return compare(entry_key, key_of(*first)); });
+                    if (index < size() && !compare(key_of(*first), key_at(index)))
+                    {
+                        continue;
+                    }
+                    rebuild_eytzinger_index();
+                    return first;
+                }
+            }
+
+            if constexpr (IS_SORTED_UNIQUE)
+            {
+                assert_or_abort(size() == sorted_count ||
+                                compare(key_at(size() - 1), key_of(*first)));
+            }
+            append_entry(*first);
+        }
+
+        merge_appended_entries<IS_SORTED_UNIQUE>(sorted_count);
+        rebuild_eytzinger_index();
+        return last;
+    }
+
+    template <typename Entry>
+    static constexpr const K& key_of(const Entry& entry)
+    {
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            return entry.first;
+        }
+        else
+        {
+            return entry;
+        }
+    }
+
+    template <typename Entry>
+    constexpr void append_entry(Entry&& entry)
+    {
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            keys().emplace_back(std::forward<Entry>(entry).first);
+            values().emplace_back(std::forward<Entry>(entry).second);
+        }
+        else
+        {
+            keys().emplace_back(std::forward<Entry>(entry));
+        }
+    }
+
+    // Turns [0, sorted_count) (sorted) followed by [sorted_count, size()) (appended in any order)
+    // into a single sorted run without duplicates, keeping the first of equivalent entries.
+    template <bool IS_SORTED_UNIQUE>
+    constexpr void merge_appended_entries(const std::size_t sorted_count)
+    {
+        const std::size_t count = size();
+        if (sorted_count == count)
+        {
+            return;
+        }
+
+        if constexpr (!IS_SORTED_UNIQUE)
+        {
+            sort_entries(sorted_count, count);
+        }
+
+        // Drop the appended entries that are already in the table, or that are equivalent to an
+        // earlier appended entry. The appended entries are sorted now, so the positions where they
+        // would go in the table only move forward.
+        std::size_t kept_count = sorted_count;
+        std::size_t position = 0;
+        for (std::size_t i = sorted_count; i < count; i++)
+        {
+            const K& key = key_at(i);
+            if (kept_count > sorted_count && !compare(key_at(kept_count - 1), key))
+            {
+                continue;
+            }
+            position = partition_point(position,
+                                       sorted_count - position,
+                                       [&](const K& entry_key) { return compare(entry_key, key); });
+            if (position < sorted_count && !compare(key, key_at(position)))
+            {
+                continue;
+            }
+            if (i != kept_count)
+            {
+                move_entry(i, kept_count);
+            }
+            kept_count++;
+        }
+        erase_entries(kept_count, count);
+
+        merge_entries(0, sorted_count, size());
+    }
+
+    constexpr void erase_entries(std::size_t first, std::size_t last)
+    {
+        const auto erase = [&](auto& vector)
+        {
+            vector.erase(std::next(vector.cbegin(), static_cast<std::ptrdiff_t>(first)),
+                         std::next(vector.cbegin(), static_cast<std::ptrdiff_t>(last)));
+        };
+        erase(keys());
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            erase(values());
+        }
+    }
+
+    constexpr void move_entry(std::size_t from, std::size_t to)
+    {
+        mutable_key_at(to) = std::move(mutable_key_at(from));
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            value_at(to) = std::move(value_at(from));
+        }
+    }
+
+    constexpr void swap_entries(std::size_t lhs, std::size_t rhs)
+    {
+        std::iter_swap(std::next(keys().begin(), static_cast<std::ptrdiff_t>(lhs)),
+                       std::next(keys().begin(), static_cast<std::ptrdiff_t>(rhs)));
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            std::iter_swap(std::next(values().begin(), static_cast<std::ptrdiff_t>(lhs)),
+                           std::next(values().begin(), static_cast<std::ptrdiff_t>(rhs)));
+        }
+    }
+
+    constexpr void rotate_entries(std::size_t first, std::size_t middle, std::size_t last)
+    {
+        const auto rotate = [&](auto begin)
+        {
+            std::rotate(std::next(begin, static_cast<std::ptrdiff_t>(first)),
+                        std::next(begin, static_cast<std::ptrdiff_t>(middle)),
+                        std::next(begin, static_cast<std::ptrdiff_t>(last)));
+        };
+        rotate(keys().begin());
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            rotate(values().begin());
+        }
+    }
+
+    // Stable sort of [first, last). There is no spare room for a merge buffer, so runs are merged
+    // in place with rotations.
+    constexpr void sort_entries(std::size_t first, std::size_t last)
+    {
+        for (std::size_t run = first; run < last; run += SORT_RUN_LENGTH)
+        {
+            const std::size_t run_end = (std::min)(run + SORT_RUN_LENGTH, last);
+            for (std::size_t i = run + 1; i < run_end; i++)
+            {
+                for (std::size_t j = i; j > run && compare(key_at(j), key_at(j - 1)); j--)
+                {
+                    swap_entries(j, j - 1);
+                }
+            }
+        }
+
+        for (std::size_t width = SORT_RUN_LENGTH; width < last - first; width *= 2)
+        {
+            for (std::size_t run = first; run + width < last; run += 2 * width)
+            {
+                merge_entries(run, run + width, (std::min)(run + 2 * width, last));
+            }
+        }
+    }
+
+    // Stable in-place merge of the sorted runs [first, middle) and [middle, last). This is the
+    // SymMerge algorithm, which recurses O(log(N)) deep.
+    // Kim, Kutzner: "Stable Minimum Storage Merging by Symmetric Comparisons"
+    constexpr void merge_entries(std::size_t first, std::size_t middle, std::size_t last)
+    {
+        if (first == middle || middle == last)
+        {
+            return;
+        }
+
+        if (middle - first == 1)
+        {
+            // Move the single entry of the left run after the entries less than it
+            const std::size_t position = partition_point(
+                middle,
+                last - middle,
+                [&](const K& entry_key) { return compare(entry_key, key_at(first)); });
+            rotate_entries(first, middle, position);
+            return;
+        }
+        if (last - middle == 1)
+        {
+            // Move the single entry of the right run before the entries greater than it
+            const std::size_t position = partition_point(
+                first,
+                middle - first,
+                [&](const K& entry_key) { return !compare(key_at(middle), entry_key); });
+            rotate_entries(position, middle, last);
+            return;
+        }
+
+        const std::size_t mid = first + ((last - first) / 2);
+        const std::size_t n = mid + middle;
+        std::size_t start = middle > mid ? n - last : first;
+        std::size_t end = middle > mid ? mid : middle;
+        const std::size_t pivot = n - 1;
+        while (start < end)
+        {
+            const std::size_t c = start + ((end - start) / 2);
+            if (!compare(key_at(pivot - c), key_at(c)))
+            {
+                start = c + 1;
+            }
+            else
+            {
+                end = c;
+            }
+        }
+
+        end = n - start;
+        if (start < middle && middle < end)
+        {
+            rotate_entries(start, middle, end);
+        }
+        if (first < start && start < mid)
+        {
+            merge_entries(first, start, mid);
+        }
+        if (mid < end && end < last)
+        {
+            merge_entries(mid, end, last);
+        }
+    }
+};
+
+}  // namespace fixed_containers::fixed_flat_table_detail
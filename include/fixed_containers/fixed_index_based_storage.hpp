@@ -77,6 +77,37 @@ public:
         return index;
     }
 
+    // Moves the stored values into the slots [0, count), where `count` is the number of stored
+    // values, and resets the freelist so that the other slots are handed out in ascending order.
+    // Each free slot before `count` is filled with the value at `next_index_to_move()`, which must
+    // return the stored values past `count` one at a time, and `on_moved(from, to)` is called right
+    // after, so that references to the value can be updated.
+    template <class NextIndexToMove, class OnMoved>
+    constexpr void make_contiguous(const std::size_t count,
+                                   NextIndexToMove&& next_index_to_move,
+                                   OnMoved&& on_moved)
+    {
+        std::size_t free_index = next_index();
+        while (free_index != MAXIMUM_SIZE)
+        {
+            const std::size_t next_free_index = array_unchecked_at(free_index).index;
+            if (free_index < count)
+            {
+                const std::size_t index_to_move = next_index_to_move();
+                emplace_at(free_index, std::move(at(index_to_move)));
+                destroy_at(index_to_move);
+                on_moved(index_to_move, free_index);
+            }
+            free_index = next_free_index;
+        }
+
+        for (std::size_t i = count; i < MAXIMUM_SIZE; i++)
+        {
+            array_unchecked_at(i).index = i + 1;
+        }
+        set_next_index(count);
+    }
+
     // Set the freelist of `this` to match the freelist of `other`. This only makes sense if
     // you will emplace valid values in the "full" spots (The ones not touched by this function). It
     // explicitly makes _no guarantees_ about the contents of "full" slots in the destination.
@@ -192,6 +223,14 @@ public:
         return nodes().size();
     }
 
+    // Values are always contiguous and there is no freelist, so there is nothing to move.
+    template <class NextIndexToMove, class OnMoved>
+    constexpr void make_contiguous(const std::size_t /*count*/,
+                                   NextIndexToMove&& /*next_index_to_move*/,
+                                   OnMoved&& /*on_moved*/)
+    {
+    }
+
 private:
     [[nodiscard]] constexpr const FixedVector<T, MAXIMUM_SIZE>& nodes() const
     {
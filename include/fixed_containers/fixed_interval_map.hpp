@@ -0,0 +1,32 @@
+#pragma once
+
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/fixed_red_black_tree_nodes.hpp"
+#include "fixed_containers/interval.hpp"
+#include "fixed_containers/map_checking.hpp"
+
+#include <cstddef>
+
+namespace fixed_containers
+{
+// A `FixedMap` keyed by half-open intervals, e.g. `Interval<T>`, that additionally answers "which
+// intervals contain this point" (`for_each_containing()`) and "which intervals overlap this one"
+// (`for_each_overlapping()`) without visiting the intervals that do not. Every node also stores the
+// greatest `high` endpoint of its subtree, which is kept up to date through rotations. Intervals
+// are ordered by `low` then `high`, so equal intervals map to a single entry.
+template <IsInterval K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+using FixedIntervalMap =
+    FixedMap<K,
+             V,
+             MAXIMUM_SIZE,
+             IntervalLowThenHighLess,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedPoolStorage,
+             CheckingType,
+             fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT>;
+
+}  // namespace fixed_containers
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_red_black_tree_nodes.hpp"
+#include "fixed_containers/fixed_set.hpp"
+#include "fixed_containers/interval.hpp"
+#include "fixed_containers/set_checking.hpp"
+
+#include <cstddef>
+
+namespace fixed_containers
+{
+// A `FixedSet` of half-open intervals with the queries of `FixedIntervalMap`.
+template <IsInterval K,
+          std::size_t MAXIMUM_SIZE,
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+using FixedIntervalSet =
+    FixedSet<K,
+             MAXIMUM_SIZE,
+             IntervalLowThenHighLess,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedPoolStorage,
+             CheckingType,
+             fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT>;
+
+}  // namespace fixed_containers
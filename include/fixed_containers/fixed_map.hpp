@@ -8,12 +8,16 @@
 #include "fixed_containers/fixed_red_black_tree.hpp"
 #include "fixed_containers/map_checking.hpp"
 #include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/set_operations.hpp"
+#include "fixed_containers/sorted_unique.hpp"
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <iterator>
+#include <memory>
 
 namespace fixed_containers
 {
@@ -36,7 +40,9 @@ template <class K,
                              here. clang accepts it */
                     ,
                     std::size_t> typename StorageTemplate = FixedIndexBasedPoolStorage,
-          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION =
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::NONE>
 class FixedMap
 {
 public:
@@ -47,13 +53,14 @@ public:
     using const_reference = std::pair<const K&, const V&>;
     using pointer = std::add_pointer_t<reference>;
     using const_pointer = std::add_pointer_t<const_reference>;
+    using key_compare = Compare;
 
 private:
     using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
     using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
     static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
     using Tree = fixed_red_black_tree_detail::
-        FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+        FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, AUGMENTATION>;
 
     template <bool IS_CONST>
     class PairProvider
@@ -184,6 +191,18 @@ public:
         insert(first, last, loc);
     }
 
+    template <InputIterator InputIt>
+    constexpr FixedMap(
+        std_transition::sorted_unique_t /*tag*/,
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedMap{comparator}
+    {
+        insert(std_transition::sorted_unique, first, last, loc);
+    }
+
     constexpr FixedMap(std::initializer_list<value_type> list,
                        const Compare& comparator = {},
                        const std_transition::source_location& loc =
@@ -309,8 +328,51 @@ public:
     [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
 
+    [[nodiscard]] constexpr key_compare key_comp() const { return tree().key_comp(); }
+
+    // Moves the entries of `source` whose keys are not in this map over, like std::map::merge().
+    // Both maps are walked in order and every entry is inserted next to its successor, so nothing
+    // is searched for from the root. The keys are copied, as `source` only hands out const
+    // references to them, and the mapped values are moved.
+    template <class OtherFixedMap>
+        requires set_operations_detail::SupportsSetOperations<FixedMap, OtherFixedMap>
+    constexpr void merge(OtherFixedMap& source,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current())
+    {
+        if (static_cast<const void*>(this) == static_cast<const void*>(std::addressof(source)))
+        {
+            return;
+        }
+
+        const key_compare& comparator = tree().key_comp();
+        const_iterator hint = cbegin();
+        for (auto it = source.begin(); it != source.end();)
+        {
+            while (hint != cend() && comparator(hint->first, it->first))
+            {
+                ++hint;
+            }
+            if (hint != cend() && !comparator(it->first, hint->first))
+            {
+                ++it;
+                continue;
+            }
+            NodeIndexAndParentIndex np_idxs =
+                tree().index_of_node_with_parent_near(index_of_hint(hint), it->first);
+            check_not_full(loc);
+            tree().insert_new_at(np_idxs, it->first, std::move(it->second));
+            it = source.erase(it);
+        }
+    }
+
     constexpr void clear() noexcept { tree().clear(); }
 
+    // Moves the entries around so that they are laid out in memory in iteration order, which turns
+    // iteration and range scans into sequential reads once churn has scattered them. This is O(N)
+    // and invalidates all iterators and references.
+    constexpr void compact() { tree().compact(); }
+
     constexpr std::pair<iterator, bool> insert(
         const value_type& value,
         const std_transition::source_location& loc =
@@ -342,6 +404,39 @@ public:
         return {create_iterator(np_idxs.i), true};
     }
 
+    constexpr iterator insert(const_iterator hint,
+                              const value_type& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), value.first);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, value.first, value.second);
+        return create_iterator(np_idxs.i);
+    }
+    constexpr iterator insert(const_iterator hint,
+                              value_type&& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), value.first);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, value.first, std::move(value.second));
+        return create_iterator(np_idxs.i);
+    }
+
     template <InputIterator Input>
     constexpr void insert(Input first,
                           Input last,
@@ -353,6 +448,44 @@ public:
             this->insert(*first, loc);
         }
     }
+    // The range must be sorted by key with no equivalent keys. When the map is empty and the range
+    // is multi-pass, the tree is built directly in O(N) without comparing any keys.
+    template <InputIterator InputIt>
+    constexpr void insert(std_transition::sorted_unique_t /*tag*/,
+                          InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            if (empty())
+            {
+                const auto count = static_cast<std::size_t>(std::distance(first, last));
+                if (preconditions::test(count <= MAXIMUM_SIZE))
+                {
+                    CheckingType::length_error(count, loc);
+                }
+                tree().build_from_sorted_unique(
+                    count,
+                    [&first](auto& tree_storage)
+                    {
+                        auto&& entry = *first;
+                        std::advance(first, 1);
+                        return tree_storage.emplace_and_return_index(
+                            entry.first, std::forward<decltype(entry)>(entry).second);
+                    });
+                return;
+            }
+        }
+
+        // Each entry goes right before the successor of the previous one, or at the end
+        const_iterator hint = cend();
+        for (; first != last; std::advance(first, 1))
+        {
+            hint = std::next(const_iterator{this->insert(hint, *first, loc)});
+        }
+    }
     constexpr void insert(std::initializer_list<value_type> list,
                           const std_transition::source_location& loc =
                               std_transition::source_location::current()) noexcept
@@ -399,24 +532,44 @@ public:
         return {create_iterator(np_idxs.i), true};
     }
     template <class M>
-    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+    constexpr iterator insert_or_assign(const_iterator hint,
                                         const K& key,
                                         M&& obj,
                                         const std_transition::source_location& loc =
                                             std_transition::source_location::current()) noexcept
         requires std::is_assignable_v<mapped_type&, M&&>
     {
-        return insert_or_assign(key, std::forward<M>(obj), loc).first;
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            tree().node_at(np_idxs.i).value() = std::forward<M>(obj);
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, key, std::forward<M>(obj));
+        return create_iterator(np_idxs.i);
     }
     template <class M>
-    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+    constexpr iterator insert_or_assign(const_iterator hint,
                                         K&& key,
                                         M&& obj,
                                         const std_transition::source_location& loc =
                                             std_transition::source_location::current()) noexcept
         requires std::is_assignable_v<mapped_type&, M&&>
     {
-        return insert_or_assign(std::move(key), std::forward<M>(obj), loc).first;
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            tree().node_at(np_idxs.i).value() = std::forward<M>(obj);
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(key), std::forward<M>(obj));
+        return create_iterator(np_idxs.i);
     }
 
     template <class... Args>
@@ -446,18 +599,36 @@ public:
         return {create_iterator(np_idxs.i), true};
     }
     template <class... Args>
-    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator hint,
                                                     const K& key,
                                                     Args&&... args) noexcept
     {
-        return try_emplace(key, std::forward<Args>(args)...);
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return {create_iterator(np_idxs.i), false};
+        }
+
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np_idxs, key, std::forward<Args>(args)...);
+        return {create_iterator(np_idxs.i), true};
     }
     template <class... Args>
-    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator hint,
                                                     K&& key,
                                                     Args&&... args) noexcept
     {
-        return try_emplace(std::move(key), std::forward<Args>(args)...);
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return {create_iterator(np_idxs.i), false};
+        }
+
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np_idxs, std::move(key), std::forward<Args>(args)...);
+        return {create_iterator(np_idxs.i), true};
     }
 
     template <class... Args>
@@ -468,10 +639,11 @@ public:
                                                                     std::forward<Args>(args)...);
     }
     template <class... Args>
-    constexpr std::pair<iterator, bool> emplace_hint(const_iterator /*hint*/,
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator hint,
                                                      Args&&... args) noexcept
     {
-        return emplace(std::forward<Args>(args)...);
+        return emplace_detail::emplace_hint_in_terms_of_try_emplace_impl(
+            *this, hint, std::forward<Args>(args)...);
     }
 
     constexpr iterator erase(const_iterator pos) noexcept
@@ -643,6 +815,85 @@ public:
         return equal_range_impl(np_idxs);
     }
 
+    // Order statistics, available when the nodes are augmented with
+    // `RedBlackTreeNodeAugmentation::SUBTREE_SIZE`. These are all O(log N).
+
+    // Returns the entry with `n` entries before it, or end() if `n >= size()`.
+    [[nodiscard]] constexpr iterator nth(const size_type n) noexcept
+        requires Tree::HAS_SUBTREE_SIZE
+    {
+        return create_iterator(tree().index_of_nth(n));
+    }
+    [[nodiscard]] constexpr const_iterator nth(const size_type n) const noexcept
+        requires Tree::HAS_SUBTREE_SIZE
+    {
+        return create_const_iterator(tree().index_of_nth(n));
+    }
+
+    // Returns the number of entries with a key less than `key`, i.e. the position of
+    // `lower_bound(key)`.
+    [[nodiscard]] constexpr size_type rank(const K& key) const noexcept
+        requires Tree::HAS_SUBTREE_SIZE
+    {
+        return tree().rank_of(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr size_type rank(const K0& key) const noexcept
+        requires IsTransparent<Compare> && Tree::HAS_SUBTREE_SIZE
+    {
+        return tree().rank_of(key);
+    }
+
+    // Returns the number of entries with a key in [low, high).
+    [[nodiscard]] constexpr size_type count_range(const K& low, const K& high) const noexcept
+        requires Tree::HAS_SUBTREE_SIZE
+    {
+        return count_range_impl(low, high);
+    }
+    template <class K0, class K1>
+    [[nodiscard]] constexpr size_type count_range(const K0& low, const K1& high) const noexcept
+        requires IsTransparent<Compare> && Tree::HAS_SUBTREE_SIZE
+    {
+        return count_range_impl(low, high);
+    }
+
+    // Interval queries, available when the nodes are augmented with
+    // `RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT`, see `FixedIntervalMap`. `fn` is called
+    // with an iterator to every matching entry, in order, and must not insert or erase entries.
+    // Every match is found in O(log N).
+
+    // Calls `fn` for every entry whose key contains `point`.
+    template <class P, class Fn>
+    constexpr void for_each_containing(const P& point, Fn&& fn)
+        requires Tree::HAS_MAX_HIGH_ENDPOINT
+    {
+        tree().for_each_index_containing(
+            point, [this, &fn](const NodeIndex& index) { fn(create_iterator(index)); });
+    }
+    template <class P, class Fn>
+    constexpr void for_each_containing(const P& point, Fn&& fn) const
+        requires Tree::HAS_MAX_HIGH_ENDPOINT
+    {
+        tree().for_each_index_containing(
+            point, [this, &fn](const NodeIndex& index) { fn(create_const_iterator(index)); });
+    }
+
+    // Calls `fn` for every entry whose key overlaps `interval`.
+    template <class Fn>
+    constexpr void for_each_overlapping(const K& interval, Fn&& fn)
+        requires Tree::HAS_MAX_HIGH_ENDPOINT
+    {
+        tree().for_each_index_overlapping(
+            interval, [this, &fn](const NodeIndex& index) { fn(create_iterator(index)); });
+    }
+    template <class Fn>
+    constexpr void for_each_overlapping(const K& interval, Fn&& fn) const
+        requires Tree::HAS_MAX_HIGH_ENDPOINT
+    {
+        tree().for_each_index_overlapping(
+            interval, [this, &fn](const NodeIndex& index) { fn(create_const_iterator(index)); });
+    }
+
     template <std::size_t MAXIMUM_SIZE_2,
               class Compare2,
               fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
@@ -650,14 +901,16 @@ public:
                                  constraints here. clang accepts it */
                         ,
                         std::size_t> typename StorageTemplate2,
-              customize::MapChecking<K> CheckingType2>
+              customize::MapChecking<K> CheckingType2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION_2>
     [[nodiscard]] constexpr bool operator==(const FixedMap<K,
                                                            V,
                                                            MAXIMUM_SIZE_2,
                                                            Compare2,
                                                            COMPACTNESS_2,
                                                            StorageTemplate2,
-                                                           CheckingType2>& other) const
+                                                           CheckingType2,
+                                                           AUGMENTATION_2>& other) const
     {
         if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
         {
@@ -730,6 +983,19 @@ private:
     {
         return pos.template private_reference_provider<PairProvider<true>>().current_index();
     }
+
+    [[nodiscard]] constexpr NodeIndex index_of_hint(const_iterator hint)
+    {
+        return hint == cend() ? NULL_INDEX : get_node_index_from_iterator(hint);
+    }
+
+    template <class K0, class K1>
+    [[nodiscard]] constexpr size_type count_range_impl(const K0& low, const K1& high) const noexcept
+    {
+        const size_type low_rank = tree().rank_of(low);
+        const size_type high_rank = tree().rank_of(high);
+        return high_rank > low_rank ? high_rank - low_rank : 0;
+    }
 };
 
 template <class K,
@@ -741,10 +1007,16 @@ template <class K,
 here. clang accepts it */
                     ,
                     std::size_t> typename StorageTemplate,
-          customize::MapChecking<K> CheckingType>
-[[nodiscard]] constexpr bool is_full(
-    const FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>&
-        container)
+          customize::MapChecking<K> CheckingType,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION>
+[[nodiscard]] constexpr bool is_full(const FixedMap<K,
+                                                    V,
+                                                    MAXIMUM_SIZE,
+                                                    Compare,
+                                                    COMPACTNESS,
+                                                    StorageTemplate,
+                                                    CheckingType,
+                                                    AUGMENTATION>& container)
 {
     return container.size() >= container.max_size();
 }
@@ -759,13 +1031,25 @@ here. clang accepts it */
                     ,
                     std::size_t> typename StorageTemplate,
           customize::MapChecking<K> CheckingType,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION,
           class Predicate>
-constexpr
-    typename FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>::
-        size_type
-        erase_if(FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>&
-                     container,
-                 Predicate predicate)
+constexpr typename FixedMap<K,
+                            V,
+                            MAXIMUM_SIZE,
+                            Compare,
+                            COMPACTNESS,
+                            StorageTemplate,
+                            CheckingType,
+                            AUGMENTATION>::size_type
+erase_if(FixedMap<K,
+                  V,
+                  MAXIMUM_SIZE,
+                  Compare,
+                  COMPACTNESS,
+                  StorageTemplate,
+                  CheckingType,
+                  AUGMENTATION>& container,
+         Predicate predicate)
 {
     return erase_if_detail::erase_if_impl(container, predicate);
 }
@@ -868,10 +1152,16 @@ template <
 here. clang accepts it */
               ,
               std::size_t> typename StorageTemplate,
-    fixed_containers::customize::MapChecking<K> CheckingType>
-struct tuple_size<
-    fixed_containers::
-        FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>>
+    fixed_containers::customize::MapChecking<K> CheckingType,
+    fixed_containers::fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION>
+struct tuple_size<fixed_containers::FixedMap<K,
+                                             V,
+                                             MAXIMUM_SIZE,
+                                             Compare,
+                                             COMPACTNESS,
+                                             StorageTemplate,
+                                             CheckingType,
+                                             AUGMENTATION>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
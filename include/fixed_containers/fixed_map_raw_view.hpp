@@ -5,6 +5,7 @@
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 #include "fixed_containers/fixed_red_black_tree_view.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 
@@ -34,12 +35,18 @@ public:
             Entry(const std::byte* ptr,
                   std::size_t value_offset_bytes,
                   std::size_t element_size_bytes,
+                  std::size_t element_align_bytes,
                   std::size_t max_size_bytes,
                   Compactness compactness,
                   StorageType storage_type,
                   bool end = false) noexcept
-              : base_iterator_(
-                    ptr, element_size_bytes, max_size_bytes, compactness, storage_type, end)
+              : base_iterator_(ptr,
+                               element_size_bytes,
+                               max_size_bytes,
+                               compactness,
+                               storage_type,
+                               end,
+                               element_align_bytes)
               , value_offset_(value_offset_bytes)
             {
             }
@@ -82,8 +89,8 @@ public:
                  bool end = false) noexcept
           : entry_(ptr,
                    align_up(key_size_bytes, value_align_bytes),
-                   align_up(align_up(key_size_bytes, value_align_bytes) + value_size_bytes,
-                            key_align_bytes),
+                   align_up(key_size_bytes, value_align_bytes) + value_size_bytes,
+                   std::max(key_align_bytes, value_align_bytes),
                    max_size_bytes,
                    compactness,
                    storage_type,
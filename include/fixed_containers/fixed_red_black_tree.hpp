@@ -8,8 +8,13 @@
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
 #include <cstddef>
 #include <functional>
+#include <limits>
+#include <type_traits>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -39,14 +44,16 @@ template <class K,
                              here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
+          typename StorageTemplate,
+          RedBlackTreeNodeAugmentation AUGMENTATION>
 class FixedRedBlackTreeBase
 {
 protected:  // [WORKAROUND-1]
     using KeyType = K;
     using ValueType = V;
     static constexpr bool HAS_ASSOCIATED_VALUE = IsNotEmpty<V>;
-    using TreeStorage = FixedRedBlackTreeStorage<K, V, MAXIMUM_SIZE, COMPACTNESS, StorageTemplate>;
+    using TreeStorage =
+        FixedRedBlackTreeStorage<K, V, MAXIMUM_SIZE, COMPACTNESS, StorageTemplate, AUGMENTATION>;
     using NodeType = typename TreeStorage::NodeType;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTreeBase>;
     friend Ops;
@@ -54,11 +61,28 @@ protected:  // [WORKAROUND-1]
 public:
     using size_type = std::size_t;
     using difference_type = std::ptrdiff_t;
+    static constexpr bool HAS_SUBTREE_SIZE = TreeStorage::HAS_SUBTREE_SIZE;
+    static constexpr bool HAS_MAX_HIGH_ENDPOINT = TreeStorage::HAS_MAX_HIGH_ENDPOINT;
+
+    // Arithmetic keys ordered by `<` are cheap to compare, and in a large tree the comparisons are
+    // unpredictable, so it pays off to always descend to the bottom with one comparison per level
+    // rather than to branch on a three-way comparison and stop early. Smaller trees are shallow and
+    // the branch predictor learns their paths, so they keep the early-exit descent, which is
+    // several times faster for them. Only trees that can grow past the threshold pay for the check.
+    static constexpr std::size_t BRANCHLESS_LOOKUP_MINIMUM_SIZE = 4096;
+
+    template <class K0>
+    static constexpr bool HAS_BRANCHLESS_LOOKUP =
+        MAXIMUM_SIZE >= BRANCHLESS_LOOKUP_MINIMUM_SIZE && std::is_arithmetic_v<K> &&
+        std::same_as<K0, K> &&
+        (std::same_as<Compare, std::less<K>> || std::same_as<Compare, std::less<>>);
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     TreeStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_;
     NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
     NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    // Kept up to date so that appending past the maximum does not need to walk the right spine
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_;
     Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{};
 
 public:
@@ -71,6 +95,7 @@ public:
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_{}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_{NULL_INDEX}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_{NULL_INDEX}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
     {
     }
@@ -82,6 +107,10 @@ public:
     }
     [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
     [[nodiscard]] constexpr bool full() const noexcept { return size() == MAXIMUM_SIZE; }
+    [[nodiscard]] constexpr const Compare& key_comp() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
 
     constexpr void clear() noexcept
     {
@@ -134,6 +163,23 @@ public:
 
         RedBlackTreeNodeView node_i = tree_storage_at(np_idxs.i);
         node_i.set_parent_index(np_idxs.parent);
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            node_i.set_subtree_size(1);
+            adjust_subtree_sizes_up_from(np_idxs.parent, true);
+        }
+        if constexpr (HAS_MAX_HIGH_ENDPOINT)
+        {
+            node_i.set_max_high_endpoint(node_i.key().high);
+            raise_max_high_endpoints_up_from(np_idxs.parent, node_i.key().high);
+        }
+
+        // Anything greater than the maximum becomes its right child
+        if (np_idxs.parent == NULL_INDEX ||
+            (np_idxs.parent == index_of_max_at() && !np_idxs.is_left_child))
+        {
+            set_max_index(np_idxs.i);
+        }
 
         // No parent. Corner case for root node
         if (np_idxs.parent == NULL_INDEX)
@@ -156,6 +202,83 @@ public:
         fix_after_insertion(np_idxs.i);
     }
 
+    // Builds the tree out of `count` entries that are produced in ascending key order with no
+    // duplicates, in O(N) and without comparing any keys. `emplace_next(tree_storage)` must emplace
+    // the next entry and return its index.
+    //
+    // The entries are laid out as a weight-balanced tree: every subtree splits its entries in
+    // halves that differ by at most one, so all levels except the deepest are full. Coloring the
+    // deepest level red (unless it is the root) then satisfies all red-black invariants, so no
+    // rotations or recoloring are needed. The shape is traversed in-order with an explicit stack,
+    // since the entries arrive in that order.
+    template <class EmplaceNext>
+    constexpr void build_from_sorted_unique(const std::size_t count, EmplaceNext&& emplace_next)
+    {
+        assert_or_abort(empty());
+        assert_or_abort(count <= MAXIMUM_SIZE);
+        if (count == 0)
+        {
+            return;
+        }
+
+        struct Frame
+        {
+            std::size_t low;
+            std::size_t high;
+            NodeIndex node;
+        };
+        std::array<Frame, std::numeric_limits<std::size_t>::digits> stack{};
+        std::size_t depth = 0;
+        const std::size_t red_depth = static_cast<std::size_t>(std::bit_width(count));
+
+        // Pushes the leftmost path of [low, high); the last completed subtree is then empty.
+        NodeIndex completed = NULL_INDEX;
+        const auto descend = [&stack, &depth, &completed](std::size_t low, std::size_t high)
+        {
+            while (low < high)
+            {
+                stack[depth] = Frame{.low = low, .high = high, .node = NULL_INDEX};
+                ++depth;
+                high = low + ((high - low) / 2);
+            }
+            completed = NULL_INDEX;
+        };
+
+        descend(0, count);
+        while (depth > 0)
+        {
+            Frame& frame = stack[depth - 1];
+            if (frame.node == NULL_INDEX)
+            {
+                // The left subtree is complete, so this frame's entry is next in order.
+                frame.node = emplace_next(tree_storage());
+                RedBlackTreeNodeView node = tree_storage_at(frame.node);
+                node.set_color(depth == red_depth && depth > 1 ? COLOR_RED : COLOR_BLACK);
+                link_built_child(frame.node, completed, true);
+                descend(frame.low + ((frame.high - frame.low) / 2) + 1, frame.high);
+                continue;
+            }
+
+            // The right subtree is complete, and so is this frame's subtree.
+            link_built_child(frame.node, completed, false);
+            if constexpr (HAS_SUBTREE_SIZE)
+            {
+                tree_storage().set_subtree_size(frame.node, frame.high - frame.low);
+            }
+            if constexpr (HAS_MAX_HIGH_ENDPOINT)
+            {
+                recompute_max_high_endpoint_at(frame.node);
+            }
+            completed = frame.node;
+            --depth;
+        }
+
+        tree_storage_at(completed).set_parent_index(NULL_INDEX);
+        set_root_index(completed);
+        set_max_index(index_of_max_at(completed));
+        set_size(count);
+    }
+
     constexpr size_type delete_node(const K& key) noexcept
     {
         const NodeIndex index = index_of_node_or_null(key);
@@ -202,6 +325,54 @@ public:
         return to_idx;
     }
 
+    // Relocates the nodes so that the entry with `n` entries before it is at index `n`. In-order
+    // traversals then visit the nodes sequentially in memory, instead of wherever churn left them.
+    // The shape of the tree is unchanged, and entries are moved rather than compared. All indexes
+    // into the tree are invalidated.
+    //
+    // First, the storage fills the free slots before `size()` with the nodes past it, which are
+    // found with an in-order walk. The nodes are then visited in order, and each one trades places
+    // with the node that occupies its final index.
+    constexpr void compact()
+        requires std::swappable<K> && std::swappable<V>
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        NodeIndex current = index_of_min_at();
+        tree_storage().make_contiguous(
+            size(),
+            [this, &current]()
+            {
+                while (current < size())
+                {
+                    current = index_of_successor_at(current);
+                }
+                return current;
+            },
+            [this, &current](const NodeIndex from, const NodeIndex to)
+            {
+                Ops::fixup_neighbours_of_node_to_point_to_a_new_index(
+                    *this, tree_storage_at(to), from, to);
+                fixup_repositioned_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_, from, to);
+                fixup_repositioned_index(current, from, to);
+            });
+
+        current = index_of_min_at();
+        for (NodeIndex rank = 0; rank < size(); rank++)
+        {
+            if (current != rank)
+            {
+                Ops::swap_nodes_including_key_and_value(*this, current, rank);
+                current = rank;
+            }
+            current = index_of_successor_at(current);
+        }
+        set_max_index(size() - 1);
+    }
+
     [[nodiscard]] constexpr const NodeIndex& root_index() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
@@ -219,6 +390,14 @@ public:
     template <class K0>
     [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent(const K0& key) const
     {
+        if constexpr (HAS_BRANCHLESS_LOOKUP<K0>)
+        {
+            if (size() >= BRANCHLESS_LOOKUP_MINIMUM_SIZE)
+            {
+                return index_of_node_with_parent_branchless(key);
+            }
+        }
+
         NodeIndexAndParentIndex np_idxs{
             .i = root_index(), .parent = NULL_INDEX, .is_left_child = true};
         while (np_idxs.i != NULL_INDEX)
@@ -247,6 +426,66 @@ public:
         return np_idxs;
     }
 
+    // Same as `index_of_node_with_parent()`, but first tries the position next to `hint_index`
+    // (NULL_INDEX for the end), which only needs the hint's neighbours and is O(1) amortized. Falls
+    // back to the search from the root when the key does not belong next to the hint.
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent_near(
+        const NodeIndex& hint_index, const K0& key) const
+    {
+        // Appending past the maximum is the common case for monotonically increasing keys
+        if (hint_index == NULL_INDEX)
+        {
+            const NodeIndex max_index = index_of_max_at();
+            if (max_index != NULL_INDEX && compare(tree_storage().key(max_index), key) < 0)
+            {
+                return {.i = NULL_INDEX, .parent = max_index, .is_left_child = false};
+            }
+            return index_of_node_with_parent(key);
+        }
+
+        const int cmp = compare(key, tree_storage().key(hint_index));
+        if (cmp == 0)
+        {
+            const NodeIndex parent_index = tree_storage().parent_index(hint_index);
+            return {.i = hint_index,
+                    .parent = parent_index,
+                    .is_left_child = left_index_of(parent_index) == hint_index};
+        }
+
+        if (cmp < 0)
+        {
+            // Between the predecessor and the hint. The predecessor is either in the left subtree
+            // of the hint (then it has no right child) or the hint has no left child.
+            const NodeIndex predecessor_index = index_of_predecessor_at(hint_index);
+            if (predecessor_index == NULL_INDEX ||
+                compare(tree_storage().key(predecessor_index), key) < 0)
+            {
+                if (tree_storage().left_index(hint_index) == NULL_INDEX)
+                {
+                    return {.i = NULL_INDEX, .parent = hint_index, .is_left_child = true};
+                }
+                return {.i = NULL_INDEX, .parent = predecessor_index, .is_left_child = false};
+            }
+        }
+        else
+        {
+            // Between the hint and the successor, symmetrically
+            const NodeIndex successor_index = index_of_successor_at(hint_index);
+            if (successor_index == NULL_INDEX ||
+                compare(key, tree_storage().key(successor_index)) < 0)
+            {
+                if (tree_storage().right_index(hint_index) == NULL_INDEX)
+                {
+                    return {.i = NULL_INDEX, .parent = hint_index, .is_left_child = false};
+                }
+                return {.i = NULL_INDEX, .parent = successor_index, .is_left_child = true};
+            }
+        }
+
+        return index_of_node_with_parent(key);
+    }
+
     template <class K0>
     [[nodiscard]] constexpr NodeIndex index_of_node_or_null(const K0& key) const
     {
@@ -377,7 +616,7 @@ public:
     }
     [[nodiscard]] constexpr NodeIndex index_of_max_at() const noexcept
     {
-        return index_of_max_at(this->root_index());
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_;
     }
 
     [[nodiscard]] constexpr NodeIndex index_of_successor_at(const NodeIndex& index) const
@@ -435,7 +674,227 @@ public:
         return predecessor;
     }
 
+    [[nodiscard]] constexpr std::size_t subtree_size_at(const NodeIndex& index) const
+        requires HAS_SUBTREE_SIZE
+    {
+        return index == NULL_INDEX ? 0 : tree_storage().subtree_size(index);
+    }
+
+    // Returns the index of the entry with `n` entries before it, or NULL_INDEX if `n >= size()`.
+    [[nodiscard]] constexpr NodeIndex index_of_nth(std::size_t n) const
+        requires HAS_SUBTREE_SIZE
+    {
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            const std::size_t left_size = subtree_size_at(node.left_index());
+            if (n < left_size)
+            {
+                i = node.left_index();
+                continue;
+            }
+            if (n == left_size)
+            {
+                return i;
+            }
+            n -= left_size + 1;
+            i = node.right_index();
+        }
+        return NULL_INDEX;
+    }
+
+    // Returns the number of entries before the one at `index`, or `size()` for NULL_INDEX.
+    [[nodiscard]] constexpr std::size_t rank_at(const NodeIndex& index) const
+        requires HAS_SUBTREE_SIZE
+    {
+        if (index == NULL_INDEX)
+        {
+            return size();
+        }
+
+        std::size_t rank = subtree_size_at(tree_storage().left_index(index));
+        for (NodeIndex child = index, parent = tree_storage().parent_index(index);
+             parent != NULL_INDEX;
+             child = parent, parent = tree_storage().parent_index(parent))
+        {
+            if (child == tree_storage().right_index(parent))
+            {
+                rank += subtree_size_at(tree_storage().left_index(parent)) + 1;
+            }
+        }
+        return rank;
+    }
+
+    // Returns the number of entries with a key less than `key`.
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t rank_of(const K0& key) const
+        requires HAS_SUBTREE_SIZE
+    {
+        std::size_t rank = 0;
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            if (IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(node.key(), key))
+            {
+                rank += subtree_size_at(node.left_index()) + 1;
+                i = node.right_index();
+            }
+            else
+            {
+                i = node.left_index();
+            }
+        }
+        return rank;
+    }
+
+    // Interval queries, available when the nodes are augmented with
+    // `RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT` and the keys are ordered by their `low`
+    // endpoints first. The matching entries are visited in order, and every one of them costs
+    // O(log N) to find, so queries are O((k + 1) log N) for k matches.
+
+    // Calls `fn` with the index of every entry whose interval contains `point`.
+    template <class P, class Fn>
+    constexpr void for_each_index_containing(const P& point, Fn&& fn) const
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        for (NodeIndex i = index_of_first_ending_after(root_index(), point);
+             i != NULL_INDEX && !(point < tree_storage().key(i).low);
+             i = index_of_next_ending_after(i, point))
+        {
+            fn(i);
+        }
+    }
+
+    // Calls `fn` with the index of every entry whose interval overlaps `interval`.
+    template <class Fn>
+    constexpr void for_each_index_overlapping(const K& interval, Fn&& fn) const
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        for (NodeIndex i = index_of_first_ending_after(root_index(), interval.low);
+             i != NULL_INDEX && tree_storage().key(i).low < interval.high;
+             i = index_of_next_ending_after(i, interval.low))
+        {
+            fn(i);
+        }
+    }
+
 private:
+    // Returns the first entry in order, in the subtree at `index`, whose interval ends after
+    // `point`. A subtree whose maximum is past `point` is guaranteed to have one, so this never
+    // backtracks.
+    template <class P>
+    [[nodiscard]] constexpr NodeIndex index_of_first_ending_after(NodeIndex index,
+                                                                  const P& point) const
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        while (index != NULL_INDEX && point < tree_storage().max_high_endpoint(index))
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(index);
+            if (node.left_index() != NULL_INDEX &&
+                point < tree_storage().max_high_endpoint(node.left_index()))
+            {
+                index = node.left_index();
+                continue;
+            }
+            if (point < node.key().high)
+            {
+                return index;
+            }
+            index = node.right_index();
+        }
+        return NULL_INDEX;
+    }
+
+    // Returns the next entry in order after the one at `index` whose interval ends after `point`.
+    template <class P>
+    [[nodiscard]] constexpr NodeIndex index_of_next_ending_after(const NodeIndex& index,
+                                                                 const P& point) const
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        const NodeIndex in_right_subtree =
+            index_of_first_ending_after(tree_storage().right_index(index), point);
+        if (in_right_subtree != NULL_INDEX)
+        {
+            return in_right_subtree;
+        }
+
+        // Only ancestors that are reached from their left subtree come later in order
+        for (NodeIndex child = index, parent = tree_storage().parent_index(index);
+             parent != NULL_INDEX;
+             child = parent, parent = tree_storage().parent_index(parent))
+        {
+            if (child != tree_storage().left_index(parent))
+            {
+                continue;
+            }
+            if (point < tree_storage().key(parent).high)
+            {
+                return parent;
+            }
+            const NodeIndex found =
+                index_of_first_ending_after(tree_storage().right_index(parent), point);
+            if (found != NULL_INDEX)
+            {
+                return found;
+            }
+        }
+        return NULL_INDEX;
+    }
+
+    // The result of the comparison indexes the pair of children directly, and the deepest node that
+    // is not less than `key` is the only one that can match it, so it is tracked without branching
+    // and checked once at the end. The nodes two levels down are prefetched before the comparison,
+    // so the next level is already in flight whichever way the descent goes.
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent_branchless(
+        const K0& key) const
+    {
+        const TreeStorage& tree = tree_storage();
+        NodeIndexAndParentIndex np_idxs{
+            .i = root_index(), .parent = NULL_INDEX, .is_left_child = true};
+        NodeIndex candidate = NULL_INDEX;
+        while (np_idxs.i != NULL_INDEX)
+        {
+            prefetch_children_of(tree.left_index(np_idxs.i));
+            prefetch_children_of(tree.right_index(np_idxs.i));
+            const bool is_right_child = key_comp()(tree.key(np_idxs.i), key);
+            candidate = is_right_child ? candidate : np_idxs.i;
+            np_idxs.parent = np_idxs.i;
+            np_idxs.is_left_child = !is_right_child;
+            np_idxs.i = tree.child_index(np_idxs.i, is_right_child);
+        }
+
+        if (candidate != NULL_INDEX && !key_comp()(key, tree.key(candidate)))
+        {
+            const NodeIndex parent_index = tree.parent_index(candidate);
+            return {.i = candidate,
+                    .parent = parent_index,
+                    .is_left_child =
+                        parent_index == NULL_INDEX || tree.left_index(parent_index) == candidate};
+        }
+        return np_idxs;
+    }
+
+    constexpr void prefetch_children_of(const NodeIndex& index) const
+    {
+        if (index == NULL_INDEX)
+        {
+            return;
+        }
+        const NodeIndex left_index = tree_storage().left_index(index);
+        const NodeIndex right_index = tree_storage().right_index(index);
+        if (left_index != NULL_INDEX)
+        {
+            tree_storage().prefetch(left_index);
+        }
+        if (right_index != NULL_INDEX)
+        {
+            tree_storage().prefetch(right_index);
+        }
+    }
+
     constexpr void increment_size(const std::size_t n = 1)
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
@@ -533,6 +992,16 @@ private:
 
         right.set_left_index(index);
         node.set_parent_index(r_idx);
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            right.set_subtree_size(node.subtree_size());
+            recompute_subtree_size_at(index);
+        }
+        if constexpr (HAS_MAX_HIGH_ENDPOINT)
+        {
+            right.set_max_high_endpoint(node.max_high_endpoint());
+            recompute_max_high_endpoint_at(index);
+        }
     }
 
     constexpr void rotate_right(const NodeIndex& index)
@@ -568,6 +1037,16 @@ private:
 
         left.set_right_index(index);
         node.set_parent_index(l_idx);
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            left.set_subtree_size(node.subtree_size());
+            recompute_subtree_size_at(index);
+        }
+        if constexpr (HAS_MAX_HIGH_ENDPOINT)
+        {
+            left.set_max_high_endpoint(node.max_high_endpoint());
+            recompute_max_high_endpoint_at(index);
+        }
     }
 
     constexpr void fix_after_insertion(const NodeIndex& index_of_newly_added)
@@ -637,6 +1116,7 @@ private:
         {
             tree_storage().delete_at_and_return_repositioned_index(index);
             set_root_index(NULL_INDEX);
+            set_max_index(NULL_INDEX);
             set_size(0);
             return {.successor = NULL_INDEX, .repositioned = NULL_INDEX};
         }
@@ -644,6 +1124,10 @@ private:
         decrement_size();
         const NodeIndex index_to_delete = index;
         const NodeIndex successor_index = index_of_successor_at(index_to_delete);
+        if (index_to_delete == index_of_max_at())
+        {
+            set_max_index(index_of_predecessor_at(index_to_delete));
+        }
 
         // The canonical way to handle the case where the node_for_deletion has two children is to
         // move successor's element to the original deletion spot, then proceed to delete the
@@ -664,6 +1148,14 @@ private:
             Ops::swap_nodes_excluding_key_and_value(*this, index_to_delete, successor_index);
         }
 
+        // The node to delete now has at most one child. It stops counting towards its ancestors
+        // right away, and towards itself too, as it can still take part in the rotations below.
+        if constexpr (HAS_SUBTREE_SIZE)
+        {
+            adjust_subtree_sizes_up_from(tree_storage().parent_index(index_to_delete), false);
+            tree_storage().set_subtree_size(index_to_delete, 0);
+        }
+
         // Start fixup at replacement node, if it exists
         const NodeIndex replacement_node_index = [this, &index_to_delete]()
         {
@@ -693,6 +1185,13 @@ private:
             {
                 parent_node.set_right_index(replacement_node_index);
             }
+            // Maximum endpoints can't be decremented, so the ancestors recompute theirs once the
+            // node is unlinked. Only they can be stale until then (the swap above moved the node
+            // below some of them), and rotations never move a stale maximum elsewhere.
+            if constexpr (HAS_MAX_HIGH_ENDPOINT)
+            {
+                recompute_max_high_endpoints_up_from(node_to_delete.parent_index());
+            }
 
             node_to_delete.set_parent_index(NULL_INDEX);
             node_to_delete.set_left_index(NULL_INDEX);
@@ -723,6 +1222,10 @@ private:
                 {
                     parent_node.set_right_index(NULL_INDEX);
                 }
+                if constexpr (HAS_MAX_HIGH_ENDPOINT)
+                {
+                    recompute_max_high_endpoints_up_from(node_to_delete.parent_index());
+                }
                 node_to_delete.set_parent_index(NULL_INDEX);
             }
         }
@@ -739,6 +1242,8 @@ private:
                 *this, tree_storage_at(index_to_delete), ret.repositioned, index_to_delete);
             fixup_repositioned_index(
                 IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_, ret.repositioned, index_to_delete);
+            fixup_repositioned_index(
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_, ret.repositioned, index_to_delete);
             fixup_repositioned_index(ret.successor, ret.repositioned, index_to_delete);
         }
 
@@ -824,6 +1329,83 @@ private:
         set_color(idx, COLOR_BLACK);
     }
 
+    constexpr void recompute_subtree_size_at(const NodeIndex& index)
+        requires HAS_SUBTREE_SIZE
+    {
+        const RedBlackTreeNodeView node = tree_storage_at(index);
+        tree_storage().set_subtree_size(
+            index, subtree_size_at(node.left_index()) + subtree_size_at(node.right_index()) + 1);
+    }
+
+    constexpr void adjust_subtree_sizes_up_from(const NodeIndex& index, const bool is_increment)
+        requires HAS_SUBTREE_SIZE
+    {
+        for (NodeIndex i = index; i != NULL_INDEX; i = tree_storage().parent_index(i))
+        {
+            const std::size_t subtree_size = tree_storage().subtree_size(i);
+            tree_storage().set_subtree_size(i,
+                                            is_increment ? subtree_size + 1 : subtree_size - 1);
+        }
+    }
+
+    constexpr void recompute_max_high_endpoint_at(const NodeIndex& index)
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        const RedBlackTreeNodeView node = tree_storage_at(index);
+        IntervalEndpointType<K> max_high_endpoint = node.key().high;
+        for (const NodeIndex child_index : {node.left_index(), node.right_index()})
+        {
+            if (child_index != NULL_INDEX &&
+                max_high_endpoint < tree_storage().max_high_endpoint(child_index))
+            {
+                max_high_endpoint = tree_storage().max_high_endpoint(child_index);
+            }
+        }
+        tree_storage().set_max_high_endpoint(index, max_high_endpoint);
+    }
+
+    constexpr void recompute_max_high_endpoints_up_from(const NodeIndex& index)
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        for (NodeIndex i = index; i != NULL_INDEX; i = tree_storage().parent_index(i))
+        {
+            recompute_max_high_endpoint_at(i);
+        }
+    }
+
+    // Ancestors only ever grow when an entry is added, and stop growing once one does not.
+    constexpr void raise_max_high_endpoints_up_from(const NodeIndex& index,
+                                                    const auto& high_endpoint)
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        for (NodeIndex i = index; i != NULL_INDEX; i = tree_storage().parent_index(i))
+        {
+            if (!(tree_storage().max_high_endpoint(i) < high_endpoint))
+            {
+                return;
+            }
+            tree_storage().set_max_high_endpoint(i, high_endpoint);
+        }
+    }
+
+    constexpr void link_built_child(const NodeIndex& parent_index,
+                                    const NodeIndex& child_index,
+                                    const bool is_left_child)
+    {
+        if (is_left_child)
+        {
+            tree_storage().set_left_index(parent_index, child_index);
+        }
+        else
+        {
+            tree_storage().set_right_index(parent_index, child_index);
+        }
+        if (child_index != NULL_INDEX)
+        {
+            tree_storage().set_parent_index(child_index, parent_index);
+        }
+    }
+
     constexpr void fixup_repositioned_index(NodeIndex& index,
                                             const NodeIndex old_index,
                                             const NodeIndex new_index) const noexcept
@@ -849,6 +1431,10 @@ protected:  // [WORKAROUND-1]
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = new_root_index;
     }
+    constexpr void set_max_index(const std::size_t new_max_index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_ = new_max_index;
+    }
 };
 
 }  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -865,13 +1451,24 @@ template <class K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
+          typename StorageTemplate,
+          RedBlackTreeNodeAugmentation AUGMENTATION>
 class FixedRedBlackTree
-  : public fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
+  : public fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                              V,
+                                                              MAXIMUM_SIZE,
+                                                              Compare,
+                                                              COMPACTNESS,
+                                                              StorageTemplate,
+                                                              AUGMENTATION>
 {
-    using Base = fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    using Base = fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                                    V,
+                                                                    MAXIMUM_SIZE,
+                                                                    Compare,
+                                                                    COMPACTNESS,
+                                                                    StorageTemplate,
+                                                                    AUGMENTATION>;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTree>;
     friend Ops;
 
@@ -894,43 +1491,15 @@ public:
         requires TriviallyMoveAssignable<K> && TriviallyMoveAssignable<V>
     = default;
 
-    // TODO: Use O(N) algorithm. Do non-recursive
     constexpr FixedRedBlackTree(const FixedRedBlackTree& other)
-      : FixedRedBlackTree()
+      : FixedRedBlackTree(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_)
     {
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(np_idxs, node.key(), node.value());
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, node.key());
-            }
-        }
+        this->build_from_sorted_unique(other.size(), emplace_next_from<false>(other));
     }
     constexpr FixedRedBlackTree(FixedRedBlackTree&& other) noexcept
-      : FixedRedBlackTree()
+      : FixedRedBlackTree(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_)
     {
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(
-                    np_idxs, std::move(node.key()), std::move(node.value()));
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, std::move(node.key()));
-            }
-        }
+        this->build_from_sorted_unique(other.size(), emplace_next_from<true>(other));
         // Clear the moved-out-of-map. This is consistent with both std::map
         // as well as the trivial move constructor of this class.
         other.clear();
@@ -943,20 +1512,9 @@ public:
         }
 
         this->clear();
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(np_idxs, node.key(), node.value());
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, node.key());
-            }
-        }
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+        this->build_from_sorted_unique(other.size(), emplace_next_from<false>(other));
         return *this;
     }
     constexpr FixedRedBlackTree& operator=(FixedRedBlackTree&& other) noexcept
@@ -967,21 +1525,9 @@ public:
         }
 
         this->clear();
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(
-                    np_idxs, std::move(node.key()), std::move(node.value()));
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, std::move(node.key()));
-            }
-        }
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+        this->build_from_sorted_unique(other.size(), emplace_next_from<true>(other));
         // The trivial assignment operator does not `other.clear()`, so don't do it here either for
         // consistency across FixedMaps. std::map<T> does clear it, so behavior is different.
         // Both choices are fine, because the state of a moved object is intentionally unspecified
@@ -990,6 +1536,36 @@ public:
     }
 
     constexpr ~FixedRedBlackTree() noexcept { this->clear(); }
+
+private:
+    // The entries of `other` are already sorted and unique, so they are copied (or moved) over with
+    // `build_from_sorted_unique()` in O(N) instead of being inserted one by one.
+    template <bool MOVE_ENTRIES, class OtherTree>
+    static constexpr auto emplace_next_from(OtherTree& other)
+    {
+        return [&other, index = other.index_of_min_at()](auto& tree_storage) mutable
+        {
+            auto node = other.tree_storage_at(index);
+            index = other.index_of_successor_at(index);
+            if constexpr (MOVE_ENTRIES && Base::HAS_ASSOCIATED_VALUE)
+            {
+                return tree_storage.emplace_and_return_index(std::move(node.key()),
+                                                             std::move(node.value()));
+            }
+            else if constexpr (MOVE_ENTRIES)
+            {
+                return tree_storage.emplace_and_return_index(std::move(node.key()));
+            }
+            else if constexpr (Base::HAS_ASSOCIATED_VALUE)
+            {
+                return tree_storage.emplace_and_return_index(node.key(), node.value());
+            }
+            else
+            {
+                return tree_storage.emplace_and_return_index(node.key());
+            }
+        };
+    }
 };
 
 template <TriviallyCopyable K,
@@ -1001,13 +1577,24 @@ template <TriviallyCopyable K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
-class FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
-  : public fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
+          typename StorageTemplate,
+          RedBlackTreeNodeAugmentation AUGMENTATION>
+class FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, AUGMENTATION>
+  : public fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                              V,
+                                                              MAXIMUM_SIZE,
+                                                              Compare,
+                                                              COMPACTNESS,
+                                                              StorageTemplate,
+                                                              AUGMENTATION>
 {
-    using Base = fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    using Base = fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                                    V,
+                                                                    MAXIMUM_SIZE,
+                                                                    Compare,
+                                                                    COMPACTNESS,
+                                                                    StorageTemplate,
+                                                                    AUGMENTATION>;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTree>;
     friend Ops;
 
@@ -1034,9 +1621,10 @@ template <class K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate = FixedIndexBasedPoolStorage>
+          typename StorageTemplate = FixedIndexBasedPoolStorage,
+          RedBlackTreeNodeAugmentation AUGMENTATION = RedBlackTreeNodeAugmentation::NONE>
 using FixedRedBlackTree = fixed_red_black_tree_detail::specializations::
-    FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, AUGMENTATION>;
 
 template <class K,
           std::size_t MAXIMUM_SIZE,
@@ -1044,7 +1632,13 @@ template <class K,
           RedBlackTreeNodeColorCompactness COMPACTNESS =
               RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
           template <IsFixedIndexBasedStorage, std::size_t> typename StorageTemplate =
-              FixedIndexBasedPoolStorage>
-using FixedRedBlackTreeSet =
-    FixedRedBlackTree<K, EmptyValue, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+              FixedIndexBasedPoolStorage,
+          RedBlackTreeNodeAugmentation AUGMENTATION = RedBlackTreeNodeAugmentation::NONE>
+using FixedRedBlackTreeSet = FixedRedBlackTree<K,
+                                               EmptyValue,
+                                               MAXIMUM_SIZE,
+                                               Compare,
+                                               COMPACTNESS,
+                                               StorageTemplate,
+                                               AUGMENTATION>;
 }  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -2,8 +2,12 @@
 
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/interval.hpp"
 #include "fixed_containers/value_or_reference_storage.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
@@ -14,6 +18,20 @@ enum class RedBlackTreeNodeColorCompactness : bool
     EMBEDDED_COLOR = true,
 };
 
+// Order-statistic trees additionally store the size of the subtree rooted at every node, which
+// allows finding the n-th entry and the rank of a key in O(log N). This costs one index-sized
+// counter per node and some bookkeeping on every insertion/deletion, so it is opt-in.
+//
+// Interval trees instead store the greatest `high` endpoint in the subtree rooted at every node,
+// for keys that are intervals (see `IsInterval`). Whole subtrees that end before a point can then
+// be skipped when looking for the intervals that contain that point or overlap another interval.
+enum class RedBlackTreeNodeAugmentation : std::uint8_t
+{
+    NONE,
+    SUBTREE_SIZE,
+    MAX_HIGH_ENDPOINT,
+};
+
 template <class T>
 concept IsRedBlackTreeNode = requires(const T& const_s,
                                       std::remove_const_t<T>& mutable_s,
@@ -35,6 +53,8 @@ concept IsRedBlackTreeNode = requires(const T& const_s,
     const_s.right_index();
     mutable_s.set_right_index(index);
 
+    const_s.child_index(true);
+
     const_s.color();
     mutable_s.set_color(color);
 };
@@ -46,7 +66,8 @@ concept IsRedBlackTreeNodeWithValue =
         mutable_s.value();
     };
 
-template <class K, class V = EmptyValue>
+// `IndexStorageT` is the type that the links are stored as, see `NodeIndexStorageType`.
+template <class K, class V = EmptyValue, typename IndexStorageT = NodeIndex>
 class DefaultRedBlackTreeNode
 {
 public:
@@ -57,9 +78,10 @@ public:
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
     V IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    BasicStoredNodeIndex<IndexStorageT> IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_{};
+    // The left child, then the right one
+    std::array<BasicStoredNodeIndex<IndexStorageT>, 2>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_{};
     NodeColor IMPLEMENTATION_DETAIL_DO_NOT_USE_color_ = COLOR_BLACK;
 
 public:
@@ -88,27 +110,25 @@ public:
 
     [[nodiscard]] constexpr NodeIndex parent_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_.get_index();
     }
     constexpr void set_parent_index(const NodeIndex& new_parent_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = new_parent_index;
-    }
-    [[nodiscard]] constexpr NodeIndex left_index() const
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_.set_index(new_parent_index);
     }
+    [[nodiscard]] constexpr NodeIndex left_index() const { return child_index(false); }
     constexpr void set_left_index(const NodeIndex& new_left_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = new_left_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[0].set_index(new_left_index);
     }
-    [[nodiscard]] constexpr NodeIndex right_index() const
+    [[nodiscard]] constexpr NodeIndex right_index() const { return child_index(true); }
+    constexpr void set_right_index(const NodeIndex& new_right_index)
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[1].set_index(new_right_index);
     }
-    constexpr void set_right_index(const NodeIndex& new_right_index)
+    [[nodiscard]] constexpr NodeIndex child_index(const bool is_right_child) const
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = new_right_index;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[is_right_child ? 1 : 0].get_index();
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -120,8 +140,8 @@ public:
     }
 };
 
-template <class K>
-class DefaultRedBlackTreeNode<K, EmptyValue>
+template <class K, typename IndexStorageT>
+class DefaultRedBlackTreeNode<K, EmptyValue, IndexStorageT>
 {
 public:
     using KeyType = K;
@@ -130,9 +150,9 @@ public:
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    BasicStoredNodeIndex<IndexStorageT> IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_{};
+    std::array<BasicStoredNodeIndex<IndexStorageT>, 2>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_{};
     NodeColor IMPLEMENTATION_DETAIL_DO_NOT_USE_color_ = COLOR_BLACK;
 
 public:
@@ -150,27 +170,25 @@ public:
 
     [[nodiscard]] constexpr NodeIndex parent_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_.get_index();
     }
     constexpr void set_parent_index(const NodeIndex& new_parent_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = new_parent_index;
-    }
-    [[nodiscard]] constexpr NodeIndex left_index() const
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_.set_index(new_parent_index);
     }
+    [[nodiscard]] constexpr NodeIndex left_index() const { return child_index(false); }
     constexpr void set_left_index(const NodeIndex& new_left_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = new_left_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[0].set_index(new_left_index);
     }
-    [[nodiscard]] constexpr NodeIndex right_index() const
+    [[nodiscard]] constexpr NodeIndex right_index() const { return child_index(true); }
+    constexpr void set_right_index(const NodeIndex& new_right_index)
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[1].set_index(new_right_index);
     }
-    constexpr void set_right_index(const NodeIndex& new_right_index)
+    [[nodiscard]] constexpr NodeIndex child_index(const bool is_right_child) const
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = new_right_index;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[is_right_child ? 1 : 0].get_index();
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -186,7 +204,7 @@ public:
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/detail/rbtree_node.hpp#L44
 // This is very good not just for the 1 byte saved, but because it improves alignment
 // characteristics.
-template <class K, class V = EmptyValue>
+template <class K, class V = EmptyValue, typename IndexStorageT = NodeIndex>
 class CompactRedBlackTreeNode
 {
 public:
@@ -198,10 +216,10 @@ public:  // Public so this type is a structural type and can thus be used in tem
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
     value_or_reference_storage_detail::ValueOrReferenceStorage<V>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
-    NodeIndexWithColorEmbeddedInTheMostSignificantBit
+    BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit<IndexStorageT>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_{};
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    std::array<BasicStoredNodeIndex<IndexStorageT>, 2>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_{};
 
 public:
     template <typename... Args>
@@ -235,21 +253,19 @@ public:
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_.set_index(new_parent_index);
     }
-    [[nodiscard]] constexpr NodeIndex left_index() const
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
-    }
+    [[nodiscard]] constexpr NodeIndex left_index() const { return child_index(false); }
     constexpr void set_left_index(const NodeIndex& new_left_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = new_left_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[0].set_index(new_left_index);
     }
-    [[nodiscard]] constexpr NodeIndex right_index() const
+    [[nodiscard]] constexpr NodeIndex right_index() const { return child_index(true); }
+    constexpr void set_right_index(const NodeIndex& new_right_index)
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[1].set_index(new_right_index);
     }
-    constexpr void set_right_index(const NodeIndex& new_right_index)
+    [[nodiscard]] constexpr NodeIndex child_index(const bool is_right_child) const
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = new_right_index;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[is_right_child ? 1 : 0].get_index();
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -261,8 +277,8 @@ public:
     }
 };
 
-template <class K>
-class CompactRedBlackTreeNode<K, EmptyValue>
+template <class K, typename IndexStorageT>
+class CompactRedBlackTreeNode<K, EmptyValue, IndexStorageT>
 {
 public:
     using KeyType = K;
@@ -271,10 +287,10 @@ public:
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
-    NodeIndexWithColorEmbeddedInTheMostSignificantBit
+    BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit<IndexStorageT>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_{};
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    std::array<BasicStoredNodeIndex<IndexStorageT>, 2>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_{};
 
 public:
     explicit constexpr CompactRedBlackTreeNode(const K& key) noexcept
@@ -297,21 +313,19 @@ public:
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_.set_index(new_parent_index);
     }
-    [[nodiscard]] constexpr NodeIndex left_index() const
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
-    }
+    [[nodiscard]] constexpr NodeIndex left_index() const { return child_index(false); }
     constexpr void set_left_index(const NodeIndex& new_left_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = new_left_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[0].set_index(new_left_index);
     }
-    [[nodiscard]] constexpr NodeIndex right_index() const
+    [[nodiscard]] constexpr NodeIndex right_index() const { return child_index(true); }
+    constexpr void set_right_index(const NodeIndex& new_right_index)
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[1].set_index(new_right_index);
     }
-    constexpr void set_right_index(const NodeIndex& new_right_index)
+    [[nodiscard]] constexpr NodeIndex child_index(const bool is_right_child) const
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = new_right_index;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_child_indices_[is_right_child ? 1 : 0].get_index();
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -323,6 +337,74 @@ public:
     }
 };
 
+// Adds the subtree size to any of the node types above. The count never exceeds MAXIMUM_SIZE, so it
+// is stored in the same type as the links.
+template <class BaseNode, typename IndexStorageT>
+class SubtreeSizeAugmentedRedBlackTreeNode : public BaseNode
+{
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    IndexStorageT IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_{};
+
+public:
+    using BaseNode::BaseNode;
+
+    [[nodiscard]] constexpr std::size_t subtree_size() const
+    {
+        return static_cast<std::size_t>(IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_);
+    }
+    constexpr void set_subtree_size(const std::size_t new_subtree_size)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_size_ =
+            static_cast<IndexStorageT>(new_subtree_size);
+    }
+};
+
+// Adds the greatest `high` endpoint of the intervals in the subtree to any of the node types above.
+template <class BaseNode, class EndpointT>
+class MaxHighEndpointAugmentedRedBlackTreeNode : public BaseNode
+{
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    EndpointT IMPLEMENTATION_DETAIL_DO_NOT_USE_max_high_endpoint_{};
+
+public:
+    using BaseNode::BaseNode;
+
+    [[nodiscard]] constexpr const EndpointT& max_high_endpoint() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_max_high_endpoint_;
+    }
+    constexpr void set_max_high_endpoint(const EndpointT& new_max_high_endpoint)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_max_high_endpoint_ = new_max_high_endpoint;
+    }
+};
+
+// Selects the node type for `AUGMENTATION`. The endpoint type is only looked up for interval trees,
+// as other keys need not be intervals.
+template <class BaseNode, typename IndexStorageT, RedBlackTreeNodeAugmentation AUGMENTATION>
+struct AugmentedRedBlackTreeNode
+{
+    using Type = BaseNode;
+};
+template <class BaseNode, typename IndexStorageT>
+struct AugmentedRedBlackTreeNode<BaseNode,
+                                 IndexStorageT,
+                                 RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+{
+    using Type = SubtreeSizeAugmentedRedBlackTreeNode<BaseNode, IndexStorageT>;
+};
+template <class BaseNode, typename IndexStorageT>
+struct AugmentedRedBlackTreeNode<BaseNode,
+                                 IndexStorageT,
+                                 RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT>
+{
+    static_assert(IsInterval<typename BaseNode::KeyType>,
+                  "MAX_HIGH_ENDPOINT requires keys with `low` and `high` endpoints");
+    using Type = MaxHighEndpointAugmentedRedBlackTreeNode<
+        BaseNode,
+        IntervalEndpointType<typename BaseNode::KeyType>>;
+};
+
 template <class S>
 class RedBlackTreeNodeView
 {
@@ -383,6 +465,11 @@ public:
         storage_->set_right_index(node_index_, new_right_index);
     }
 
+    [[nodiscard]] constexpr NodeIndex child_index(const bool is_right_child) const
+    {
+        return storage_->child_index(node_index_, is_right_child);
+    }
+
     [[nodiscard]] constexpr NodeIndex parent_index() const
     {
         return storage_->parent_index(node_index_);
@@ -399,6 +486,28 @@ public:
     {
         return storage_->set_color(node_index_, new_color);
     }
+
+    [[nodiscard]] constexpr std::size_t subtree_size() const
+        requires S::HAS_SUBTREE_SIZE
+    {
+        return storage_->subtree_size(node_index_);
+    }
+    constexpr void set_subtree_size(const std::size_t new_subtree_size)
+        requires IS_MUTABLE && S::HAS_SUBTREE_SIZE
+    {
+        storage_->set_subtree_size(node_index_, new_subtree_size);
+    }
+
+    [[nodiscard]] constexpr const auto& max_high_endpoint() const
+        requires S::HAS_MAX_HIGH_ENDPOINT
+    {
+        return storage_->max_high_endpoint(node_index_);
+    }
+    constexpr void set_max_high_endpoint(const auto& new_max_high_endpoint)
+        requires IS_MUTABLE && S::HAS_MAX_HIGH_ENDPOINT
+    {
+        storage_->set_max_high_endpoint(node_index_, new_max_high_endpoint);
+    }
 };
 
 }  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -5,6 +5,8 @@
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
+#include <concepts>
+#include <cstddef>
 #include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
@@ -68,6 +70,20 @@ class FixedRedBlackTreeOps
             [](RedBlackTreeNodeView<TreeStorage> node) { return node.color(); },
             [](RedBlackTreeNodeView<TreeStorage> node, NodeColor color) { node.set_color(color); });
     }
+    static constexpr void swap_subtree_size(RedBlackTreeNodeView<TreeStorage> node_i,
+                                            RedBlackTreeNodeView<TreeStorage> node_j)
+    {
+        const std::size_t tmp = node_i.subtree_size();
+        node_i.set_subtree_size(node_j.subtree_size());
+        node_j.set_subtree_size(tmp);
+    }
+    static constexpr void swap_max_high_endpoint(RedBlackTreeNodeView<TreeStorage> node_i,
+                                                 RedBlackTreeNodeView<TreeStorage> node_j)
+    {
+        auto tmp = node_i.max_high_endpoint();
+        node_i.set_max_high_endpoint(node_j.max_high_endpoint());
+        node_j.set_max_high_endpoint(tmp);
+    }
 
 public:
     constexpr FixedRedBlackTreeOps() = delete;
@@ -119,17 +135,21 @@ public:
         swap_nodes_excluding_key_and_value_impl(tree, index_i, index_j, node_i, node_j);
     }
 
+    // The tree keeps its shape and its entries, but the entries at the two indexes trade places.
     static constexpr void swap_nodes_including_key_and_value(RedBlackTreeStorage& tree,
                                                              const NodeIndex& index_i,
                                                              const NodeIndex& index_j)
-        requires TriviallyCopyable<K> && TriviallyCopyable<V>
+        requires std::swappable<K> && std::swappable<V>
     {
         swap_nodes_excluding_key_and_value(tree, index_i, index_j);
 
         RedBlackTreeNodeView node_i = tree.node_at(index_i);
         RedBlackTreeNodeView node_j = tree.node_at(index_j);
         std::swap(node_i.key(), node_j.key());
-        std::swap(node_i.value(), node_j.value());
+        if constexpr (IsNotEmpty<V>)
+        {
+            std::swap(node_i.value(), node_j.value());
+        }
     }
 
 private:
@@ -188,6 +208,32 @@ private:
             node_j.set_right_index(node_i.right_index());
             node_i.set_right_index(index_j);
         }
+        else if (const NodeIndex parent_index = node_i.parent_index();
+                 parent_index != NULL_INDEX && parent_index == node_j.parent_index())
+        {
+            /*
+             *               p
+             *             /   \
+             *           i       j    (or j and i)
+             */
+
+            // Only the children need to point to the new indexes, the parent just flips its own
+            node_i.set_parent_index(NULL_INDEX);
+            node_j.set_parent_index(NULL_INDEX);
+
+            fixup_neighbours_of_node_to_point_to_a_new_index(tree, node_i, index_i, index_j);
+            fixup_neighbours_of_node_to_point_to_a_new_index(tree, node_j, index_j, index_i);
+
+            RedBlackTreeNodeView parent_node = tree.node_at(parent_index);
+            const NodeIndex tmp = parent_node.left_index();
+            parent_node.set_left_index(parent_node.right_index());
+            parent_node.set_right_index(tmp);
+
+            node_i.set_parent_index(parent_index);
+            node_j.set_parent_index(parent_index);
+            swap_left_index(node_i, node_j);
+            swap_right_index(node_i, node_j);
+        }
         else
         {
             fixup_neighbours_of_node_to_point_to_a_new_index(tree, node_i, index_i, index_j);
@@ -208,6 +254,15 @@ private:
         }
 
         swap_color(node_i, node_j);
+        // Augmentations describe the subtree at a position in the tree, not the entry
+        if constexpr (TreeStorage::HAS_SUBTREE_SIZE)
+        {
+            swap_subtree_size(node_i, node_j);
+        }
+        if constexpr (TreeStorage::HAS_MAX_HIGH_ENDPOINT)
+        {
+            swap_max_high_endpoint(node_i, node_j);
+        }
     }
 };
 
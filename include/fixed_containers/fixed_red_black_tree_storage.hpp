@@ -3,7 +3,9 @@
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/memory.hpp"
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -31,6 +33,7 @@ concept IsFixedRedBlackTreeStorage =
         mutable_s.left_index(index);
         const_s.right_index(index);
         mutable_s.right_index(index);
+        const_s.child_index(index, true);
         const_s.parent_index(index);
         mutable_s.parent_index(index);
         const_s.color(index);
@@ -50,16 +53,25 @@ template <class K,
           std::size_t MAXIMUM_SIZE,
           RedBlackTreeNodeColorCompactness COMPACTNESS,
           template <IsFixedIndexBasedStorage, std::size_t>
-          typename StorageTemplate>
+          typename StorageTemplate,
+          RedBlackTreeNodeAugmentation AUGMENTATION = RedBlackTreeNodeAugmentation::NONE>
 class FixedRedBlackTreeStorage
 {
+    using IndexStorageType = NodeIndexStorageType<MAXIMUM_SIZE>;
+    using BaseNodeType =
+        std::conditional_t<COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                           CompactRedBlackTreeNode<K, V, IndexStorageType>,
+                           DefaultRedBlackTreeNode<K, V, IndexStorageType>>;
+
 public:
     using KeyType = K;
     using ValueType = V;
+    static constexpr bool HAS_SUBTREE_SIZE =
+        AUGMENTATION == RedBlackTreeNodeAugmentation::SUBTREE_SIZE;
+    static constexpr bool HAS_MAX_HIGH_ENDPOINT =
+        AUGMENTATION == RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT;
     using NodeType =
-        std::conditional_t<COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
-                           CompactRedBlackTreeNode<K, V>,
-                           DefaultRedBlackTreeNode<K, V>>;
+        typename AugmentedRedBlackTreeNode<BaseNodeType, IndexStorageType, AUGMENTATION>::Type;
     static constexpr bool HAS_ASSOCIATED_VALUE = NodeType::HAS_ASSOCIATED_VALUE;
     using size_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::size_type;
     using difference_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::difference_type;
@@ -119,6 +131,17 @@ public:
         return storage().at(index).set_right_index(new_right_index);
     }
 
+    [[nodiscard]] constexpr NodeIndex child_index(const NodeIndex& index,
+                                                  const bool is_right_child) const
+    {
+        return storage().at(index).child_index(is_right_child);
+    }
+
+    constexpr void prefetch(const NodeIndex& index) const
+    {
+        memory::prefetch_for_read(storage().at(index));
+    }
+
     [[nodiscard]] constexpr NodeIndex parent_index(const NodeIndex& index) const
     {
         return storage().at(index).parent_index();
@@ -137,6 +160,29 @@ public:
         return storage().at(index).set_color(new_color);
     }
 
+    [[nodiscard]] constexpr std::size_t subtree_size(const NodeIndex& index) const
+        requires HAS_SUBTREE_SIZE
+    {
+        return storage().at(index).subtree_size();
+    }
+    constexpr void set_subtree_size(const NodeIndex& index, const std::size_t new_subtree_size)
+        requires HAS_SUBTREE_SIZE
+    {
+        storage().at(index).set_subtree_size(new_subtree_size);
+    }
+
+    [[nodiscard]] constexpr const auto& max_high_endpoint(const NodeIndex& index) const
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        return storage().at(index).max_high_endpoint();
+    }
+    constexpr void set_max_high_endpoint(const NodeIndex& index,
+                                         const auto& new_max_high_endpoint)
+        requires HAS_MAX_HIGH_ENDPOINT
+    {
+        storage().at(index).set_max_high_endpoint(new_max_high_endpoint);
+    }
+
     template <class... Args>
     constexpr NodeIndex emplace_and_return_index(Args&&... args)
     {
@@ -148,6 +194,16 @@ public:
         return storage().delete_at_and_return_repositioned_index(index);
     }
 
+    template <class NextIndexToMove, class OnMoved>
+    constexpr void make_contiguous(const std::size_t count,
+                                   NextIndexToMove&& next_index_to_move,
+                                   OnMoved&& on_moved)
+    {
+        storage().make_contiguous(count,
+                                  std::forward<NextIndexToMove>(next_index_to_move),
+                                  std::forward<OnMoved>(on_moved));
+    }
+
 private:
     [[nodiscard]] constexpr const StorageTemplate<NodeType, MAXIMUM_SIZE>& storage() const
     {
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/int_math.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -14,6 +17,45 @@ using NodeColor = bool;
 constexpr NodeColor COLOR_BLACK = false;
 constexpr NodeColor COLOR_RED = true;
 
+// Nodes store their indices in the narrowest unsigned type that can hold [0, MAXIMUM_SIZE) and a
+// null index, while keeping the most significant bit free for an embedded color. Algorithms keep
+// working with `NodeIndex`, and the conversion happens when reading from/writing to a node.
+inline constexpr std::size_t NODE_INDEX_RESERVED_HIGH_BITS = 1;
+
+template <std::size_t MAXIMUM_SIZE>
+using NodeIndexStorageType =
+    int_math::SmallestUnsignedIntegralFor<MAXIMUM_SIZE, NODE_INDEX_RESERVED_HIGH_BITS>;
+
+// A `NodeIndex` stored as an `IndexStorageT`, with NULL_INDEX mapped to the max() of the latter.
+template <typename IndexStorageT>
+class BasicStoredNodeIndex
+{
+    static constexpr IndexStorageT LOCAL_NULL_INDEX = (std::numeric_limits<IndexStorageT>::max)();
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    IndexStorageT IMPLEMENTATION_DETAIL_DO_NOT_USE_index_;
+
+public:
+    constexpr BasicStoredNodeIndex()
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_index_{LOCAL_NULL_INDEX}
+    {
+    }
+
+    [[nodiscard]] constexpr NodeIndex get_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_ == LOCAL_NULL_INDEX
+                   ? NULL_INDEX
+                   : static_cast<NodeIndex>(IMPLEMENTATION_DETAIL_DO_NOT_USE_index_);
+    }
+
+    constexpr void set_index(const NodeIndex index)
+    {
+        const NodeIndex actual_index = index == NULL_INDEX ? LOCAL_NULL_INDEX : index;
+        assert_or_abort(actual_index <= LOCAL_NULL_INDEX);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_index_ = static_cast<IndexStorageT>(actual_index);
+    }
+};
+
 // boost::container::map has the option to embed the color in one of the pointers
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/detail/rbtree_node.hpp#L44
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/pointer_plus_bits.hpp#L79
@@ -22,25 +64,29 @@ constexpr NodeColor COLOR_RED = true;
 // bits for storing the color. Also, note for subsequent comment: nullptr is at 0.
 //
 // This class does something similar, except it embeds the color in the high bits of the indexes.
-// This is because it is unlikely that we are going to need maps up to NodeIndex::max() and we
+// This is because it is unlikely that we are going to need maps up to IndexStorageT::max() and we
 // care about values 0 to MAXIMUM_SIZE. Furthermore, NULL_INDEX is at max().
-class NodeIndexWithColorEmbeddedInTheMostSignificantBit
+template <typename IndexStorageT>
+class BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit
 {
-    static constexpr std::size_t SHIFT_TO_MOST_SIGNIFICANT_BIT = (sizeof(NodeIndex) * 8ULL) - 1ULL;
-    static constexpr NodeIndex MASK = 1ULL << SHIFT_TO_MOST_SIGNIFICANT_BIT;
-    static constexpr NodeIndex LOCAL_NULL_INDEX = NULL_INDEX >> 1;
+    static constexpr std::size_t SHIFT_TO_MOST_SIGNIFICANT_BIT =
+        (sizeof(IndexStorageT) * 8ULL) - 1ULL;
+    static constexpr IndexStorageT MASK = static_cast<IndexStorageT>(
+        static_cast<IndexStorageT>(1) << SHIFT_TO_MOST_SIGNIFICANT_BIT);
+    static constexpr IndexStorageT LOCAL_NULL_INDEX =
+        (std::numeric_limits<IndexStorageT>::max)() >> 1U;
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
+    IndexStorageT IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
 
 public:
-    constexpr NodeIndexWithColorEmbeddedInTheMostSignificantBit()
-      : NodeIndexWithColorEmbeddedInTheMostSignificantBit{NULL_INDEX, COLOR_BLACK}
+    constexpr BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit()
+      : BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit{NULL_INDEX, COLOR_BLACK}
     {
     }
 
-    constexpr NodeIndexWithColorEmbeddedInTheMostSignificantBit(const NodeIndex& index,
-                                                                const NodeColor& color)
+    constexpr BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit(const NodeIndex& index,
+                                                                     const NodeColor& color)
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_{}
     {
         set_index(index);
@@ -49,21 +95,22 @@ public:
 
     [[nodiscard]] constexpr NodeIndex get_index() const
     {
-        const NodeIndex ret = index_and_color() & (~MASK);
+        const auto ret = static_cast<IndexStorageT>(index_and_color() & (~MASK));
 
         if (ret == LOCAL_NULL_INDEX)
         {
             return NULL_INDEX;
         }
 
-        return ret;
+        return static_cast<NodeIndex>(ret);
     }
 
     constexpr void set_index(const NodeIndex index)
     {
         const NodeIndex actual_index = index == NULL_INDEX ? LOCAL_NULL_INDEX : index;
         assert_or_abort(actual_index <= LOCAL_NULL_INDEX);
-        index_and_color() = (index_and_color() & MASK) | actual_index;
+        index_and_color() = static_cast<IndexStorageT>((index_and_color() & MASK) |
+                                                       static_cast<IndexStorageT>(actual_index));
     }
 
     [[nodiscard]] constexpr NodeColor get_color() const
@@ -73,21 +120,26 @@ public:
 
     constexpr void set_color(const NodeColor new_color)
     {
-        index_and_color() = (~MASK & index_and_color()) |
-                            (static_cast<NodeIndex>(new_color) << SHIFT_TO_MOST_SIGNIFICANT_BIT);
+        index_and_color() = static_cast<IndexStorageT>(
+            (~MASK & index_and_color()) |
+            static_cast<IndexStorageT>(static_cast<IndexStorageT>(new_color)
+                                       << SHIFT_TO_MOST_SIGNIFICANT_BIT));
     }
 
 private:
-    [[nodiscard]] constexpr const NodeIndex& index_and_color() const
+    [[nodiscard]] constexpr const IndexStorageT& index_and_color() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
     }
-    [[nodiscard]] constexpr NodeIndex& index_and_color()
+    [[nodiscard]] constexpr IndexStorageT& index_and_color()
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
     }
 };
 
+using NodeIndexWithColorEmbeddedInTheMostSignificantBit =
+    BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit<NodeIndex>;
+
 struct NodeIndexAndParentIndex
 {
     NodeIndex i = NULL_INDEX;
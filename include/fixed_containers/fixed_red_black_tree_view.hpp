@@ -4,7 +4,10 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/int_math.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <memory>
@@ -21,12 +24,36 @@ class FixedRedBlackTreeRawView
     static constexpr auto NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
 
 public:
+    // Passed as `elem_align_bytes` to derive the element alignment from the element size, see
+    // `default_elem_align_bytes()`.
+    static constexpr std::size_t DERIVED_ALIGNMENT = 0;
+
+    /**
+     * The alignment assumed for an element of `elem_size_bytes` bytes, when it is not provided:
+     * the largest power of two that divides the size, up to alignof(std::max_align_t). This is
+     * exact for scalars and for aggregates of a single scalar type (other than `char` arrays).
+     * The alignment determines the padding of nodes with narrow indices, so views of other element
+     * types should pass `elem_align_bytes` explicitly.
+     */
+    [[nodiscard]] static constexpr std::size_t default_elem_align_bytes(
+        std::size_t elem_size_bytes)
+    {
+        std::size_t align = 1;
+        while (align < alignof(std::max_align_t) && elem_size_bytes % (2 * align) == 0)
+        {
+            align *= 2;
+        }
+        return align;
+    }
+
     class Iterator
     {
     private:
         const std::byte* base_;
         std::size_t elem_size_bytes_;
+        std::size_t elem_align_bytes_;
         std::size_t max_size_bytes_;
+        std::size_t index_size_bytes_;
         Compactness compactness_;
         StorageType storage_type_;
         std::size_t storage_elem_size_bytes_;
@@ -48,10 +75,16 @@ public:
                  std::size_t max_size_bytes,
                  Compactness compactness,
                  StorageType storage_type,
-                 bool end = false) noexcept
+                 bool end = false,
+                 std::size_t elem_align_bytes = DERIVED_ALIGNMENT) noexcept
           : base_{ptr}
           , elem_size_bytes_{elem_size_bytes}
+          , elem_align_bytes_{elem_align_bytes != DERIVED_ALIGNMENT
+                                  ? elem_align_bytes
+                                  : default_elem_align_bytes(elem_size_bytes)}
           , max_size_bytes_{max_size_bytes}
+          , index_size_bytes_{int_math::smallest_unsigned_integral_size_bytes(
+                max_size_bytes, fixed_red_black_tree_detail::NODE_INDEX_RESERVED_HIGH_BITS)}
           , compactness_{compactness}
           , storage_type_{storage_type}
           , storage_elem_size_bytes_{storage_elem_size_bytes()}
@@ -61,7 +94,7 @@ public:
         }
 
         Iterator() noexcept
-          : Iterator(nullptr, {}, {}, {}, {}, false)
+          : Iterator(nullptr, {}, {}, {}, {}, false, 1)
         {
         }
 
@@ -153,10 +186,9 @@ public:
         [[nodiscard]] NodeIndex left_index(NodeIndex index) const
         {
             const auto* const node = node_pointer(index); /* key_ */
-            const auto parent_index_offset = align_up(elem_size_bytes_, sizeof(uintptr_t));
             const auto left_index_offset =
-                static_cast<difference_type>(parent_index_offset + sizeof(NodeIndex));
-            return *reinterpret_cast<const NodeIndex*>(std::next(node, left_index_offset));
+                static_cast<difference_type>(links_offset() + index_size_bytes_);
+            return read_index(std::next(node, left_index_offset), false);
         }
 
         /**
@@ -166,11 +198,9 @@ public:
         [[nodiscard]] NodeIndex right_index(NodeIndex index) const
         {
             const auto* const node = node_pointer(index);
-            const auto parent_index_offset = align_up(elem_size_bytes_, sizeof(uintptr_t));
-            const auto left_index_offset = parent_index_offset + sizeof(NodeIndex);
             const auto right_index_offset =
-                static_cast<difference_type>(left_index_offset + sizeof(NodeIndex));
-            return *reinterpret_cast<const NodeIndex*>(std::next(node, right_index_offset));
+                static_cast<difference_type>(links_offset() + (2 * index_size_bytes_));
+            return read_index(std::next(node, right_index_offset), false);
         }
 
         /**
@@ -179,28 +209,62 @@ public:
          */
         [[nodiscard]] NodeIndex parent_index(NodeIndex index) const
         {
-            using fixed_red_black_tree_detail::NodeIndexWithColorEmbeddedInTheMostSignificantBit;
-
             const auto* const node = node_pointer(index);
-            const auto parent_index_offset =
-                static_cast<difference_type>(align_up(elem_size_bytes_, sizeof(uintptr_t)));
-            const auto* const parent_idx_ptr = std::next(node, parent_index_offset);
+            const auto* const parent_idx_ptr =
+                std::next(node, static_cast<difference_type>(links_offset()));
 
             switch (compactness_)
             {
             case Compactness::DEDICATED_COLOR: /* default node */
-                return *reinterpret_cast<const NodeIndex*>(parent_idx_ptr);
+                return read_index(parent_idx_ptr, false);
 
             case Compactness::EMBEDDED_COLOR: /* compact node*/
-                return reinterpret_cast<const NodeIndexWithColorEmbeddedInTheMostSignificantBit*>(
-                           parent_idx_ptr)
-                    ->get_index();
+                return read_index(parent_idx_ptr, true);
             }
 
             assert_or_abort(false);
             return NULL_INDEX;
         }
 
+        /**
+         * Offset of the parent index in a node. The left and right indices follow it. Indices are
+         * stored in `index_size_bytes_` bytes, see `NodeIndexStorageType`.
+         */
+        [[nodiscard]] std::size_t links_offset() const
+        {
+            return align_up(elem_size_bytes_, index_size_bytes_);
+        }
+
+        template <typename IndexStorageT>
+        [[nodiscard]] static NodeIndex read_index_as(const std::byte* ptr,
+                                                     bool has_embedded_color)
+        {
+            using IndexWithColor = fixed_red_black_tree_detail::
+                BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit<IndexStorageT>;
+            using StoredIndex = fixed_red_black_tree_detail::BasicStoredNodeIndex<IndexStorageT>;
+
+            if (has_embedded_color)
+            {
+                return reinterpret_cast<const IndexWithColor*>(ptr)->get_index();
+            }
+            return reinterpret_cast<const StoredIndex*>(ptr)->get_index();
+        }
+
+        [[nodiscard]] NodeIndex read_index(const std::byte* ptr, bool has_embedded_color) const
+        {
+            switch (index_size_bytes_)
+            {
+            case sizeof(std::uint8_t):
+                return read_index_as<std::uint8_t>(ptr, has_embedded_color);
+            case sizeof(std::uint16_t):
+                return read_index_as<std::uint16_t>(ptr, has_embedded_color);
+            case sizeof(std::uint32_t):
+                return read_index_as<std::uint32_t>(ptr, has_embedded_color);
+            default:
+                return read_index_as<NodeIndex>(ptr, has_embedded_color);
+            }
+        }
+
         /**
          * Traverse the tree starting at the node corresponding to `index` to find the successor
          * node and return its index.
@@ -261,9 +325,10 @@ public:
             }
 
             case StorageType::FIXED_INDEX_CONTIGUOUS:
-                const auto vector_size_bytes = sizeof(std::size_t);
                 const auto vector_data_size_bytes = storage_elem_size_bytes_ * max_size_bytes_;
-                return vector_size_bytes + vector_data_size_bytes;
+                // The root index that follows is a `NodeIndex`
+                return align_up(contiguous_array_offset() + vector_data_size_bytes,
+                                sizeof(NodeIndex));
             }
 
             assert_or_abort(false);
@@ -293,11 +358,22 @@ public:
             const auto* const bptr = reinterpret_cast<const std::byte*>(base_);
             const auto* const storage_ptr = bptr;
             const auto* const fixed_vector_ptr = storage_ptr;
-            const auto* const array_ptr =
-                std::next(fixed_vector_ptr, static_cast<difference_type>(sizeof(std::size_t)));
+            const auto* const array_ptr = std::next(
+                fixed_vector_ptr, static_cast<difference_type>(contiguous_array_offset()));
             return array_ptr;
         }
 
+        /**
+         * Offset of the array of tree nodes in the storage pool's fixed vector. The vector stores
+         * its size first, in the narrowest unsigned type that can hold the maximum size.
+         * Only valid for storage type 'FIXED_INDEX_CONTIGUOUS'.
+         */
+        [[nodiscard]] std::size_t contiguous_array_offset() const
+        {
+            return align_up(int_math::smallest_unsigned_integral_size_bytes(max_size_bytes_),
+                            std::max(elem_align_bytes_, index_size_bytes_));
+        }
+
         /**
          * Calculate the pointer to the storage pool's fixed vector and read the size value.
          * Only valid for storage type 'FIXED_INDEX_CONTIGUOUS'.
@@ -308,7 +384,17 @@ public:
             const auto* const bptr = reinterpret_cast<const std::byte*>(base_);
             const auto* const storage_ptr = bptr;
             const auto* const fixed_vector_ptr = storage_ptr;
-            return *reinterpret_cast<const std::size_t*>(fixed_vector_ptr);
+            switch (int_math::smallest_unsigned_integral_size_bytes(max_size_bytes_))
+            {
+            case sizeof(std::uint8_t):
+                return *reinterpret_cast<const std::uint8_t*>(fixed_vector_ptr);
+            case sizeof(std::uint16_t):
+                return *reinterpret_cast<const std::uint16_t*>(fixed_vector_ptr);
+            case sizeof(std::uint32_t):
+                return *reinterpret_cast<const std::uint32_t*>(fixed_vector_ptr);
+            default:
+                return *reinterpret_cast<const std::size_t*>(fixed_vector_ptr);
+            }
         }
 
         /**
@@ -322,7 +408,8 @@ public:
             {
             case StorageType::FIXED_INDEX_POOL:
                 // IndexOrValueStorage is a union containing a size_t (index) or the node itself.
-                return std::max(sizeof(std::size_t), node_size_bytes);
+                return align_up(std::max(sizeof(std::size_t), node_size_bytes),
+                                alignof(std::size_t));
 
             case StorageType::FIXED_INDEX_CONTIGUOUS:
                 return node_size_bytes;
@@ -338,33 +425,21 @@ public:
          */
         [[nodiscard]] std::size_t tree_node_size_bytes() const
         {
-            using fixed_red_black_tree_detail::CompactRedBlackTreeNode;
-            using fixed_red_black_tree_detail::DefaultRedBlackTreeNode;
-
-            /*
-             * Calculate the size of the tree node by calculating the compile-time size with a
-             * native pointer type as the Key, adding the size of the value type, subtracting the
-             * pointer size from the result and rounding up for alignment.
-             */
-            std::size_t base_node_size_bytes = 0;
-            switch (compactness_)
+            // Parent, left and right indices, plus the dedicated color if there is one
+            std::size_t links_end = links_offset() + (3 * index_size_bytes_);
+            if (compactness_ == Compactness::DEDICATED_COLOR)
             {
-            case Compactness::DEDICATED_COLOR:
-                base_node_size_bytes = sizeof(DefaultRedBlackTreeNode<uintptr_t>);
-                break;
-            case Compactness::EMBEDDED_COLOR:
-                base_node_size_bytes = sizeof(CompactRedBlackTreeNode<uintptr_t>);
-                break;
+                links_end += sizeof(fixed_red_black_tree_detail::NodeColor);
             }
 
-            return align_up(base_node_size_bytes - sizeof(uintptr_t) + elem_size_bytes_,
-                            sizeof(uintptr_t));
+            return align_up(links_end, std::max(elem_align_bytes_, index_size_bytes_));
         }
     };
 
 private:
     const std::byte* tree_ptr_;
     const std::size_t elem_size_bytes_;
+    const std::size_t elem_align_bytes_;
     const std::size_t max_size_bytes_;
     const Compactness compactness_;
     const StorageType storage_type_;
@@ -374,9 +449,13 @@ public:
                              std::size_t elem_size_bytes,
                              std::size_t max_size_bytes,
                              Compactness compactness,
-                             StorageType storage_type)
+                             StorageType storage_type,
+                             std::size_t elem_align_bytes = DERIVED_ALIGNMENT)
       : tree_ptr_{reinterpret_cast<const std::byte*>(tree_ptr)}
       , elem_size_bytes_{elem_size_bytes}
+      , elem_align_bytes_{elem_align_bytes != DERIVED_ALIGNMENT
+                              ? elem_align_bytes
+                              : default_elem_align_bytes(elem_size_bytes)}
       , max_size_bytes_{max_size_bytes}
       , compactness_{compactness}
       , storage_type_{storage_type}
@@ -385,13 +464,24 @@ public:
 
     [[nodiscard]] Iterator begin() const
     {
-        return Iterator(tree_ptr_, elem_size_bytes_, max_size_bytes_, compactness_, storage_type_);
+        return Iterator(tree_ptr_,
+                        elem_size_bytes_,
+                        max_size_bytes_,
+                        compactness_,
+                        storage_type_,
+                        false,
+                        elem_align_bytes_);
     }
 
     [[nodiscard]] Iterator end() const
     {
-        return Iterator(
-            tree_ptr_, elem_size_bytes_, max_size_bytes_, compactness_, storage_type_, true);
+        return Iterator(tree_ptr_,
+                        elem_size_bytes_,
+                        max_size_bytes_,
+                        compactness_,
+                        storage_type_,
+                        true,
+                        elem_align_bytes_);
     }
 
     [[nodiscard]] std::size_t size() const { return end().size(); }
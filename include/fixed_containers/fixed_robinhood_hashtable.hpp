@@ -1,13 +1,27 @@
 #pragma once
 
 #include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_vector.hpp"
 #include "fixed_containers/map_entry.hpp"
+#include "fixed_containers/memory.hpp"
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <ranges>
+#include <type_traits>
 #include <utility>
 
+#if !defined(FIXED_CONTAINERS_DISABLE_SIMD) &&                                           \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FIXED_CONTAINERS_ROBINHOOD_HASHTABLE_SSE2_PROBING
+#include <emmintrin.h>
+#endif
+
 // This is a modified version of the dense hashmap from https://github.com/martinus/unordered_dense,
 // reimplemented to exist nicely in the fixed-containers universe.
 
@@ -37,24 +51,32 @@
 namespace fixed_containers::fixed_robinhood_hashtable_detail
 {
 
-// TODO: Include a "giant bucket" to support > 2^24 elements
-struct Bucket
+// `DistAndFingerprintT` bounds how far a bucket can be from its ideal location, and therefore the
+// size of the table. See `Bucket` and `WideBucket` below.
+template <typename DistAndFingerprintT, std::uint32_t FINGERPRINT_BITS_ = 8>
+struct BasicBucket
 {
-    using DistAndFingerprintType = std::uint32_t;
+    static_assert(FINGERPRINT_BITS_ > 0 &&
+                      FINGERPRINT_BITS_ < std::numeric_limits<DistAndFingerprintT>::digits,
+                  "need bits for both the fingerprint and the distance");
+
+    using DistAndFingerprintType = DistAndFingerprintT;
     using ValueIndexType = std::uint32_t;
 
     // control how many bits to use for the hash fingerprint. The rest are used as the distance
     // between this element and its "ideal" location in the table
-    static constexpr DistAndFingerprintType FINGERPRINT_BITS = 8;
+    static constexpr DistAndFingerprintType FINGERPRINT_BITS = FINGERPRINT_BITS_;
 
-    static constexpr DistAndFingerprintType DIST_INC = 1U << FINGERPRINT_BITS;
+    static constexpr DistAndFingerprintType DIST_INC = DistAndFingerprintType{1}
+                                                       << FINGERPRINT_BITS;
     static constexpr DistAndFingerprintType FINGERPRINT_MASK = DIST_INC - 1;
 
     // we can only track a bucket this far away from its ideal location. In a pathological worst
     // case, every bucket is a collision so we can only guarantee correct behavior up to this bucket
     // count.
-    static constexpr std::size_t MAX_NUM_BUCKETS =
-        (1U << (sizeof(DistAndFingerprintType) * 8 - FINGERPRINT_BITS)) - 1;
+    static constexpr std::size_t MAX_NUM_BUCKETS = static_cast<std::size_t>((std::min)(
+        std::uint64_t{(std::numeric_limits<DistAndFingerprintType>::max)() >> FINGERPRINT_BITS},
+        std::uint64_t{(std::numeric_limits<std::size_t>::max)()}));
 
     DistAndFingerprintType dist_and_fingerprint_;
     ValueIndexType value_index_;
@@ -87,45 +109,280 @@ struct Bucket
         return dist_and_fingerprint - DIST_INC;
     }
 
-    [[nodiscard]] constexpr Bucket plus_dist() const
+    [[nodiscard]] constexpr BasicBucket plus_dist() const
     {
         return {.dist_and_fingerprint_ = increment_dist(dist_and_fingerprint_),
                 .value_index_ = value_index_};
     }
 
-    [[nodiscard]] constexpr Bucket minus_dist() const
+    [[nodiscard]] constexpr BasicBucket minus_dist() const
     {
         return {.dist_and_fingerprint_ = decrement_dist(dist_and_fingerprint_),
                 .value_index_ = value_index_};
     }
 };
 
+// The compact bucket: supports tables of up to 2^24 - 1 buckets.
+using Bucket = BasicBucket<std::uint32_t>;
+// The vectorized probe loads buckets as raw memory and relies on this layout
+static_assert(sizeof(Bucket) == 8 && offsetof(Bucket, dist_and_fingerprint_) == 0);
+
+// For larger tables. Twice the size of `Bucket` (including 4 bytes of padding), as the value index
+// stays 32-bit.
+using WideBucket = BasicBucket<std::uint64_t>;
+static_assert(sizeof(WideBucket) == 16);
+
+// More fingerprint bits leave fewer bits for the distance, so they lower the table size at which
+// the wide bucket becomes necessary.
+template <std::size_t TABLE_SIZE, std::uint32_t FINGERPRINT_BITS = 8>
+using BucketForTableSize = std::conditional_t<
+    (TABLE_SIZE <= BasicBucket<std::uint32_t, FINGERPRINT_BITS>::MAX_NUM_BUCKETS),
+    BasicBucket<std::uint32_t, FINGERPRINT_BITS>,
+    BasicBucket<std::uint64_t, FINGERPRINT_BITS>>;
+
+
+// Tuning policies trade memory for lookup speed, without changing the behavior of the table.
+// - `BUCKET_COUNT_PERCENT` is the number of buckets per 100 values of capacity, i.e. the inverse of
+//   the maximum load factor. Fewer buckets save memory, but lengthen the probe sequences. Only
+//   applies when the bucket count is `AUTO_BUCKET_COUNT`, see `resolve_bucket_count()`.
+// - `FINGERPRINT_BITS` is the number of hash bits stored in every bucket. Probing only calls
+//   `key_equal` on fingerprint matches, so more bits mean fewer calls (mostly on misses), at the
+//   cost of the bits left for the distance. See `BucketForTableSize`.
+template <std::size_t BUCKET_COUNT_PERCENT_ = 130, std::uint32_t FINGERPRINT_BITS_ = 8>
+struct HashtableTuning
+{
+    static_assert(BUCKET_COUNT_PERCENT_ >= 100, "need at least one bucket per value");
+
+    static constexpr std::size_t BUCKET_COUNT_PERCENT = BUCKET_COUNT_PERCENT_;
+    static constexpr std::uint32_t FINGERPRINT_BITS = FINGERPRINT_BITS_;
+
+    static constexpr std::size_t bucket_count(std::size_t value_count)
+    {
+        return (value_count * BUCKET_COUNT_PERCENT) / 100;
+    }
+};
+
+// Oversizes the bucket array by 30%, with 8-bit fingerprints
+using DefaultHashtableTuning = HashtableTuning<>;
+
+// Passed as the bucket count of the unordered containers to let the tuning policy derive it from
+// the maximum value count.
+inline constexpr std::size_t AUTO_BUCKET_COUNT = (std::numeric_limits<std::size_t>::max)();
+
+// The bucket count that the table is instantiated with. The containers resolve
+// `AUTO_BUCKET_COUNT` before it reaches `FixedRobinhoodHashtable`, and their default bucket count
+// (`default_bucket_count()`) is the one of `DefaultHashtableTuning`, so the default spellings
+// keep naming the same types.
+template <class Tuning>
+constexpr std::size_t resolve_bucket_count(std::size_t bucket_count, std::size_t value_count)
+{
+    return bucket_count == AUTO_BUCKET_COUNT ? Tuning::bucket_count(value_count) : bucket_count;
+}
+
+// An explicit bucket count leaves no room for the load factor of the tuning, so the two can't be
+// combined: a non-default load factor requires `AUTO_BUCKET_COUNT`.
+template <class Tuning>
+constexpr bool is_valid_bucket_count_for_tuning(std::size_t bucket_count)
+{
+    return bucket_count == AUTO_BUCKET_COUNT ||
+           Tuning::BUCKET_COUNT_PERCENT == DefaultHashtableTuning::BUCKET_COUNT_PERCENT;
+}
+
+// Bucket indexing policies map a hash to the bucket where its probe sequence starts. They are
+// selected at compile time and can also adjust the size of the bucket array they operate on.
+
+// Uses the requested bucket count as-is and reduces the hash with a modulo.
+struct ModuloBucketIndexing
+{
+    static constexpr std::size_t table_size(std::size_t bucket_count)
+    {
+        // 0 size is problematic because it leads to modulo 0 (undefined behavior)
+        return std::max<std::size_t>(1, bucket_count);
+    }
+
+    template <std::size_t TABLE_SIZE>
+    static constexpr std::uint64_t bucket_index_from_hash(std::uint64_t hash)
+    {
+        return hash % TABLE_SIZE;
+    }
+};
+
+// Rounds the bucket count up to a power of two, so the hash is reduced with a mask instead of a
+// 64-bit division. Trades up to 2x the bucket memory for the cheapest possible reduction.
+struct PowerOfTwoBucketIndexing
+{
+    static constexpr std::size_t table_size(std::size_t bucket_count)
+    {
+        return std::bit_ceil(std::max<std::size_t>(1, bucket_count));
+    }
+
+    template <std::size_t TABLE_SIZE>
+    static constexpr std::uint64_t bucket_index_from_hash(std::uint64_t hash)
+    {
+        static_assert(std::has_single_bit(TABLE_SIZE));
+        return hash & (TABLE_SIZE - 1);
+    }
+};
+
+// Lemire's "fastrange": maps the low 32 bits of the hash into [0, TABLE_SIZE) with a multiply and
+// a shift. Keeps the requested bucket count, at the cost of ignoring the upper bits of the hash.
+// https://lemire.me/blog/2016/06/27/a-fast-alternative-to-the-modulo-reduction/
+struct FastRangeBucketIndexing
+{
+    static constexpr std::size_t table_size(std::size_t bucket_count)
+    {
+        return std::max<std::size_t>(1, bucket_count);
+    }
+
+    template <std::size_t TABLE_SIZE>
+    static constexpr std::uint64_t bucket_index_from_hash(std::uint64_t hash)
+    {
+        static_assert(TABLE_SIZE <= (std::uint64_t{1} << 32U));
+        return ((hash & 0xFFFFFFFFULL) * TABLE_SIZE) >> 32U;
+    }
+};
+
+// Values packed in [0, size()), in the same layout as a `FixedVector`. Erasing moves the last value
+// into the erased slot, so indices are only stable until the next erasure. Exposes the subset of
+// the `FixedDoublyLinkedList` interface that the hashtable uses.
+template <typename T, std::size_t MAXIMUM_SIZE, typename IndexType = std::size_t>
+class FixedDenseValueStorage
+{
+    static_assert(MAXIMUM_SIZE + 1 <= (std::numeric_limits<IndexType>::max)(),
+                  "must be able to index MAXIMUM_SIZE+1 elements with IndexType");
+
+public:
+    static constexpr IndexType NULL_INDEX = MAXIMUM_SIZE;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    FixedVector<T, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{};
+
+public:
+    [[nodiscard]] constexpr IndexType size() const noexcept
+    {
+        return static_cast<IndexType>(values().size());
+    }
+    [[nodiscard]] constexpr bool full() const noexcept { return values().full(); }
+
+    constexpr void clear() noexcept { values().clear(); }
+
+    [[nodiscard]] constexpr const T& at(const IndexType index) const { return values()[index]; }
+    constexpr T& at(const IndexType index) { return values()[index]; }
+
+    [[nodiscard]] constexpr IndexType front_index() const { return index_or_null(0); }
+    [[nodiscard]] constexpr IndexType back_index() const
+    {
+        return values().empty() ? NULL_INDEX : static_cast<IndexType>(size() - 1);
+    }
+
+    [[nodiscard]] constexpr IndexType next_of(IndexType index) const
+    {
+        return index_or_null(static_cast<IndexType>(index + 1));
+    }
+    [[nodiscard]] constexpr IndexType prev_of(IndexType index) const
+    {
+        // The predecessor of the end sentinel is the last value
+        const IndexType bound = (std::min)(index, size());
+        return bound == 0 ? NULL_INDEX : static_cast<IndexType>(bound - 1);
+    }
+
+    template <typename... Args>
+    constexpr IndexType emplace_back_and_return_index(Args&&... args)
+    {
+        values().emplace_back(std::forward<Args>(args)...);
+        return static_cast<IndexType>(size() - 1);
+    }
+
+    // The last value takes the place of the erased one, and is the next one to be iterated
+    constexpr IndexType delete_at_and_return_next_index(IndexType idx)
+    {
+        const auto last = static_cast<IndexType>(size() - 1);
+        if (idx != last)
+        {
+            memory::destroy_at_address_of(values()[idx]);
+            memory::construct_at_address_of(values()[idx], std::move(values()[last]));
+        }
+        values().pop_back();
+        return index_or_null(idx);
+    }
+
+private:
+    [[nodiscard]] constexpr IndexType index_or_null(IndexType index) const
+    {
+        return index < size() ? index : NULL_INDEX;
+    }
+
+    [[nodiscard]] constexpr const FixedVector<T, MAXIMUM_SIZE>& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr FixedVector<T, MAXIMUM_SIZE>& values()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+};
+
+// Value storage policies decide how the values that the buckets point to are laid out.
+
+// Values live in a doubly-linked list. Indices (and therefore iterators) to values are stable
+// across erasures of other values, at the cost of the list's per-value links and freelist.
+struct LinkedListValueStorage
+{
+    static constexpr bool RELOCATES_ON_ERASE = false;
+
+    template <typename T, std::size_t CAPACITY, typename IndexType>
+    using Type = fixed_doubly_linked_list_detail::FixedDoublyLinkedList<T, CAPACITY, IndexType>;
+};
+
+// Values are packed in a dense array: less memory, and iteration is a linear scan. Erasing a value
+// moves the last value into its slot (and repoints that value's bucket), so an erasure invalidates
+// iterators to the last value. Erasing while iterating still visits every remaining value.
+struct DenseValueStorage
+{
+    static constexpr bool RELOCATES_ON_ERASE = true;
+
+    template <typename T, std::size_t CAPACITY, typename IndexType>
+    using Type = FixedDenseValueStorage<T, CAPACITY, IndexType>;
+};
+
 template <typename K,
           typename V,
           std::size_t MAXIMUM_VALUE_COUNT,
           std::size_t BUCKET_COUNT,
           class Hash,
-          class KeyEqual>
+          class KeyEqual,
+          class BucketIndexing = ModuloBucketIndexing,
+          class ValueStorage = LinkedListValueStorage,
+          class Tuning = DefaultHashtableTuning>
 class FixedRobinhoodHashtable
 {
 public:
     using PairType = MapEntry<K, V>;
     using HashType = Hash;
     using KeyEqualType = KeyEqual;
-    using SizeType = Bucket::ValueIndexType;
+    // Lookups by any key type (not just `K`) need both the hash and the equality to accept it
+    static constexpr bool HAS_TRANSPARENT_LOOKUP =
+        IsTransparent<Hash> && IsTransparent<KeyEqual>;
+
+    static constexpr std::size_t CAPACITY = MAXIMUM_VALUE_COUNT;
+    static constexpr std::size_t INTERNAL_TABLE_SIZE = BucketIndexing::table_size(BUCKET_COUNT);
 
+    // Small tables keep the compact bucket, large ones switch to the wide one
+    using BucketType = BucketForTableSize<INTERNAL_TABLE_SIZE, Tuning::FINGERPRINT_BITS>;
+    using SizeType = typename BucketType::ValueIndexType;
+    using DistAndFingerprintType = typename BucketType::DistAndFingerprintType;
+
+    static_assert(BUCKET_COUNT != AUTO_BUCKET_COUNT,
+                  "AUTO_BUCKET_COUNT must be resolved with resolve_bucket_count()");
     static_assert(MAXIMUM_VALUE_COUNT <= BUCKET_COUNT,
                   "need at least enough buckets to point to every value in array");
-    static_assert(BUCKET_COUNT <= Bucket::MAX_NUM_BUCKETS,
+    static_assert(INTERNAL_TABLE_SIZE <= BucketType::MAX_NUM_BUCKETS &&
+                      INTERNAL_TABLE_SIZE <= (std::numeric_limits<SizeType>::max)(),
                   "specified too many buckets for the current bucket memory layout");
 
-    static constexpr std::size_t CAPACITY = MAXIMUM_VALUE_COUNT;
-    // 0 size is problematic because it leads to modulo 0 (undefined behavior)
-    static constexpr std::size_t INTERNAL_TABLE_SIZE = std::max<std::size_t>(1, BUCKET_COUNT);
-
-    fixed_doubly_linked_list_detail::FixedDoublyLinkedList<PairType, CAPACITY, SizeType>
+    typename ValueStorage::template Type<PairType, CAPACITY, SizeType>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_{};
-    std::array<Bucket, INTERNAL_TABLE_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_{};
+    std::array<BucketType, INTERNAL_TABLE_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_{};
 
     Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
     KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{};
@@ -136,18 +393,18 @@ public:
         // we need a dist_and_fingerprint for emplace(), but not for checks where the value exists.
         // We make this field pull double duty by setting it to 0 for keys that exist, but the valid
         // dist_and_fingerprint for those that don't.
-        Bucket::DistAndFingerprintType dist_and_fingerprint;
+        DistAndFingerprintType dist_and_fingerprint;
     };
 
     using OpaqueIteratedType = SizeType;
 
     ////////////////////// helper functions
 public:
-    [[nodiscard]] constexpr Bucket& bucket_at(SizeType idx)
+    [[nodiscard]] constexpr BucketType& bucket_at(SizeType idx)
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_[idx];
     }
-    [[nodiscard]] constexpr const Bucket& bucket_at(SizeType idx) const
+    [[nodiscard]] constexpr const BucketType& bucket_at(SizeType idx) const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_[idx];
     }
@@ -171,8 +428,9 @@ public:
         // would tend to be totally useless as it encodes information that the resident index of the
         // bucket also encodes. This does not restrict the size of the table because we store the
         // value_index in 32 bits, so the 56 left in this hash are plenty for our needs.
-        const std::uint64_t shifted_hash = hash >> Bucket::FINGERPRINT_BITS;
-        return static_cast<SizeType>(shifted_hash % INTERNAL_TABLE_SIZE);
+        const std::uint64_t shifted_hash = hash >> BucketType::FINGERPRINT_BITS;
+        return static_cast<SizeType>(
+            BucketIndexing::template bucket_index_from_hash<INTERNAL_TABLE_SIZE>(shifted_hash));
     }
 
     [[nodiscard]] static constexpr SizeType next_bucket_index(SizeType bucket_index)
@@ -184,7 +442,7 @@ public:
         return 0;
     }
 
-    constexpr void place_and_shift_up(Bucket bucket, SizeType table_loc)
+    constexpr void place_and_shift_up(BucketType bucket, SizeType table_loc)
     {
         // replace the current bucket at the location with the given bucket, bubbling up elements
         // until we hit an empty one
@@ -203,7 +461,7 @@ public:
 
         // shift down until either empty or an element with correct spot is found
         SizeType next_loc = next_bucket_index(table_loc);
-        while (bucket_at(next_loc).dist_and_fingerprint_ >= Bucket::DIST_INC * 2)
+        while (bucket_at(next_loc).dist_and_fingerprint_ >= BucketType::DIST_INC * 2)
         {
             bucket_at(table_loc) = bucket_at(next_loc).minus_dist();
             table_loc = std::exchange(next_loc, next_bucket_index(next_loc));
@@ -211,13 +469,30 @@ public:
         bucket_at(table_loc) = {};
     }
 
-    constexpr SizeType erase_value(SizeType value_index)
+    // Finds the bucket of the (resident) value at `value_index`. Follows the probe sequence of the
+    // value comparing indices, so `key_equal` is never called. Empty buckets on the way are
+    // skipped rather than ending the search, which lets `clear()` empty buckets as it goes.
+    [[nodiscard]] constexpr SizeType bucket_index_of_value(SizeType value_index) const
     {
-        const SizeType next =
-            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.delete_at_and_return_next_index(
-                value_index);
+        SizeType table_loc = bucket_index_from_hash(hash(key_at(value_index)));
+        while (bucket_at(table_loc).value_index_ != value_index ||
+               bucket_at(table_loc).dist_and_fingerprint_ == 0)
+        {
+            table_loc = next_bucket_index(table_loc);
+        }
+        return table_loc;
+    }
+
+    // Points the bucket of the (resident) value at `from_value_index` to `to_value_index`.
+    constexpr void repoint_bucket(SizeType from_value_index, SizeType to_value_index)
+    {
+        bucket_at(bucket_index_of_value(from_value_index)).value_index_ = to_value_index;
+    }
 
-        return next;
+    constexpr SizeType erase_value(SizeType value_index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.delete_at_and_return_next_index(
+            value_index);
     }
 
     //////////////////////// Common Interface Impl
@@ -272,13 +547,15 @@ public:
         return bucket_at(index.bucket_index).value_index_;
     }
 
-    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const K& key) const
+    // Continues the probe sequence of `key`, starting at `table_loc` where the key would have
+    // `dist_and_fingerprint` if it were resident there.
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType probe_scalar(
+        const Key& key,
+        SizeType table_loc,
+        DistAndFingerprintType dist_and_fingerprint) const
     {
-        const std::uint64_t key_hash = hash(key);
-        Bucket::DistAndFingerprintType dist_and_fingerprint =
-            Bucket::dist_and_fingerprint_from_hash(key_hash);
-        SizeType table_loc = bucket_index_from_hash(key_hash);
-        Bucket bucket = bucket_at(table_loc);
+        BucketType bucket = bucket_at(table_loc);
 
         while (true)
         {
@@ -295,12 +572,176 @@ public:
             {
                 return {table_loc, dist_and_fingerprint};
             }
-            dist_and_fingerprint = Bucket::increment_dist(dist_and_fingerprint);
+            dist_and_fingerprint = BucketType::increment_dist(dist_and_fingerprint);
             table_loc = next_bucket_index(table_loc);
             bucket = bucket_at(table_loc);
         }
     }
 
+#if defined(FIXED_CONTAINERS_ROBINHOOD_HASHTABLE_SSE2_PROBING)
+    // Same as `probe_scalar()`, but checks 4 consecutive buckets at a time: the expected
+    // dist_and_fingerprint of each of them is compared in parallel, and `key_equal` is only called
+    // for the fingerprint matches that come before the Robin Hood termination condition. Falls
+    // back to `probe_scalar()` when a group would straddle the end of the table. Only for compact
+    // buckets, whose dist_and_fingerprint fits in a 32-bit lane.
+    template <typename Key>
+    [[nodiscard]] OpaqueIndexType probe_sse2(
+        const Key& key,
+        SizeType table_loc,
+        DistAndFingerprintType dist_and_fingerprint) const
+    {
+        static_assert(std::is_same_v<DistAndFingerprintType, std::uint32_t>,
+                      "assumes 32-bit dist_and_fingerprint");
+        static constexpr SizeType GROUP_SIZE = 4;
+        const __m128i lane_offsets = _mm_setr_epi32(0,
+                                                    static_cast<int>(BucketType::DIST_INC),
+                                                    static_cast<int>(2 * BucketType::DIST_INC),
+                                                    static_cast<int>(3 * BucketType::DIST_INC));
+        // SSE2 only has signed comparisons, flipping the sign bit makes them unsigned
+        const __m128i sign_bit = _mm_set1_epi32(static_cast<int>(0x80000000U));
+
+        while (table_loc + GROUP_SIZE <= INTERNAL_TABLE_SIZE)
+        {
+            // Each load covers two buckets: [dist_and_fingerprint, value_index] x 2
+            const __m128i first_pair = _mm_loadu_si128(
+                static_cast<const __m128i*>(static_cast<const void*>(&bucket_at(table_loc))));
+            const __m128i second_pair = _mm_loadu_si128(
+                static_cast<const __m128i*>(static_cast<const void*>(&bucket_at(table_loc + 2))));
+            // Keep the even 32-bit lanes of both, i.e. the 4 dist_and_fingerprint values
+            const __m128i actual = _mm_castps_si128(_mm_shuffle_ps(
+                _mm_castsi128_ps(first_pair), _mm_castsi128_ps(second_pair), 0x88));
+            const __m128i expected = _mm_add_epi32(
+                _mm_set1_epi32(static_cast<int>(dist_and_fingerprint)), lane_offsets);
+
+            const auto matches = static_cast<unsigned>(
+                _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(actual, expected))));
+            const auto terminations = static_cast<unsigned>(_mm_movemask_ps(
+                _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_xor_si128(expected, sign_bit),
+                                                 _mm_xor_si128(actual, sign_bit)))));
+
+            // `terminations | 0b10000` caps the lane at GROUP_SIZE when there is no termination
+            const auto terminating_lane =
+                static_cast<SizeType>(std::countr_zero(terminations | (1U << GROUP_SIZE)));
+            for (unsigned candidates = matches & ((1U << terminating_lane) - 1); candidates != 0;
+                 candidates &= candidates - 1)
+            {
+                const auto lane = static_cast<SizeType>(std::countr_zero(candidates));
+                if (key_equal(key, key_at(bucket_at(table_loc + lane).value_index_)))
+                {
+                    return {table_loc + lane, 0};
+                }
+            }
+            if (terminating_lane < GROUP_SIZE)
+            {
+                return {table_loc + terminating_lane,
+                        dist_and_fingerprint + (terminating_lane * BucketType::DIST_INC)};
+            }
+
+            dist_and_fingerprint += GROUP_SIZE * BucketType::DIST_INC;
+            table_loc += GROUP_SIZE;
+            if (table_loc == INTERNAL_TABLE_SIZE)
+            {
+                table_loc = 0;
+            }
+        }
+
+        return probe_scalar(key, table_loc, dist_and_fingerprint);
+    }
+#endif
+
+    // `Key` is either `K`, or any type that the (transparent) `Hash` and `KeyEqual` accept.
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const Key& key) const
+    {
+        return opaque_index_from_hash(key, hash(key));
+    }
+
+    // Number of lookups that `for_each_opaque_index_of()` keeps in flight. A key's value is
+    // prefetched half a window after its bucket, and its probe is resolved a full window after.
+    static constexpr std::size_t LOOKUP_WINDOW_SIZE = 16;
+    static constexpr std::size_t VALUE_PREFETCH_DISTANCE = LOOKUP_WINDOW_SIZE / 2;
+
+    // Calls `func(i, opaque_index_of(keys[i]))` for every key of the contiguous range `keys`.
+    // Every key is hashed once, when it enters the window; the starting bucket derived from that
+    // hash is kept until the probe is resolved. While one key is being resolved, the buckets and
+    // values of the keys behind it are being fetched, so their cache misses overlap.
+    template <std::ranges::contiguous_range Keys, typename Func>
+        requires std::same_as<std::ranges::range_value_t<Keys>, K>
+    constexpr void for_each_opaque_index_of(const Keys& keys, Func&& func) const
+    {
+        struct InFlightLookup
+        {
+            SizeType bucket_index{};
+            DistAndFingerprintType dist_and_fingerprint{};
+        };
+
+        const K* const key_data = std::ranges::data(keys);
+        const std::size_t key_count = std::ranges::size(keys);
+        std::array<InFlightLookup, LOOKUP_WINDOW_SIZE> in_flight{};
+        for (std::size_t i = 0; i < key_count + LOOKUP_WINDOW_SIZE; i++)
+        {
+            const std::size_t slot = i % LOOKUP_WINDOW_SIZE;
+            if (i >= LOOKUP_WINDOW_SIZE)
+            {
+                const std::size_t resolved = i - LOOKUP_WINDOW_SIZE;
+                func(resolved,
+                     probe(key_data[resolved],
+                           in_flight[slot].bucket_index,
+                           in_flight[slot].dist_and_fingerprint));
+            }
+            if (i >= VALUE_PREFETCH_DISTANCE && i - VALUE_PREFETCH_DISTANCE < key_count)
+            {
+                const InFlightLookup& lookup =
+                    in_flight[(i - VALUE_PREFETCH_DISTANCE) % LOOKUP_WINDOW_SIZE];
+                const BucketType& bucket = bucket_at(lookup.bucket_index);
+                if (bucket.dist_and_fingerprint_ != 0)
+                {
+                    memory::prefetch_for_read(
+                        IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(bucket.value_index_));
+                }
+            }
+            if (i < key_count)
+            {
+                const std::uint64_t key_hash = hash(key_data[i]);
+                in_flight[slot] = {bucket_index_from_hash(key_hash),
+                                   BucketType::dist_and_fingerprint_from_hash(key_hash)};
+                memory::prefetch_for_read(bucket_at(in_flight[slot].bucket_index));
+            }
+        }
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_from_hash(const Key& key,
+                                                                   std::uint64_t key_hash) const
+    {
+        return probe(key,
+                     bucket_index_from_hash(key_hash),
+                     BucketType::dist_and_fingerprint_from_hash(key_hash));
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType probe(
+        const Key& key, SizeType table_loc, DistAndFingerprintType dist_and_fingerprint) const
+    {
+        // An empty table misses at its home bucket. Checking this up front also lets the compiler
+        // see that lookups in a zero-capacity or freshly constructed table never reach a value.
+        if (CAPACITY == 0 || size() == 0)
+        {
+            return {table_loc, dist_and_fingerprint};
+        }
+
+#if defined(FIXED_CONTAINERS_ROBINHOOD_HASHTABLE_SSE2_PROBING)
+        if constexpr (std::is_same_v<DistAndFingerprintType, std::uint32_t>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return probe_sse2(key, table_loc, dist_and_fingerprint);
+            }
+        }
+#endif
+        return probe_scalar(key, table_loc, dist_and_fingerprint);
+    }
+
     [[nodiscard]] constexpr bool exists(const OpaqueIndexType& index) const
     {
         // TODO: should we check if the index makes sense/points to a real place?
@@ -330,7 +771,7 @@ public:
 
         // place the bucket at the correct location
         place_and_shift_up(
-            Bucket{index.dist_and_fingerprint, static_cast<std::uint32_t>(value_loc)},
+            BucketType{index.dist_and_fingerprint, static_cast<SizeType>(value_loc)},
             index.bucket_index);
         return {index.bucket_index, 0};
     }
@@ -340,6 +781,15 @@ public:
         const SizeType value_index = bucket_at(index.bucket_index).value_index_;
 
         erase_bucket(index);
+        if constexpr (ValueStorage::RELOCATES_ON_ERASE)
+        {
+            // The last value is about to be moved into the erased slot
+            const auto last_index = static_cast<SizeType>(size() - 1);
+            if (value_index != last_index)
+            {
+                repoint_bucket(last_index, value_index);
+            }
+        }
         const SizeType next_index = erase_value(value_index);
 
         return next_index;
@@ -348,16 +798,57 @@ public:
     constexpr OpaqueIteratedType erase_range(const OpaqueIteratedType& start_value_index,
                                              const OpaqueIteratedType& end_value_index)
     {
-        SizeType cur_index = start_value_index;
-        while (cur_index != end_value_index)
+        if constexpr (ValueStorage::RELOCATES_ON_ERASE)
         {
-            cur_index = erase(opaque_index_of(key_at(cur_index)));
+            // Erase back to front, so the values moved into the range come from past its end.
+            // Afterwards, the values that followed the range are the ones at [start, size()).
+            // `invalid_index()` is past every valid index, so clamping maps it to `size()`.
+            const auto current_size = static_cast<SizeType>(size());
+            const SizeType start_index = (std::min)(start_value_index, current_size);
+            SizeType cur_index = (std::min)(end_value_index, current_size);
+            while (cur_index != start_index)
+            {
+                cur_index--;
+                erase(opaque_index_of(key_at(cur_index)));
+            }
+            return start_index < size() ? start_index : invalid_index();
         }
+        else
+        {
+            SizeType cur_index = start_value_index;
+            while (cur_index != end_value_index)
+            {
+                cur_index = erase(opaque_index_of(key_at(cur_index)));
+            }
 
-        return end_value_index;
+            return end_value_index;
+        }
     }
 
-    constexpr void clear() { erase_range(begin_index(), end_index()); }
+    // `clear()` looks up the bucket of each value while there are fewer values than this fraction
+    // of the buckets, and zeroes the whole bucket array otherwise.
+    static constexpr std::size_t SPARSE_CLEAR_BUCKETS_PER_VALUE = 16;
+
+    // Every bucket is emptied, so unlike `erase_range()` nothing is shifted down. A sparsely
+    // filled table only zeroes its occupied buckets, found with `bucket_index_of_value()`; a
+    // denser one zeroes the bucket array wholesale. Then the value storage destroys its values in
+    // a single pass, which for trivially destructible values only returns their slots.
+    constexpr void clear()
+    {
+        if (size() * SPARSE_CLEAR_BUCKETS_PER_VALUE < INTERNAL_TABLE_SIZE)
+        {
+            for (SizeType value_index = begin_index(); value_index != end_index();
+                 value_index = next_of(value_index))
+            {
+                bucket_at(bucket_index_of_value(value_index)) = {};
+            }
+        }
+        else
+        {
+            std::ranges::fill(IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_, BucketType{});
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.clear();
+    }
 
 public:
     constexpr FixedRobinhoodHashtable() = default;
@@ -393,10 +884,8 @@ public:
 
 constexpr std::size_t default_bucket_count(std::size_t value_count)
 {
-    // oversize the bucket array by 30%
-    // TODO: think about the oversize percentage
-    // TODO: round to a nearby power of 2 to improve modulus performance
-    return (value_count * 130) / 100;
+    // Note: `PowerOfTwoBucketIndexing` further rounds this up to a power of 2
+    return DefaultHashtableTuning::bucket_count(value_count);
 }
 
 }  // namespace fixed_containers::fixed_robinhood_hashtable_detail
@@ -7,12 +7,15 @@
 #include "fixed_containers/fixed_red_black_tree.hpp"
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/set_operations.hpp"
+#include "fixed_containers/sorted_unique.hpp"
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <memory>
 
 namespace fixed_containers
@@ -36,7 +39,9 @@ template <class K,
                     ,
                     std::size_t>
           typename StorageTemplate = FixedIndexBasedPoolStorage,
-          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION =
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::NONE>
 class FixedSet
 {
 public:
@@ -46,13 +51,15 @@ public:
     using reference = const_reference;
     using const_pointer = std::add_pointer_t<const_reference>;
     using pointer = const_pointer;
+    using key_compare = Compare;
+    using value_compare = Compare;
 
 private:
     using NodeIndex = fixed_red_black_tree_detail::NodeIndex;
     using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
     static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
     using Tree = fixed_red_black_tree_detail::
-        FixedRedBlackTreeSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+        FixedRedBlackTreeSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, AUGMENTATION>;
 
     class ReferenceProvider
     {
@@ -156,6 +163,18 @@ public:
         insert(first, last, loc);
     }
 
+    template <InputIterator InputIt>
+    constexpr FixedSet(
+        std_transition::sorted_unique_t /*tag*/,
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedSet{comparator}
+    {
+        insert(std_transition::sorted_unique, first, last, loc);
+    }
+
     constexpr FixedSet(std::initializer_list<value_type> list,
                        const Compare& comparator = {},
                        const std_transition::source_location& loc =
@@ -192,8 +211,48 @@ public:
     [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
 
+    [[nodiscard]] constexpr key_compare key_comp() const { return tree().key_comp(); }
+    [[nodiscard]] constexpr value_compare value_comp() const { return key_comp(); }
+
+    // Moves the keys of `source` that are not in this set over, like std::set::merge(). Both sets
+    // are walked in order and every key is inserted next to its successor, so nothing is searched
+    // for from the root. The keys are copied, as `source` only hands out const references to them.
+    template <class OtherFixedSet>
+        requires set_operations_detail::SupportsSetOperations<FixedSet, OtherFixedSet>
+    constexpr void merge(OtherFixedSet& source,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current())
+    {
+        if (static_cast<const void*>(this) == static_cast<const void*>(std::addressof(source)))
+        {
+            return;
+        }
+
+        const key_compare& comparator = tree().key_comp();
+        const_iterator hint = cbegin();
+        for (auto it = source.cbegin(); it != source.cend();)
+        {
+            while (hint != cend() && comparator(*hint, *it))
+            {
+                ++hint;
+            }
+            if (hint != cend() && !comparator(*it, *hint))
+            {
+                ++it;
+                continue;
+            }
+            this->insert(hint, *it, loc);
+            it = source.erase(it);
+        }
+    }
+
     constexpr void clear() noexcept { tree().clear(); }
 
+    // Moves the keys around so that they are laid out in memory in iteration order, which turns
+    // iteration and range scans into sequential reads once churn has scattered them. This is O(N)
+    // and invalidates all iterators and references.
+    constexpr void compact() { tree().compact(); }
+
     constexpr std::pair<const_iterator, bool> insert(
         const K& value,
         const std_transition::source_location& loc =
@@ -224,19 +283,37 @@ public:
         tree().insert_new_at(np_idxs, std::move(value));
         return {create_const_iterator(np_idxs.i), true};
     }
-    constexpr const_iterator insert(const_iterator /*hint*/,
+    constexpr const_iterator insert(const_iterator hint,
                                     const K& key,
                                     const std_transition::source_location& loc =
                                         std_transition::source_location::current()) noexcept
     {
-        return insert(key, loc).first;
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_const_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, key);
+        return create_const_iterator(np_idxs.i);
     }
-    constexpr const_iterator insert(const_iterator /*hint*/,
+    constexpr const_iterator insert(const_iterator hint,
                                     K&& key,
                                     const std_transition::source_location& loc =
                                         std_transition::source_location::current()) noexcept
     {
-        return insert(std::move(key), loc).first;
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent_near(index_of_hint(hint), key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_const_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(key));
+        return create_const_iterator(np_idxs.i);
     }
 
     template <InputIterator InputIt>
@@ -250,6 +327,43 @@ public:
             this->insert(*first, loc);
         }
     }
+    // The range must be sorted with no equivalent keys. When the set is empty and the range is
+    // multi-pass, the tree is built directly in O(N) without comparing any keys.
+    template <InputIterator InputIt>
+    constexpr void insert(std_transition::sorted_unique_t /*tag*/,
+                          InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            if (empty())
+            {
+                const auto count = static_cast<std::size_t>(std::distance(first, last));
+                if (preconditions::test(count <= MAXIMUM_SIZE))
+                {
+                    CheckingType::length_error(count, loc);
+                }
+                tree().build_from_sorted_unique(count,
+                                                [&first](auto& tree_storage)
+                                                {
+                                                    auto&& entry = *first;
+                                                    std::advance(first, 1);
+                                                    return tree_storage.emplace_and_return_index(
+                                                        std::forward<decltype(entry)>(entry));
+                                                });
+                return;
+            }
+        }
+
+        // Each key goes right before the successor of the previous one, or at the end
+        const_iterator hint = cend();
+        for (; first != last; std::advance(first, 1))
+        {
+            hint = std::next(this->insert(hint, *first, loc));
+        }
+    }
     constexpr void insert(std::initializer_list<value_type> list,
                           const std_transition::source_location& loc =
                               std_transition::source_location::current()) noexcept
@@ -378,6 +492,66 @@ public:
         return equal_range_impl(np_idxs);
     }
 
+    // Order statistics, available when the nodes are augmented with
+    // `RedBlackTreeNodeAugmentation::SUBTREE_SIZE`. These are all O(log N).
+
+    // Returns the entry with `n` entries before it, or end() if `n >= size()`.
+    [[nodiscard]] constexpr const_iterator nth(const size_type n) const noexcept
+        requires Tree::HAS_SUBTREE_SIZE
+    {
+        return create_const_iterator(tree().index_of_nth(n));
+    }
+
+    // Returns the number of entries with a key less than `key`, i.e. the position of
+    // `lower_bound(key)`.
+    [[nodiscard]] constexpr size_type rank(const K& key) const noexcept
+        requires Tree::HAS_SUBTREE_SIZE
+    {
+        return tree().rank_of(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr size_type rank(const K0& key) const noexcept
+        requires IsTransparent<Compare> && Tree::HAS_SUBTREE_SIZE
+    {
+        return tree().rank_of(key);
+    }
+
+    // Returns the number of entries with a key in [low, high).
+    [[nodiscard]] constexpr size_type count_range(const K& low, const K& high) const noexcept
+        requires Tree::HAS_SUBTREE_SIZE
+    {
+        return count_range_impl(low, high);
+    }
+    template <class K0, class K1>
+    [[nodiscard]] constexpr size_type count_range(const K0& low, const K1& high) const noexcept
+        requires IsTransparent<Compare> && Tree::HAS_SUBTREE_SIZE
+    {
+        return count_range_impl(low, high);
+    }
+
+    // Interval queries, available when the nodes are augmented with
+    // `RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT`, see `FixedIntervalSet`. `fn` is called
+    // with an iterator to every matching entry, in order, and must not insert or erase entries.
+    // Every match is found in O(log N).
+
+    // Calls `fn` for every entry that contains `point`.
+    template <class P, class Fn>
+    constexpr void for_each_containing(const P& point, Fn&& fn) const
+        requires Tree::HAS_MAX_HIGH_ENDPOINT
+    {
+        tree().for_each_index_containing(
+            point, [this, &fn](const NodeIndex& index) { fn(create_const_iterator(index)); });
+    }
+
+    // Calls `fn` for every entry that overlaps `interval`.
+    template <class Fn>
+    constexpr void for_each_overlapping(const K& interval, Fn&& fn) const
+        requires Tree::HAS_MAX_HIGH_ENDPOINT
+    {
+        tree().for_each_index_overlapping(
+            interval, [this, &fn](const NodeIndex& index) { fn(create_const_iterator(index)); });
+    }
+
     template <std::size_t MAXIMUM_SIZE_2,
               class Compare2,
               fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
@@ -386,10 +560,15 @@ public:
                         ,
                         std::size_t>
               typename StorageTemplate2,
-              customize::SetChecking<K> CheckingType2>
-    [[nodiscard]] constexpr bool operator==(
-        const FixedSet<K, MAXIMUM_SIZE_2, Compare2, COMPACTNESS_2, StorageTemplate2, CheckingType2>&
-            other) const
+              customize::SetChecking<K> CheckingType2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION_2>
+    [[nodiscard]] constexpr bool operator==(const FixedSet<K,
+                                                           MAXIMUM_SIZE_2,
+                                                           Compare2,
+                                                           COMPACTNESS_2,
+                                                           StorageTemplate2,
+                                                           CheckingType2,
+                                                           AUGMENTATION_2>& other) const
     {
         if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
         {
@@ -410,10 +589,15 @@ public:
                         ,
                         std::size_t>
               typename StorageTemplate2,
-              customize::SetChecking<K> CheckingType2>
-    constexpr auto operator<=>(
-        const FixedSet<K, MAXIMUM_SIZE_2, Compare2, COMPACTNESS_2, StorageTemplate2, CheckingType2>&
-            other) const
+              customize::SetChecking<K> CheckingType2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION_2>
+    constexpr auto operator<=>(const FixedSet<K,
+                                              MAXIMUM_SIZE_2,
+                                              Compare2,
+                                              COMPACTNESS_2,
+                                              StorageTemplate2,
+                                              CheckingType2,
+                                              AUGMENTATION_2>& other) const
     {
         return algorithm::lexicographical_compare_three_way(
             cbegin(), cend(), other.cbegin(), other.cend());
@@ -459,6 +643,19 @@ private:
     {
         return pos.template private_reference_provider<ReferenceProvider>().current_index();
     }
+
+    [[nodiscard]] constexpr NodeIndex index_of_hint(const_iterator hint)
+    {
+        return hint == cend() ? NULL_INDEX : get_node_index_from_iterator(hint);
+    }
+
+    template <class K0, class K1>
+    [[nodiscard]] constexpr size_type count_range_impl(const K0& low, const K1& high) const noexcept
+    {
+        const size_type low_rank = tree().rank_of(low);
+        const size_type high_rank = tree().rank_of(high);
+        return high_rank > low_rank ? high_rank - low_rank : 0;
+    }
 };
 
 template <class K,
@@ -470,9 +667,15 @@ here. clang accepts it */
                     ,
                     std::size_t>
           typename StorageTemplate,
-          customize::SetChecking<K> CheckingType>
-[[nodiscard]] constexpr bool is_full(
-    const FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& container)
+          customize::SetChecking<K> CheckingType,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION>
+[[nodiscard]] constexpr bool is_full(const FixedSet<K,
+                                                    MAXIMUM_SIZE,
+                                                    Compare,
+                                                    COMPACTNESS,
+                                                    StorageTemplate,
+                                                    CheckingType,
+                                                    AUGMENTATION>& container)
 {
     return container.size() >= container.max_size();
 }
@@ -487,12 +690,23 @@ here. clang accepts it */
                     std::size_t>
           typename StorageTemplate,
           customize::SetChecking<K> CheckingType,
+          fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION,
           class Predicate>
-constexpr typename FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>::
-    size_type
-    erase_if(
-        FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& container,
-        Predicate predicate)
+constexpr typename FixedSet<K,
+                            MAXIMUM_SIZE,
+                            Compare,
+                            COMPACTNESS,
+                            StorageTemplate,
+                            CheckingType,
+                            AUGMENTATION>::size_type
+erase_if(FixedSet<K,
+                  MAXIMUM_SIZE,
+                  Compare,
+                  COMPACTNESS,
+                  StorageTemplate,
+                  CheckingType,
+                  AUGMENTATION>& container,
+         Predicate predicate)
 {
     return erase_if_detail::erase_if_impl(container, predicate);
 }
@@ -589,10 +803,15 @@ here. clang accepts it */
               ,
               std::size_t>
     typename StorageTemplate,
-    fixed_containers::customize::SetChecking<K> CheckingType>
-struct tuple_size<
-    fixed_containers::
-        FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>>
+    fixed_containers::customize::SetChecking<K> CheckingType,
+    fixed_containers::fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation AUGMENTATION>
+struct tuple_size<fixed_containers::FixedSet<K,
+                                             MAXIMUM_SIZE,
+                                             Compare,
+                                             COMPACTNESS,
+                                             StorageTemplate,
+                                             CheckingType,
+                                             AUGMENTATION>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
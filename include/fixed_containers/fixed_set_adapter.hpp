@@ -1,13 +1,21 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
 #include "fixed_containers/erase_if.hpp"
 #include "fixed_containers/forward_iterator.hpp"
 #include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/random_access_iterator.hpp"
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <iterator>
 #include <memory>
+#include <span>
+#include <type_traits>
 
 namespace fixed_containers
 {
@@ -26,6 +34,33 @@ public:
 private:
     using TableIndex = typename TableImpl::OpaqueIndexType;
     using TableIteratedIndex = typename TableImpl::OpaqueIteratedType;
+    static constexpr bool HAS_TRANSPARENT_LOOKUP = TableImpl::HAS_TRANSPARENT_LOOKUP;
+    // Tables that keep their keys sorted also support `lower_bound()`/`upper_bound()`
+    static constexpr bool IS_ORDERED = requires(const TableImpl& table, const K& key) {
+        table.lower_bound_index(key);
+        table.upper_bound_index(key);
+    };
+    // Ordered tables that can also step back from an entry (and from the end, to the last entry)
+    // get bidirectional iterators
+    static constexpr bool IS_BIDIRECTIONAL =
+        IS_ORDERED && requires(const TableImpl& table, const TableIteratedIndex& index) {
+            { table.prev_of(index) } -> std::same_as<TableIteratedIndex>;
+        };
+    // Bidirectional tables that can also step several entries at once, and tell the distance
+    // between two entries, get random-access iterators
+    static constexpr bool IS_RANDOM_ACCESS =
+        IS_BIDIRECTIONAL &&
+        requires(const TableImpl& table, const TableIteratedIndex& index, std::size_t count) {
+            { table.next_of(index, count) } -> std::same_as<TableIteratedIndex>;
+            { table.prev_of(index, count) } -> std::same_as<TableIteratedIndex>;
+            { table.distance(index, index) } -> std::same_as<std::ptrdiff_t>;
+        };
+    using IteratorCategory =
+        std::conditional_t<IS_RANDOM_ACCESS,
+                           std::random_access_iterator_tag,
+                           std::conditional_t<IS_BIDIRECTIONAL,
+                                              std::bidirectional_iterator_tag,
+                                              std::forward_iterator_tag>>;
 
     class ReferenceProvider
     {
@@ -50,6 +85,21 @@ private:
         }
 
         constexpr void advance() noexcept { current_index_ = table_->next_of(current_index_); }
+        constexpr void recede() noexcept
+            requires IS_BIDIRECTIONAL
+        {
+            current_index_ = table_->prev_of(current_index_);
+        }
+        constexpr void advance(const std::size_t count) noexcept
+            requires IS_RANDOM_ACCESS
+        {
+            current_index_ = table_->next_of(current_index_, count);
+        }
+        constexpr void recede(const std::size_t count) noexcept
+            requires IS_RANDOM_ACCESS
+        {
+            current_index_ = table_->prev_of(current_index_, count);
+        }
 
         [[nodiscard]] constexpr const_reference get() const noexcept
         {
@@ -57,14 +107,51 @@ private:
         }
 
         constexpr bool operator==(const ReferenceProvider& other) const noexcept = default;
+        constexpr std::strong_ordering operator<=>(const ReferenceProvider& other) const noexcept
+            requires IS_RANDOM_ACCESS
+        {
+            return (*this - other) <=> 0;
+        }
+        constexpr std::ptrdiff_t operator-(const ReferenceProvider& other) const noexcept
+            requires IS_RANDOM_ACCESS
+        {
+            return table_->distance(other.current_index_, current_index_);
+        }
     };
 
-    template <IteratorConstness CONSTNESS>
-    using Iterator = ForwardIterator<ReferenceProvider, ReferenceProvider, CONSTNESS>;
+    // Reverse iterators are `void` for tables that only iterate forward
+    template <typename Category, IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    struct IteratorSelector
+    {
+        using Type = std::conditional_t<DIRECTION == IteratorDirection::FORWARD,
+                                        ForwardIterator<ReferenceProvider,
+                                                        ReferenceProvider,
+                                                        CONSTNESS>,
+                                        void>;
+    };
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    struct IteratorSelector<std::bidirectional_iterator_tag, CONSTNESS, DIRECTION>
+    {
+        using Type =
+            BidirectionalIterator<ReferenceProvider, ReferenceProvider, CONSTNESS, DIRECTION>;
+    };
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    struct IteratorSelector<std::random_access_iterator_tag, CONSTNESS, DIRECTION>
+    {
+        using Type =
+            RandomAccessIterator<ReferenceProvider, ReferenceProvider, CONSTNESS, DIRECTION>;
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator = typename IteratorSelector<IteratorCategory, CONSTNESS, DIRECTION>::Type;
 
 public:
-    using const_iterator = Iterator<IteratorConstness::CONSTANT_ITERATOR>;
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
     using iterator = const_iterator;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
 
     using size_type = std::size_t;
     using difference_type = ptrdiff_t;
@@ -105,6 +192,31 @@ public:
     [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
     [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
 
+    // A reverse iterator starts at the entry before the given one: `rbegin()` at the last entry,
+    // and `rend()` at wherever the table steps back to from the first entry.
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+        requires IS_BIDIRECTIONAL
+    {
+        return const_reverse_iterator{
+            ReferenceProvider{std::addressof(table()), table().end_index()}};
+    }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+        requires IS_BIDIRECTIONAL
+    {
+        return const_reverse_iterator{
+            ReferenceProvider{std::addressof(table()), table().begin_index()}};
+    }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept
+        requires IS_BIDIRECTIONAL
+    {
+        return crbegin();
+    }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept
+        requires IS_BIDIRECTIONAL
+    {
+        return crend();
+    }
+
     [[nodiscard]] constexpr size_type max_size() const noexcept { return static_max_size(); }
     [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return table().size() == 0; }
@@ -267,6 +379,19 @@ public:
         return 1;
     }
 
+    template <class K0>
+    constexpr size_type erase(const K0& key) noexcept
+        requires(HAS_TRANSPARENT_LOOKUP && !std::is_convertible_v<const K0&, const_iterator>)
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return 0;
+        }
+        table().erase(idx);
+        return 1;
+    }
+
     [[nodiscard]] constexpr iterator find(const K& key) noexcept
     {
         TableIndex idx = table().opaque_index_of(key);
@@ -283,7 +408,17 @@ public:
         return create_const_iterator(idx);
     }
 
-    // TODO: handle transparent versions of functions (need to check tranparency carefully)
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires HAS_TRANSPARENT_LOOKUP
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return cend();
+        }
+        return create_const_iterator(idx);
+    }
 
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
@@ -291,11 +426,87 @@ public:
         return table().exists(idx);
     }
 
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires HAS_TRANSPARENT_LOOKUP
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        return table().exists(idx);
+    }
+
     [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
     {
         return static_cast<std::size_t>(contains(key));
     }
 
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires HAS_TRANSPARENT_LOOKUP
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    // Batched versions of `find()`/`contains()`: `out[i]` is the result for `keys[i]`. Looking up
+    // many keys at once lets tables that support it overlap the cache misses of the lookups.
+    constexpr void find_batch(std::span<const K> keys, std::span<const_iterator> out) const noexcept
+    {
+        assert_or_abort(keys.size() == out.size());
+        for_each_opaque_index_of(keys,
+                                 [&](std::size_t i, const TableIndex& idx)
+                                 {
+                                     out[i] = table().exists(idx) ? create_const_iterator(idx)
+                                                                  : cend();
+                                 });
+    }
+
+    constexpr void contains_batch(std::span<const K> keys, std::span<bool> out) const noexcept
+    {
+        assert_or_abort(keys.size() == out.size());
+        for_each_opaque_index_of(
+            keys, [&](std::size_t i, const TableIndex& idx) { out[i] = table().exists(idx); });
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+        requires IS_ORDERED
+    {
+        return create_const_iterator_from_iterated(table().lower_bound_index(key));
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires(IS_ORDERED && HAS_TRANSPARENT_LOOKUP)
+    {
+        return create_const_iterator_from_iterated(table().lower_bound_index(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+        requires IS_ORDERED
+    {
+        return create_const_iterator_from_iterated(table().upper_bound_index(key));
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires(IS_ORDERED && HAS_TRANSPARENT_LOOKUP)
+    {
+        return create_const_iterator_from_iterated(table().upper_bound_index(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+        requires IS_ORDERED
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires(IS_ORDERED && HAS_TRANSPARENT_LOOKUP)
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
     template <typename TableImpl2, typename CheckingType2>
     [[nodiscard]] constexpr bool operator==(
         const FixedSetAdapter<K, TableImpl2, CheckingType2>& other) const
@@ -309,6 +520,22 @@ public:
     }
 
 private:
+    template <typename Func>
+    constexpr void for_each_opaque_index_of(std::span<const K> keys, Func&& func) const
+    {
+        if constexpr (requires { table().for_each_opaque_index_of(keys, func); })
+        {
+            table().for_each_opaque_index_of(keys, func);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < keys.size(); i++)
+            {
+                func(i, table().opaque_index_of(keys[i]));
+            }
+        }
+    }
+
     constexpr iterator create_checked_iterator(const TableIndex& index) noexcept
     {
         // check for nonexistent indices and replace them with end() so the iterator compares
@@ -327,6 +554,12 @@ private:
             ReferenceProvider{std::addressof(table()), table().iterated_index_from(start_index)}};
     }
 
+    [[nodiscard]] constexpr const_iterator create_const_iterator_from_iterated(
+        const TableIteratedIndex& index) const noexcept
+    {
+        return const_iterator{ReferenceProvider{std::addressof(table()), index}};
+    }
+
     constexpr void check_not_full(const std_transition::source_location& loc) const
     {
         if (preconditions::test(table().size() < TableImpl::CAPACITY))
@@ -2,16 +2,22 @@
 
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_string_simd.hpp"
 #include "fixed_containers/fixed_vector.hpp"
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/sequence_container_checking.hpp"
 #include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
 
+#include <algorithm>
 #include <array>
+#include <compare>
 #include <cstddef>
 #include <cstdlib>
 #include <istream>
+#include <span>
 #include <string_view>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -312,6 +318,23 @@ public:
         null_terminate(loc);
     }
 
+    /**
+     * Same as `push_back()`/`append()`, but without any checks or source locations, for hot
+     * loops that have already made sure there is enough room.
+     * Exceeding `max_size()` is undefined.
+     */
+    constexpr void push_back_unchecked(CharT character)
+    {
+        vec().push_back_unchecked(character);
+        null_terminate(length());
+    }
+    constexpr FixedString& append_unchecked(const std::string_view& view)
+    {
+        vec().append_unchecked(std::span<const CharT>{view});
+        null_terminate(length());
+        return *this;
+    }
+
     constexpr void pop_back(
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
@@ -374,28 +397,28 @@ public:
     [[nodiscard]] constexpr size_type find(const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& str,
                                            const size_type pos = 0) const
     {
-        return as_view().find(str, pos);
+        return find_in_buffer(std::string_view{str}, pos);
     }
     [[nodiscard]] constexpr size_type find(const CharT* char_ptr,
                                            size_type pos,
                                            size_type count) const
     {
-        return as_view().find(char_ptr, pos, count);
+        return find_in_buffer(std::string_view{char_ptr, count}, pos);
     }
     [[nodiscard]] constexpr size_type find(const CharT* const str, const size_type pos = 0) const
     {
-        return as_view().find(str, pos);
+        return find_in_buffer(std::string_view{str}, pos);
     }
     [[nodiscard]] constexpr size_type find(const CharT character, const size_type pos = 0) const
     {
-        return as_view().find(character, pos);
+        return fixed_string_detail::find<MAXIMUM_LENGTH + 1>(data(), length(), character, pos);
     }
     template <class StringViewLike>
         requires(std::is_convertible_v<const StringViewLike&, std::string_view> and
                  not std::is_convertible_v<const StringViewLike&, const char*>)
     [[nodiscard]] constexpr size_type find(const StringViewLike& str, const size_type pos = 0) const
     {
-        return as_view().find(str, pos);
+        return find_in_buffer(std::string_view{str}, pos);
     }
 
     template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
@@ -417,7 +440,7 @@ public:
     }
     [[nodiscard]] constexpr size_type rfind(const CharT character, const size_type pos = npos) const
     {
-        return as_view().rfind(character, pos);
+        return fixed_string_detail::rfind<MAXIMUM_LENGTH + 1>(data(), length(), character, pos);
     }
     template <class StringViewLike>
         requires(std::is_convertible_v<const StringViewLike&, std::string_view> and
@@ -552,15 +575,31 @@ public:
         return as_view().find_last_not_of(str, pos);
     }
 
+    template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
+    [[nodiscard]] constexpr int compare(
+        const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const
+    {
+        const std::strong_ordering ordering = *this <=> other;
+        if (ordering < 0)
+        {
+            return -1;
+        }
+        return ordering > 0 ? 1 : 0;
+    }
     [[nodiscard]] constexpr int compare(std::string_view view) const
     {
         return std::string_view(*this).compare(view);
     }
 
+    // Comparisons between FixedStrings read both buffers in whole blocks, see
+    // `fixed_string_simd.hpp`. Other strings can't be read past their end, so they use
+    // `std::string_view`.
     template <std::size_t MAXIMUM_LENGTH_2, customize::SequenceContainerChecking CheckingType2>
     constexpr bool operator==(const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const
     {
-        return as_view() == std::string_view{other};
+        constexpr std::size_t COMMON_BUFFER_SIZE = (std::min)(MAXIMUM_LENGTH, MAXIMUM_LENGTH_2) + 1;
+        return length() == other.length() &&
+               fixed_string_detail::equal<COMMON_BUFFER_SIZE>(data(), other.data(), length());
     }
     constexpr bool operator==(const CharT* other) const
     {
@@ -572,7 +611,9 @@ public:
     constexpr std::strong_ordering operator<=>(
         const FixedString<MAXIMUM_LENGTH_2, CheckingType2>& other) const noexcept
     {
-        return as_view() <=> other;
+        constexpr std::size_t COMMON_BUFFER_SIZE = (std::min)(MAXIMUM_LENGTH, MAXIMUM_LENGTH_2) + 1;
+        return fixed_string_detail::compare_three_way<COMMON_BUFFER_SIZE>(
+            data(), length(), other.data(), other.length());
     }
     constexpr std::strong_ordering operator<=>(const CharT* other) const noexcept
     {
@@ -640,6 +681,35 @@ public:
         null_terminate(loc);
     }
 
+    /**
+     * Resizes the string to contain `count` characters, without initializing the new ones, so
+     * that they can be directly overwritten, e.g. by `read()`.
+     */
+    constexpr void resize_for_overwrite(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_length(count, loc);
+        vec().resize_for_overwrite(count, loc);
+        null_terminate(loc);
+    }
+
+    /**
+     * Same as `std::string::resize_and_overwrite()`: Makes room for `count` characters without
+     * initializing the new ones, then calls `op(data(), count)`, which writes the characters and
+     * returns the final length, at most `count`.
+     */
+    template <class Operation>
+    constexpr void resize_and_overwrite(
+        size_type count,
+        Operation op,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_length(count, loc);
+        vec().resize_and_overwrite(count, std::move(op), loc);
+        null_terminate(loc);
+    }
+
 private:
     constexpr void null_terminate(std::size_t n)
     {
@@ -659,8 +729,24 @@ private:
     }
     constexpr void null_terminate_at_max_length() { null_terminate(MAXIMUM_LENGTH); }
 
+    static constexpr void check_target_length(const std::size_t target_length,
+                                              const std_transition::source_location& loc)
+    {
+        if (preconditions::test(target_length <= MAXIMUM_LENGTH))
+        {
+            Checking::length_error(target_length, loc);
+        }
+    }
+
     [[nodiscard]] constexpr std::string_view as_view() const { return *this; }
 
+    // The needle is only read up to its length, the buffer of this string up to its capacity
+    [[nodiscard]] constexpr size_type find_in_buffer(const std::string_view& needle,
+                                                     const size_type pos) const
+    {
+        return fixed_string_detail::find<MAXIMUM_LENGTH + 1>(data(), length(), needle, pos);
+    }
+
     [[nodiscard]] constexpr const FixedVecStorage& vec() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
@@ -765,6 +851,17 @@ constexpr FixedString<MAXIMUM_LENGTH, CheckingType>& append_truncating(
 }  // namespace fixed_containers
 
 // Specializations
+namespace fixed_containers::wyhash
+{
+// Same hash as the contents as a `std::string_view`, so the (transparent) lookups of containers
+// keyed by `FixedString` accept any string-like key.
+template <std::size_t MAXIMUM_LENGTH,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct hash<fixed_containers::FixedString<MAXIMUM_LENGTH, CheckingType>> : hash<std::string_view>
+{
+};
+}  // namespace fixed_containers::wyhash
+
 namespace std
 {
 template <std::size_t MAXIMUM_LENGTH,
@@ -0,0 +1,391 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if !defined(FIXED_CONTAINERS_DISABLE_SIMD) &&                                           \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FIXED_CONTAINERS_FIXED_STRING_SSE2_BLOCKS
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define FIXED_CONTAINERS_FIXED_STRING_AVX2_BLOCKS
+#include <immintrin.h>
+#endif
+#endif
+
+// Search and comparison kernels for FixedString.
+//
+// Unlike the target of a `std::string_view`, the buffer of a FixedString is always readable up to
+// its capacity plus the null terminator. So these kernels compare whole 16/32-byte blocks and mask
+// out the bytes past the end of the string, instead of handling a tail byte by byte. Blocks never
+// extend past the buffer: a block that would is moved back to end where the buffer ends, and the
+// bytes it shares with the previous block are masked out where that matters.
+//
+// Constant evaluation, buffers smaller than a block and targets without SIMD use
+// `std::string_view`, as do the comparisons and `find(character)` of long strings.
+namespace fixed_containers::fixed_string_detail
+{
+template <typename T>
+[[nodiscard]] inline const char* byte_at(const char* ptr, const T offset)
+{
+    return std::next(ptr, static_cast<std::ptrdiff_t>(offset));
+}
+
+#if defined(FIXED_CONTAINERS_FIXED_STRING_SSE2_BLOCKS)
+struct Block16
+{
+    static constexpr std::size_t SIZE = 16;
+
+    [[nodiscard]] static __m128i load(const char* ptr)
+    {
+        return _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(ptr)));
+    }
+
+    // Bit `i` is set if byte `i` of both blocks is the same
+    [[nodiscard]] static std::uint32_t equal_mask(const char* left, const char* right)
+    {
+        return static_cast<std::uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(load(left), load(right))));
+    }
+    // Bit `i` is set if byte `i` of the block is `character`
+    [[nodiscard]] static std::uint32_t match_mask(const char* ptr, const char character)
+    {
+        return static_cast<std::uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(load(ptr), _mm_set1_epi8(character))));
+    }
+    // Bits [0, count), with `count` clamped to the block size
+    [[nodiscard]] static std::uint32_t prefix_mask(const std::size_t count)
+    {
+        return static_cast<std::uint32_t>((std::uint64_t{1} << (std::min)(count, SIZE)) - 1);
+    }
+};
+#endif
+
+#if defined(FIXED_CONTAINERS_FIXED_STRING_AVX2_BLOCKS)
+struct Block32
+{
+    static constexpr std::size_t SIZE = 32;
+
+    [[nodiscard]] static __m256i load(const char* ptr)
+    {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(ptr)));
+    }
+
+    [[nodiscard]] static std::uint32_t equal_mask(const char* left, const char* right)
+    {
+        return static_cast<std::uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(load(left), load(right))));
+    }
+    [[nodiscard]] static std::uint32_t match_mask(const char* ptr, const char character)
+    {
+        return static_cast<std::uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(load(ptr), _mm256_set1_epi8(character))));
+    }
+    [[nodiscard]] static std::uint32_t prefix_mask(const std::size_t count)
+    {
+        return static_cast<std::uint32_t>((std::uint64_t{1} << (std::min)(count, SIZE)) - 1);
+    }
+};
+#endif
+
+// The widest block that fits in a buffer of BUFFER_SIZE bytes, `void` if there is none
+template <std::size_t BUFFER_SIZE>
+struct BlockForBufferSize
+{
+    using Type = void;
+};
+#if defined(FIXED_CONTAINERS_FIXED_STRING_SSE2_BLOCKS)
+template <std::size_t BUFFER_SIZE>
+    requires(BUFFER_SIZE >= Block16::SIZE)
+struct BlockForBufferSize<BUFFER_SIZE>
+{
+#if defined(FIXED_CONTAINERS_FIXED_STRING_AVX2_BLOCKS)
+    using Type = std::conditional_t<(BUFFER_SIZE >= Block32::SIZE), Block32, Block16>;
+#else
+    using Type = Block16;
+#endif
+};
+#endif
+template <std::size_t BUFFER_SIZE>
+using BlockFor = typename BlockForBufferSize<BUFFER_SIZE>::Type;
+
+// Buffers of up to this size are compared and searched as a whole, with a bit per character in a
+// `std::uint64_t` and no branch on the length. Longer strings are left to `memcmp()` and
+// `memchr()`, which are already vectorized and unrolled for them.
+inline constexpr std::size_t MAXIMUM_SMALL_BUFFER_SIZE = 64;
+
+template <std::size_t BUFFER_SIZE>
+inline constexpr bool IS_SMALL_BUFFER =
+    !std::is_void_v<BlockFor<BUFFER_SIZE>> && BUFFER_SIZE <= MAXIMUM_SMALL_BUFFER_SIZE;
+
+template <std::size_t BUFFER_SIZE, std::size_t BLOCK_INDEX>
+inline constexpr std::size_t SMALL_BUFFER_BLOCK_OFFSET = (std::min)(
+    BLOCK_INDEX * BlockFor<BUFFER_SIZE>::SIZE, BUFFER_SIZE - BlockFor<BUFFER_SIZE>::SIZE);
+
+// Bit `i` is set if `block_mask()` sets it for character `i` of the buffer
+template <std::size_t BUFFER_SIZE, typename BlockMaskFunction>
+[[nodiscard]] std::uint64_t small_buffer_mask(const BlockMaskFunction& block_mask)
+{
+    using Block = BlockFor<BUFFER_SIZE>;
+    constexpr std::size_t BLOCK_COUNT = (BUFFER_SIZE + Block::SIZE - 1) / Block::SIZE;
+    return [&]<std::size_t... BLOCK_INDICES>(std::index_sequence<BLOCK_INDICES...>)
+    {
+        return ((std::uint64_t{block_mask(SMALL_BUFFER_BLOCK_OFFSET<BUFFER_SIZE, BLOCK_INDICES>)}
+                 << SMALL_BUFFER_BLOCK_OFFSET<BUFFER_SIZE, BLOCK_INDICES>) |
+                ...);
+    }(std::make_index_sequence<BLOCK_COUNT>{});
+}
+
+// Bits [0, count), `count` must be less than 64
+[[nodiscard]] inline std::uint64_t small_buffer_prefix_mask(const std::size_t count)
+{
+    return (std::uint64_t{1} << count) - 1;
+}
+
+// Whether the first `length` characters of `left` and `right` are the same. Both buffers must be
+// readable for BUFFER_SIZE bytes.
+template <std::size_t BUFFER_SIZE>
+[[nodiscard]] constexpr bool equal(const char* left, const char* right, const std::size_t length)
+{
+    if constexpr (IS_SMALL_BUFFER<BUFFER_SIZE>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            using Block = BlockFor<BUFFER_SIZE>;
+            const std::uint64_t mismatches = small_buffer_mask<BUFFER_SIZE>(
+                [&](const std::size_t block_offset)
+                {
+                    return ~Block::equal_mask(byte_at(left, block_offset),
+                                              byte_at(right, block_offset)) &
+                           Block::prefix_mask(Block::SIZE);
+                });
+            return (mismatches & small_buffer_prefix_mask(length)) == 0;
+        }
+    }
+
+    return std::string_view{left, length} == std::string_view{right, length};
+}
+
+// Same as `std::string_view::compare()`, i.e. characters are compared as unsigned chars. Both
+// buffers must be readable for BUFFER_SIZE bytes.
+template <std::size_t BUFFER_SIZE>
+[[nodiscard]] constexpr std::strong_ordering compare_three_way(const char* left,
+                                                               const std::size_t left_length,
+                                                               const char* right,
+                                                               const std::size_t right_length)
+{
+    if constexpr (IS_SMALL_BUFFER<BUFFER_SIZE>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            using Block = BlockFor<BUFFER_SIZE>;
+            const std::size_t common_length = (std::min)(left_length, right_length);
+            const std::uint64_t mismatches = small_buffer_mask<BUFFER_SIZE>(
+                [&](const std::size_t block_offset)
+                {
+                    return ~Block::equal_mask(byte_at(left, block_offset),
+                                              byte_at(right, block_offset)) &
+                           Block::prefix_mask(Block::SIZE);
+                });
+            // `common_length` itself if there is no mismatch before it
+            const auto index = static_cast<std::size_t>(
+                std::countr_zero((mismatches & small_buffer_prefix_mask(common_length)) |
+                                 (std::uint64_t{1} << common_length)));
+            if (index < common_length)
+            {
+                return static_cast<unsigned char>(*byte_at(left, index)) <=>
+                       static_cast<unsigned char>(*byte_at(right, index));
+            }
+            return left_length <=> right_length;
+        }
+    }
+
+    return std::string_view{left, left_length} <=> std::string_view{right, right_length};
+}
+
+// Same as `std::string_view::find(character, pos)`. The buffer must be readable for BUFFER_SIZE
+// bytes.
+template <std::size_t BUFFER_SIZE>
+[[nodiscard]] constexpr std::size_t find(const char* ptr,
+                                         const std::size_t length,
+                                         const char character,
+                                         const std::size_t pos)
+{
+    if constexpr (IS_SMALL_BUFFER<BUFFER_SIZE>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            if (pos >= length)
+            {
+                return std::string_view::npos;
+            }
+            using Block = BlockFor<BUFFER_SIZE>;
+            const std::uint64_t matches =
+                small_buffer_mask<BUFFER_SIZE>([&](const std::size_t block_offset)
+                                               { return Block::match_mask(
+                                                     byte_at(ptr, block_offset), character); }) &
+                small_buffer_prefix_mask(length) & ~small_buffer_prefix_mask(pos);
+            if (matches == 0)
+            {
+                return std::string_view::npos;
+            }
+            return static_cast<std::size_t>(std::countr_zero(matches));
+        }
+    }
+
+    return std::string_view{ptr, length}.find(character, pos);
+}
+
+// Same as `std::string_view::rfind(character, pos)`, which is a byte by byte loop in common
+// standard libraries. The buffer must be readable for BUFFER_SIZE bytes.
+template <std::size_t BUFFER_SIZE>
+[[nodiscard]] constexpr std::size_t rfind(const char* ptr,
+                                          const std::size_t length,
+                                          const char character,
+                                          const std::size_t pos)
+{
+    using Block = BlockFor<BUFFER_SIZE>;
+    if constexpr (!std::is_void_v<Block>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            // One past the last position to look at
+            std::size_t end = length == 0 ? 0 : (std::min)(pos, length - 1) + 1;
+            for (; end >= Block::SIZE; end -= Block::SIZE)
+            {
+                const std::uint32_t matches =
+                    Block::match_mask(byte_at(ptr, end - Block::SIZE), character);
+                if (matches != 0)
+                {
+                    return end - Block::SIZE + static_cast<std::size_t>(std::bit_width(matches)) -
+                           1;
+                }
+            }
+            // The start of the buffer is always readable for a whole block
+            const std::uint32_t matches = Block::match_mask(ptr, character) &
+                                          Block::prefix_mask(end);
+            if (matches != 0)
+            {
+                return static_cast<std::size_t>(std::bit_width(matches)) - 1;
+            }
+            return std::string_view::npos;
+        }
+    }
+
+    return std::string_view{ptr, length}.rfind(character, pos);
+}
+
+// Same as `std::string_view::find(needle, pos)`. Only the buffer of the haystack, `ptr`, must be
+// readable for BUFFER_SIZE bytes.
+//
+// Candidate positions are those where both the first and the last character of the needle match,
+// which filters out far more false starts than the first character alone, e.g. in periodic text.
+// Only the candidates are then fully compared.
+template <std::size_t BUFFER_SIZE>
+[[nodiscard]] constexpr std::size_t find(const char* ptr,
+                                         const std::size_t length,
+                                         const std::string_view needle,
+                                         const std::size_t pos)
+{
+    using Block = BlockFor<BUFFER_SIZE>;
+    if constexpr (IS_SMALL_BUFFER<BUFFER_SIZE>)
+    {
+        const std::size_t needle_length = needle.size();
+        if (!std::is_constant_evaluated() && needle_length != 0)
+        {
+            if (needle_length > length || pos > length - needle_length)
+            {
+                return std::string_view::npos;
+            }
+            const std::uint64_t first_matches = small_buffer_mask<BUFFER_SIZE>(
+                [&](const std::size_t block_offset)
+                { return Block::match_mask(byte_at(ptr, block_offset), needle.front()); });
+            const std::uint64_t last_matches = small_buffer_mask<BUFFER_SIZE>(
+                [&](const std::size_t block_offset)
+                { return Block::match_mask(byte_at(ptr, block_offset), needle.back()); });
+            std::uint64_t candidates = first_matches & (last_matches >> (needle_length - 1)) &
+                                       small_buffer_prefix_mask(length - needle_length + 1) &
+                                       ~small_buffer_prefix_mask(pos);
+            while (candidates != 0)
+            {
+                const auto candidate = static_cast<std::size_t>(std::countr_zero(candidates));
+                if (std::memcmp(byte_at(ptr, candidate), needle.data(), needle_length) == 0)
+                {
+                    return candidate;
+                }
+                candidates &= candidates - 1;
+            }
+            return std::string_view::npos;
+        }
+    }
+    else if constexpr (!std::is_void_v<Block>)
+    {
+        const std::size_t needle_length = needle.size();
+        // The block of last characters must also fit in the buffer
+        if (!std::is_constant_evaluated() && needle_length >= 2 &&
+            needle_length <= BUFFER_SIZE - Block::SIZE + 1)
+        {
+            if (needle_length > length || pos > length - needle_length)
+            {
+                return std::string_view::npos;
+            }
+
+            const auto first_match = [&](const std::size_t block_offset,
+                                         std::uint32_t candidates) -> std::size_t
+            {
+                while (candidates != 0)
+                {
+                    const std::size_t candidate =
+                        block_offset + static_cast<std::size_t>(std::countr_zero(candidates));
+                    if (std::memcmp(byte_at(ptr, candidate), needle.data(), needle_length) == 0)
+                    {
+                        return candidate;
+                    }
+                    candidates &= candidates - 1;
+                }
+                return std::string_view::npos;
+            };
+            const auto candidate_mask = [&](const std::size_t block_offset)
+            {
+                return Block::match_mask(byte_at(ptr, block_offset), needle.front()) &
+                       Block::match_mask(byte_at(ptr, block_offset + needle_length - 1),
+                                         needle.back());
+            };
+
+            // Blocks where every position is a candidate, these are always within the buffer
+            const std::size_t candidates_end = length - needle_length + 1;
+            std::size_t offset = pos;
+            for (; offset + Block::SIZE <= candidates_end; offset += Block::SIZE)
+            {
+                if (const std::size_t index = first_match(offset, candidate_mask(offset));
+                    index != std::string_view::npos)
+                {
+                    return index;
+                }
+            }
+            if (offset == candidates_end)
+            {
+                return std::string_view::npos;
+            }
+            // The last partial block, moved back if it would read past the buffer
+            const std::size_t block_offset =
+                (std::min)(offset, BUFFER_SIZE - Block::SIZE - (needle_length - 1));
+            return first_match(block_offset,
+                               candidate_mask(block_offset) &
+                                   Block::prefix_mask(candidates_end - block_offset) &
+                                   ~Block::prefix_mask(offset - block_offset));
+        }
+    }
+
+    return std::string_view{ptr, length}.find(needle, pos);
+}
+
+}  // namespace fixed_containers::fixed_string_detail
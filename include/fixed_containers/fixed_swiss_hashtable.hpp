@@ -0,0 +1,722 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/map_entry.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if !defined(FIXED_CONTAINERS_DISABLE_SIMD) &&                                           \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FIXED_CONTAINERS_SWISS_HASHTABLE_SSE2_GROUPS
+#include <emmintrin.h>
+#endif
+
+// An open-addressing hashtable in the style of Abseil's SwissTable and boost::unordered_flat_map.
+// Slots are organized in groups of 15 and every slot has a control byte, stored separately from the
+// slots so that a whole group can be matched against a 7-bit fingerprint of the hash with a single
+// 16-byte compare. The entries live in the slots themselves, in an array parallel to the control
+// bytes, so a matching control byte leads straight to its entry, and iteration scans the control
+// bytes for occupied slots. The 16th byte of each group records which fingerprints have overflowed
+// into the next group (the boost::unordered_flat_map approach), so misses terminate without
+// tombstones and erase does not need to move anything. Overflow bits are only ever set, so after
+// enough erasures the entries are re-placed in place.
+
+namespace fixed_containers::fixed_swiss_hashtable_detail
+{
+
+struct alignas(16) GroupControl
+{
+    using ControlType = std::uint8_t;
+    using MaskType = std::uint32_t;
+
+    static constexpr std::size_t GROUP_WIDTH = 16;
+    static constexpr std::size_t SLOTS_PER_GROUP = GROUP_WIDTH - 1;
+    static constexpr std::size_t OVERFLOW_BYTE_INDEX = SLOTS_PER_GROUP;
+    static constexpr MaskType SLOTS_MASK = (1U << SLOTS_PER_GROUP) - 1;
+
+    // Occupied slots always have the high bit set, so they are never confused with empty ones
+    static constexpr ControlType EMPTY = 0;
+    // Only while the entries are re-placed: the slot holds an entry that has yet to be re-placed
+    static constexpr ControlType PENDING = 1;
+    static constexpr std::uint64_t FINGERPRINT_BITS = 7;
+    static constexpr std::uint64_t OCCUPIED_BIT = 1U << FINGERPRINT_BITS;
+    static constexpr std::uint64_t FINGERPRINT_MASK = OCCUPIED_BIT - 1;
+    // Each overflow byte has 8 bits, selected by 3 bits of the hash
+    static constexpr std::uint64_t OVERFLOW_BITS = 3;
+
+    std::array<ControlType, GROUP_WIDTH> control_bytes_;
+
+    [[nodiscard]] static constexpr ControlType control_from_hash(std::uint64_t hash)
+    {
+        return static_cast<ControlType>(OCCUPIED_BIT | (hash & FINGERPRINT_MASK));
+    }
+
+    [[nodiscard]] static constexpr ControlType overflow_bit_from_hash(std::uint64_t hash)
+    {
+        return static_cast<ControlType>(
+            1U << ((hash >> FINGERPRINT_BITS) & ((1ULL << OVERFLOW_BITS) - 1)));
+    }
+
+    // Bit `i` of the result is set if slot `i` has the given control byte
+    [[nodiscard]] constexpr MaskType match(ControlType control) const
+    {
+#if defined(FIXED_CONTAINERS_SWISS_HASHTABLE_SSE2_GROUPS)
+        if (!std::is_constant_evaluated())
+        {
+            const __m128i bytes = _mm_load_si128(
+                static_cast<const __m128i*>(static_cast<const void*>(control_bytes_.data())));
+            const __m128i matches =
+                _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(control)));
+            return static_cast<MaskType>(_mm_movemask_epi8(matches)) & SLOTS_MASK;
+        }
+#endif
+        MaskType out = 0;
+        for (std::size_t i = 0; i < SLOTS_PER_GROUP; i++)
+        {
+            out |= static_cast<MaskType>(control_bytes_[i] == control) << i;
+        }
+        return out;
+    }
+
+    [[nodiscard]] constexpr MaskType match_empty() const { return match(EMPTY); }
+
+    // Bit `i` of the result is set if slot `i` holds an entry
+    [[nodiscard]] constexpr MaskType match_occupied() const
+    {
+#if defined(FIXED_CONTAINERS_SWISS_HASHTABLE_SSE2_GROUPS)
+        if (!std::is_constant_evaluated())
+        {
+            // The occupied bit is the high bit, which is exactly what movemask collects
+            const __m128i bytes = _mm_load_si128(
+                static_cast<const __m128i*>(static_cast<const void*>(control_bytes_.data())));
+            return static_cast<MaskType>(_mm_movemask_epi8(bytes)) & SLOTS_MASK;
+        }
+#endif
+        MaskType out = 0;
+        for (std::size_t i = 0; i < SLOTS_PER_GROUP; i++)
+        {
+            out |= static_cast<MaskType>((control_bytes_[i] & OCCUPIED_BIT) != 0) << i;
+        }
+        return out;
+    }
+
+    [[nodiscard]] constexpr bool has_overflowed(ControlType overflow_bit) const
+    {
+        return (control_bytes_[OVERFLOW_BYTE_INDEX] & overflow_bit) != 0;
+    }
+
+    constexpr void mark_overflow(ControlType overflow_bit)
+    {
+        control_bytes_[OVERFLOW_BYTE_INDEX] =
+            static_cast<ControlType>(control_bytes_[OVERFLOW_BYTE_INDEX] | overflow_bit);
+    }
+};
+static_assert(sizeof(GroupControl) == GroupControl::GROUP_WIDTH);
+
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_VALUE_COUNT,
+          std::size_t SLOT_COUNT,
+          class Hash,
+          class KeyEqual>
+class FixedSwissHashtableBase
+{
+public:
+    using PairType = MapEntry<K, V>;
+    using HashType = Hash;
+    using KeyEqualType = KeyEqual;
+    // Lookups by any key type (not just `K`) need both the hash and the equality to accept it
+    static constexpr bool HAS_TRANSPARENT_LOOKUP =
+        IsTransparent<Hash> && IsTransparent<KeyEqual>;
+    using SizeType = std::uint32_t;
+
+    static constexpr std::size_t CAPACITY = MAXIMUM_VALUE_COUNT;
+    static constexpr std::size_t NUM_GROUPS = std::max<std::size_t>(
+        1,
+        (SLOT_COUNT + GroupControl::SLOTS_PER_GROUP - 1) / GroupControl::SLOTS_PER_GROUP);
+    static constexpr std::size_t INTERNAL_SLOT_COUNT = NUM_GROUPS * GroupControl::SLOTS_PER_GROUP;
+
+    static_assert(MAXIMUM_VALUE_COUNT <= SLOT_COUNT,
+                  "need at least enough slots to hold every value");
+    static_assert(INTERNAL_SLOT_COUNT < (std::numeric_limits<SizeType>::max)(),
+                  "specified too many slots for the current slot index type");
+
+    using SlotType = optional_storage_detail::OptionalStorage<PairType>;
+
+    std::array<GroupControl, NUM_GROUPS> IMPLEMENTATION_DETAIL_DO_NOT_USE_control_array_{};
+    // Slot `i` holds an entry if and only if its control byte is occupied
+    std::array<SlotType, INTERNAL_SLOT_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_array_{};
+    SizeType IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{};
+
+    // Erasures from groups that had overflowed. See `rebuild_control_array()`.
+    SizeType IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_{};
+
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{};
+
+    static constexpr auto NO_SLOT = static_cast<SizeType>(INTERNAL_SLOT_COUNT);
+    // Rebuilding costs O(SLOT_COUNT), so this amortizes it to a constant per erasure
+    static constexpr SizeType STALE_OVERFLOW_LIMIT =
+        std::max<SizeType>(1, static_cast<SizeType>(INTERNAL_SLOT_COUNT / 2));
+    static constexpr GroupControl::ControlType OVERFLOW_MASK = 0xFF;
+    // Checked on `K` and `V`, as `MapEntry` declares a move constructor either way
+    static constexpr bool CAN_MOVE_ENTRIES =
+        std::is_move_constructible_v<K> && std::is_move_constructible_v<V>;
+
+    struct OpaqueIndexType
+    {
+        // The slot where the key is, or `NO_SLOT` if it is not in the table
+        SizeType slot_index;
+        // emplace() needs the hash to find a slot for keys that don't exist
+        std::uint64_t hash;
+    };
+
+    using OpaqueIteratedType = SizeType;
+
+    ////////////////////// helper functions
+public:
+    [[nodiscard]] constexpr GroupControl& group_at(SizeType group_index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_control_array_[group_index];
+    }
+    [[nodiscard]] constexpr const GroupControl& group_at(SizeType group_index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_control_array_[group_index];
+    }
+
+    [[nodiscard]] constexpr GroupControl::ControlType& control_at(SizeType slot_index)
+    {
+        return group_at(group_index_of(slot_index))
+            .control_bytes_[slot_index % GroupControl::SLOTS_PER_GROUP];
+    }
+
+    [[nodiscard]] constexpr PairType& entry_at(SizeType slot_index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_array_[slot_index].get();
+    }
+    [[nodiscard]] constexpr const PairType& entry_at(SizeType slot_index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_array_[slot_index].get();
+    }
+
+    [[nodiscard]] static constexpr SizeType slot_index_of(SizeType group_index, SizeType lane)
+    {
+        return (group_index * static_cast<SizeType>(GroupControl::SLOTS_PER_GROUP)) + lane;
+    }
+
+    [[nodiscard]] static constexpr SizeType group_index_of(SizeType slot_index)
+    {
+        return slot_index / static_cast<SizeType>(GroupControl::SLOTS_PER_GROUP);
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr std::uint64_t hash(const Key& key) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(key);
+    }
+
+    template <typename K1, typename K2>
+    [[nodiscard]] constexpr bool key_equal(const K1& key1, const K2& key2) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(key1, key2);
+    }
+
+    [[nodiscard]] static constexpr SizeType group_index_from_hash(std::uint64_t hash)
+    {
+        // Skip the bits used by the fingerprint and the overflow bit, for the same reason as
+        // `FixedRobinhoodHashtable::bucket_index_from_hash()`
+        const std::uint64_t shifted_hash =
+            hash >> (GroupControl::FINGERPRINT_BITS + GroupControl::OVERFLOW_BITS);
+        return static_cast<SizeType>(shifted_hash % NUM_GROUPS);
+    }
+
+    [[nodiscard]] static constexpr SizeType next_group_index(SizeType group_index)
+    {
+        if (group_index + 1 < NUM_GROUPS)
+        {
+            return group_index + 1;
+        }
+        return 0;
+    }
+
+    // The first occupied slot at or after `slot_index`, or `NO_SLOT`
+    [[nodiscard]] constexpr SizeType first_occupied_slot_from(SizeType slot_index) const
+    {
+        SizeType group_index = group_index_of(slot_index);
+        const auto lane = slot_index % static_cast<SizeType>(GroupControl::SLOTS_PER_GROUP);
+        GroupControl::MaskType occupied =
+            group_index < NUM_GROUPS ? (group_at(group_index).match_occupied() >> lane) << lane
+                                     : 0;
+        while (occupied == 0)
+        {
+            group_index++;
+            if (group_index >= NUM_GROUPS)
+            {
+                return NO_SLOT;
+            }
+            occupied = group_at(group_index).match_occupied();
+        }
+        return slot_index_of(group_index, static_cast<SizeType>(std::countr_zero(occupied)));
+    }
+
+    // The first group of the probe sequence that has a slot in `available(group)`. Groups that
+    // are skipped over record that this fingerprint overflowed, so that lookups know to keep
+    // going. Since the table is never fuller than `SLOT_COUNT`, this always terminates.
+    template <typename AvailableSlots>
+    constexpr SizeType claim_group(std::uint64_t hash, AvailableSlots available)
+    {
+        const GroupControl::ControlType overflow_bit = GroupControl::overflow_bit_from_hash(hash);
+        SizeType group_index = group_index_from_hash(hash);
+        while (available(group_at(group_index)) == 0)
+        {
+            group_at(group_index).mark_overflow(overflow_bit);
+            group_index = next_group_index(group_index);
+        }
+        return group_index;
+    }
+
+    // Takes the first empty slot of the probe sequence
+    constexpr SizeType place(std::uint64_t hash)
+    {
+        const SizeType group_index =
+            claim_group(hash, [](const GroupControl& group) { return group.match_empty(); });
+        const auto lane =
+            static_cast<SizeType>(std::countr_zero(group_at(group_index).match_empty()));
+        group_at(group_index).control_bytes_[lane] = GroupControl::control_from_hash(hash);
+        return slot_index_of(group_index, lane);
+    }
+
+    constexpr void move_entry(SizeType from_slot_index, SizeType to_slot_index)
+    {
+        memory::construct_at_address_of(IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_array_[to_slot_index],
+                                        std::in_place,
+                                        std::move(entry_at(from_slot_index)));
+        memory::destroy_at_address_of(entry_at(from_slot_index));
+    }
+
+    // Overflow bits are never cleared by erase(), so with enough churn they saturate and every
+    // probe runs long. This re-places every entry from scratch, which is the fixed-capacity
+    // equivalent of a same-size rehash. There is no room for a second copy of the entries, so
+    // it is done in place, like Abseil's `DropDeletesWithoutResize()`: every entry is marked as
+    // pending, then each pending entry either stays in its slot (if that is in the first group of
+    // its probe sequence with room), moves to an empty slot, or swaps with another pending entry,
+    // which then gets re-placed in turn.
+    constexpr void rebuild_control_array()
+        requires CAN_MOVE_ENTRIES
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_ = 0;
+        for (GroupControl& group : IMPLEMENTATION_DETAIL_DO_NOT_USE_control_array_)
+        {
+            for (std::size_t lane = 0; lane < GroupControl::SLOTS_PER_GROUP; lane++)
+            {
+                if (group.control_bytes_[lane] != GroupControl::EMPTY)
+                {
+                    group.control_bytes_[lane] = GroupControl::PENDING;
+                }
+            }
+            group.control_bytes_[GroupControl::OVERFLOW_BYTE_INDEX] = 0;
+        }
+
+        const auto available = [](const GroupControl& group)
+        { return group.match_empty() | group.match(GroupControl::PENDING); };
+        for (SizeType slot_index = 0; slot_index < NO_SLOT; slot_index++)
+        {
+            while (control_at(slot_index) == GroupControl::PENDING)
+            {
+                const std::uint64_t entry_hash = hash(entry_at(slot_index).key());
+                const GroupControl::ControlType control =
+                    GroupControl::control_from_hash(entry_hash);
+                const SizeType group_index = claim_group(entry_hash, available);
+                if (group_index == group_index_of(slot_index))
+                {
+                    control_at(slot_index) = control;
+                    break;
+                }
+
+                const SizeType target_slot_index = slot_index_of(
+                    group_index,
+                    static_cast<SizeType>(std::countr_zero(available(group_at(group_index)))));
+                if (control_at(target_slot_index) == GroupControl::EMPTY)
+                {
+                    move_entry(slot_index, target_slot_index);
+                    control_at(target_slot_index) = control;
+                    control_at(slot_index) = GroupControl::EMPTY;
+                    break;
+                }
+
+                // Swap with the pending entry, and re-place that one next
+                PairType displaced{std::move(entry_at(target_slot_index))};
+                memory::destroy_at_address_of(entry_at(target_slot_index));
+                move_entry(slot_index, target_slot_index);
+                control_at(target_slot_index) = control;
+                memory::construct_at_address_of(
+                    IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_array_[slot_index],
+                    std::in_place,
+                    std::move(displaced));
+            }
+        }
+    }
+
+    // Destroys every entry, without touching the control bytes
+    constexpr void destroy_entries()
+    {
+        if constexpr (!TriviallyDestructible<PairType>)
+        {
+            for (SizeType slot_index = begin_index(); slot_index != end_index();
+                 slot_index = next_of(slot_index))
+            {
+                memory::destroy_at_address_of(entry_at(slot_index));
+            }
+        }
+    }
+
+    //////////////////////// Common Interface Impl
+public:
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        return static_cast<std::size_t>(IMPLEMENTATION_DETAIL_DO_NOT_USE_size_);
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType begin_index() const
+    {
+        return first_occupied_slot_from(0);
+    }
+
+    static constexpr OpaqueIteratedType invalid_index() { return NO_SLOT; }
+
+    [[nodiscard]] constexpr OpaqueIteratedType end_index() const { return invalid_index(); }
+
+    [[nodiscard]] constexpr OpaqueIteratedType next_of(const OpaqueIteratedType& slot_index) const
+    {
+        return first_occupied_slot_from(slot_index + 1);
+    }
+
+    [[nodiscard]] constexpr const K& key_at(const OpaqueIteratedType& slot_index) const
+    {
+        return entry_at(slot_index).key();
+    }
+
+    [[nodiscard]] constexpr const V& value_at(const OpaqueIteratedType& slot_index) const
+        requires PairType::HAS_ASSOCIATED_VALUE
+    {
+        return entry_at(slot_index).value();
+    }
+
+    constexpr V& value_at(const OpaqueIteratedType& slot_index)
+        requires PairType::HAS_ASSOCIATED_VALUE
+    {
+        return entry_at(slot_index).value();
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType iterated_index_from(
+        const OpaqueIndexType& index) const
+    {
+        return index.slot_index;
+    }
+
+    // `Key` is either `K`, or any type that the (transparent) `Hash` and `KeyEqual` accept.
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const Key& key) const
+    {
+        const std::uint64_t key_hash = hash(key);
+        const GroupControl::ControlType control = GroupControl::control_from_hash(key_hash);
+        const GroupControl::ControlType overflow_bit =
+            GroupControl::overflow_bit_from_hash(key_hash);
+        SizeType group_index = group_index_from_hash(key_hash);
+
+        // Bounded, in case every group has overflowed for this fingerprint
+        for (std::size_t probe = 0; probe < NUM_GROUPS; probe++)
+        {
+            const GroupControl& group = group_at(group_index);
+            for (GroupControl::MaskType candidates = group.match(control); candidates != 0;
+                 candidates &= candidates - 1)
+            {
+                const SizeType slot_index = slot_index_of(
+                    group_index, static_cast<SizeType>(std::countr_zero(candidates)));
+                if (key_equal(key, key_at(slot_index)))
+                {
+                    return {slot_index, key_hash};
+                }
+            }
+            // If no key with this overflow bit was ever pushed past this group, the key can't be
+            // in a later group
+            if (!group.has_overflowed(overflow_bit))
+            {
+                break;
+            }
+            group_index = next_group_index(group_index);
+        }
+        return {NO_SLOT, key_hash};
+    }
+
+    [[nodiscard]] constexpr bool exists(const OpaqueIndexType& index) const
+    {
+        return index.slot_index != NO_SLOT;
+    }
+
+    [[nodiscard]] constexpr const V& value(const OpaqueIndexType& index) const
+        requires PairType::HAS_ASSOCIATED_VALUE
+    {
+        // no safety checks
+        return value_at(index.slot_index);
+    }
+
+    constexpr V& value(const OpaqueIndexType& index)
+        requires PairType::HAS_ASSOCIATED_VALUE
+    {
+        // no safety checks
+        return value_at(index.slot_index);
+    }
+
+    template <typename... Args>
+    constexpr OpaqueIndexType emplace(const OpaqueIndexType& index, Args&&... args)
+    {
+        // Entries that cannot be moved stay where they are, at the cost of longer probes
+        if constexpr (CAN_MOVE_ENTRIES)
+        {
+            if (IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_ >= STALE_OVERFLOW_LIMIT)
+            {
+                rebuild_control_array();
+            }
+        }
+
+        const SizeType slot_index = place(index.hash);
+        memory::construct_at_address_of(IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_array_[slot_index],
+                                        std::in_place,
+                                        std::forward<Args>(args)...);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+        return {slot_index, index.hash};
+    }
+
+    constexpr OpaqueIteratedType erase(const OpaqueIndexType& index)
+    {
+        return erase_at(index.slot_index);
+    }
+
+    // Nothing moves on erasure, so the next entry is simply the next occupied slot
+    constexpr OpaqueIteratedType erase_at(SizeType slot_index)
+    {
+        GroupControl& group = group_at(group_index_of(slot_index));
+
+        // Overflow bits are left as-is: other keys might still rely on them
+        if (group.has_overflowed(OVERFLOW_MASK))
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_++;
+        }
+        control_at(slot_index) = GroupControl::EMPTY;
+        memory::destroy_at_address_of(entry_at(slot_index));
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_--;
+        return next_of(slot_index);
+    }
+
+    constexpr OpaqueIteratedType erase_range(const OpaqueIteratedType& start_slot_index,
+                                             const OpaqueIteratedType& end_slot_index)
+    {
+        SizeType cur_index = start_slot_index;
+        while (cur_index != end_slot_index)
+        {
+            cur_index = erase_at(cur_index);
+        }
+
+        return end_slot_index;
+    }
+
+    constexpr void clear()
+    {
+        destroy_entries();
+        // Nothing is left to rely on the overflow bits either, so they are reset too
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_control_array_ = {};
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_ = 0;
+    }
+
+public:
+    constexpr FixedSwissHashtableBase() = default;
+
+    constexpr FixedSwissHashtableBase(const Hash& hash, const KeyEqual& equal = KeyEqual())
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(hash)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(equal)
+    {
+    }
+};
+
+}  // namespace fixed_containers::fixed_swiss_hashtable_detail
+
+namespace fixed_containers::fixed_swiss_hashtable_detail::specializations
+{
+
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_VALUE_COUNT,
+          std::size_t SLOT_COUNT,
+          class Hash,
+          class KeyEqual>
+class FixedSwissHashtable
+  : public FixedSwissHashtableBase<K, V, MAXIMUM_VALUE_COUNT, SLOT_COUNT, Hash, KeyEqual>
+{
+    using Base = FixedSwissHashtableBase<K, V, MAXIMUM_VALUE_COUNT, SLOT_COUNT, Hash, KeyEqual>;
+
+public:
+    using Base::Base;
+
+    constexpr FixedSwissHashtable() = default;
+
+    constexpr FixedSwissHashtable(const FixedSwissHashtable& other)
+        requires TriviallyCopyConstructible<typename Base::PairType>
+    = default;
+    constexpr FixedSwissHashtable(FixedSwissHashtable&& other) noexcept
+        requires TriviallyMoveConstructible<typename Base::PairType>
+    = default;
+    constexpr FixedSwissHashtable& operator=(const FixedSwissHashtable& other)
+        requires TriviallyCopyAssignable<typename Base::PairType>
+    = default;
+    constexpr FixedSwissHashtable& operator=(FixedSwissHashtable&& other) noexcept
+        requires TriviallyMoveAssignable<typename Base::PairType>
+    = default;
+
+    // The control bytes say which slots hold an entry, so only those are copied. The entries stay
+    // in the same slots, so the copy needs no rehashing.
+    constexpr void nontrivial_copy_impl(const FixedSwissHashtable& other)
+    {
+        // Warning: assumes the destination (`this`) is already clear of any entries!
+        copy_bookkeeping_from(other);
+        for (auto i = other.begin_index(); i != other.end_index(); i = other.next_of(i))
+        {
+            memory::construct_at_address_of(this->IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_array_[i],
+                                            std::in_place,
+                                            other.entry_at(i));
+        }
+    }
+
+    constexpr void nontrivial_move_impl(FixedSwissHashtable& other)
+    {
+        // Warning: assumes the destination (`this`) is already clear of any entries!
+        copy_bookkeeping_from(other);
+        for (auto i = other.begin_index(); i != other.end_index(); i = other.next_of(i))
+        {
+            memory::construct_at_address_of(this->IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_array_[i],
+                                            std::in_place,
+                                            std::move(other.entry_at(i)));
+        }
+    }
+
+    constexpr FixedSwissHashtable(const FixedSwissHashtable& other)
+      : Base(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_,
+             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_)
+    {
+        nontrivial_copy_impl(other);
+    }
+    constexpr FixedSwissHashtable(FixedSwissHashtable&& other) noexcept
+      : Base(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_,
+             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_)
+    {
+        nontrivial_move_impl(other);
+        // Clear the moved-from table, like `FixedDoublyLinkedList` does for the other tables
+        other.clear();
+    }
+    constexpr FixedSwissHashtable& operator=(const FixedSwissHashtable& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        this->clear();
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+        nontrivial_copy_impl(other);
+        return *this;
+    }
+    constexpr FixedSwissHashtable& operator=(FixedSwissHashtable&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        this->clear();
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+        nontrivial_move_impl(other);
+        return *this;
+    }
+
+    constexpr ~FixedSwissHashtable() noexcept { this->destroy_entries(); }
+
+private:
+    constexpr void copy_bookkeeping_from(const FixedSwissHashtable& other)
+    {
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_control_array_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_control_array_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_;
+    }
+};
+
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_VALUE_COUNT,
+          std::size_t SLOT_COUNT,
+          class Hash,
+          class KeyEqual>
+    requires TriviallyCopyable<MapEntry<K, V>>
+class FixedSwissHashtable<K, V, MAXIMUM_VALUE_COUNT, SLOT_COUNT, Hash, KeyEqual>
+  : public FixedSwissHashtableBase<K, V, MAXIMUM_VALUE_COUNT, SLOT_COUNT, Hash, KeyEqual>
+{
+    using Base = FixedSwissHashtableBase<K, V, MAXIMUM_VALUE_COUNT, SLOT_COUNT, Hash, KeyEqual>;
+
+public:
+    using Base::Base;
+
+    constexpr FixedSwissHashtable() = default;
+
+    // disable trivial copyability when using reference value types
+    // this is an artificial limitation needed because `std::reference_wrapper` is trivially
+    // copyable
+    constexpr FixedSwissHashtable(const FixedSwissHashtable& other)
+        requires IsReference<V>
+      : Base(other)
+    {
+    }
+    constexpr FixedSwissHashtable(const FixedSwissHashtable& other)
+        requires(!IsReference<V>)
+    = default;
+
+    constexpr FixedSwissHashtable(FixedSwissHashtable&& other) = default;
+    constexpr FixedSwissHashtable& operator=(const FixedSwissHashtable& other) = default;
+    constexpr FixedSwissHashtable& operator=(FixedSwissHashtable&& other) = default;
+};
+
+}  // namespace fixed_containers::fixed_swiss_hashtable_detail::specializations
+
+namespace fixed_containers::fixed_swiss_hashtable_detail
+{
+
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_VALUE_COUNT,
+          std::size_t SLOT_COUNT,
+          class Hash,
+          class KeyEqual>
+using FixedSwissHashtable = specializations::
+    FixedSwissHashtable<K, V, MAXIMUM_VALUE_COUNT, SLOT_COUNT, Hash, KeyEqual>;
+
+constexpr std::size_t default_slot_count(std::size_t value_count)
+{
+    // Group matching stays fast at high load factors, so only oversize by ~15% (7/8 max load)
+    return (value_count * 8 + 6) / 7;
+}
+
+}  // namespace fixed_containers::fixed_swiss_hashtable_detail
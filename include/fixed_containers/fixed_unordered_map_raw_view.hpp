@@ -9,6 +9,7 @@
 namespace fixed_containers
 {
 
+// Only applies to the default `LinkedListValueStorage` layout.
 class FixedUnorderedMapRawView
 {
 private:
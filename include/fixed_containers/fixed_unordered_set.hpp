@@ -17,18 +17,43 @@ template <typename K,
           class KeyEqual = std::equal_to<K>,
           std::size_t BUCKET_COUNT =
               fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE),
-          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>,
+          class BucketIndexing = fixed_robinhood_hashtable_detail::ModuloBucketIndexing,
+          class ValueStorage = fixed_robinhood_hashtable_detail::LinkedListValueStorage,
+          class Tuning = fixed_robinhood_hashtable_detail::DefaultHashtableTuning>
 class FixedUnorderedSet
   : public FixedSetAdapter<
         K,
-        fixed_robinhood_hashtable_detail::
-            FixedRobinhoodHashtable<K, EmptyValue, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        fixed_robinhood_hashtable_detail::FixedRobinhoodHashtable<
+            K,
+            EmptyValue,
+            MAXIMUM_SIZE,
+            fixed_robinhood_hashtable_detail::resolve_bucket_count<Tuning>(BUCKET_COUNT,
+                                                                          MAXIMUM_SIZE),
+            Hash,
+            KeyEqual,
+            BucketIndexing,
+            ValueStorage,
+            Tuning>,
         CheckingType>
 {
+    static_assert(
+        fixed_robinhood_hashtable_detail::is_valid_bucket_count_for_tuning<Tuning>(BUCKET_COUNT),
+        "The load factor of the Tuning only applies with BUCKET_COUNT = AUTO_BUCKET_COUNT");
+
     using FSA = FixedSetAdapter<
         K,
-        fixed_robinhood_hashtable_detail::
-            FixedRobinhoodHashtable<K, EmptyValue, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        fixed_robinhood_hashtable_detail::FixedRobinhoodHashtable<
+            K,
+            EmptyValue,
+            MAXIMUM_SIZE,
+            fixed_robinhood_hashtable_detail::resolve_bucket_count<Tuning>(BUCKET_COUNT,
+                                                                          MAXIMUM_SIZE),
+            Hash,
+            KeyEqual,
+            BucketIndexing,
+            ValueStorage,
+            Tuning>,
         CheckingType>;
 
 public:
@@ -148,10 +173,19 @@ template <typename K,
           std::size_t BUCKET_COUNT,
           class Hash,
           class KeyEqual,
-          fixed_containers::customize::SetChecking<K> CheckingType>
-struct tuple_size<
-    fixed_containers::
-        FixedUnorderedSet<K, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>>
+          fixed_containers::customize::SetChecking<K> CheckingType,
+          class BucketIndexing,
+          class ValueStorage,
+          class Tuning>
+struct tuple_size<fixed_containers::FixedUnorderedSet<K,
+                                                      MAXIMUM_SIZE,
+                                                      Hash,
+                                                      KeyEqual,
+                                                      BUCKET_COUNT,
+                                                      CheckingType,
+                                                      BucketIndexing,
+                                                      ValueStorage,
+                                                      Tuning>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
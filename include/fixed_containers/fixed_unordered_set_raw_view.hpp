@@ -5,6 +5,7 @@
 namespace fixed_containers
 {
 
+// Only applies to the default `LinkedListValueStorage` layout.
 class FixedUnorderedSetRawView
   : public fixed_doubly_linked_list_detail::FixedDoublyLinkedListRawView<uint32_t>
 {
@@ -2,6 +2,7 @@
 
 #include "fixed_containers/algorithm.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/int_math.hpp"
 #include "fixed_containers/iterator_utils.hpp"
 #include "fixed_containers/memory.hpp"
 #include "fixed_containers/optional_storage.hpp"
@@ -16,6 +17,7 @@
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <span>
 #include <type_traits>
 
 namespace fixed_containers::fixed_vector_detail
@@ -102,6 +104,9 @@ class FixedVectorBase
                   "Vector must have a non-const, non-volatile value_type");
     using Checking = CheckingType;
     using Array = std::array<OptionalT, MAXIMUM_SIZE>;
+    // The size never exceeds MAXIMUM_SIZE, so small vectors don't need a full std::size_t for it.
+    // Notably, this shrinks short FixedStrings by up to 7 bytes.
+    using SizeStorageType = int_math::SmallestUnsignedIntegralFor<MAXIMUM_SIZE>;
 
     struct Mapper
     {
@@ -150,7 +155,7 @@ private:
     }
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
-    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    SizeStorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
     Array IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
 
 public:
@@ -253,6 +258,43 @@ public:
         }
     }
 
+    /**
+     * Resizes the container to contain `count` elements, without initializing the new ones, so
+     * that they can be directly overwritten, e.g. by `read()`.
+     * Only available for types that need no initialization or destruction.
+     */
+    constexpr void resize_for_overwrite(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+        requires TriviallyDefaultConstructible<T> && TriviallyDestructible<T>
+    {
+        check_target_size(count, loc);
+        set_size(count);
+    }
+
+    /**
+     * Same as `std::string::resize_and_overwrite()`: Makes room for `count` elements without
+     * initializing the new ones, then calls `op(data(), count)`, which writes the elements and
+     * returns the final size, at most `count`.
+     * Only available for types that need no initialization or destruction.
+     */
+    template <class Operation>
+    constexpr void resize_and_overwrite(
+        size_type count,
+        Operation op,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+        requires TriviallyDefaultConstructible<T> && TriviallyDestructible<T>
+    {
+        check_target_size(count, loc);
+        const auto new_size = static_cast<size_type>(std::move(op)(data(), count));
+        if (preconditions::test(new_size <= count))
+        {
+            Checking::invalid_argument("resize_and_overwrite operation returned a size > count",
+                                       loc);
+        }
+        set_size(new_size);
+    }
+
     /**
      * Appends the given element value to the end of the container.
      * Calling push_back on a full container is undefined.
@@ -284,6 +326,38 @@ public:
         return this->back();
     }
 
+    /**
+     * Same as `push_back()`/`emplace_back()`, but without any checks or source locations, for hot
+     * loops that have already made sure there is enough room, e.g. once for a whole batch.
+     * Calling these on a full container is undefined.
+     */
+    constexpr void push_back_unchecked(const value_type& value) { push_back_internal(value); }
+    constexpr void push_back_unchecked(value_type&& value)
+    {
+        push_back_internal(std::move(value));
+    }
+    template <class... Args>
+    constexpr reference emplace_back_unchecked(Args&&... args)
+    {
+        emplace_at(end_index(), std::forward<Args>(args)...);
+        increment_size();
+        return unchecked_at(back_index());
+    }
+
+    /**
+     * Appends copies of all the `values` to the end of the container, without any checks.
+     * Calling append_unchecked with more values than the remaining capacity is undefined.
+     */
+    constexpr void append_unchecked(const std::span<const value_type> values)
+    {
+        std::size_t index = end_index();
+        for (const value_type& value : values)
+        {
+            place_at(index++, value);
+        }
+        set_size(index);
+    }
+
     /**
      * Removes the last element of the container.
      * Calling pop_back on an empty container is undefined.
@@ -729,17 +803,11 @@ private:
     }
     constexpr Array& array() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_; }
 
-    constexpr void increment_size(const std::size_t n = 1)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
-    }
-    constexpr void decrement_size(const std::size_t n = 1)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
-    }
+    constexpr void increment_size(const std::size_t n = 1) { set_size(size() + n); }
+    constexpr void decrement_size(const std::size_t n = 1) { set_size(size() - n); }
     constexpr void set_size(const std::size_t size)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = static_cast<SizeStorageType>(size);
     }
 
     [[nodiscard]] constexpr const T& unchecked_at(const std::size_t index) const
@@ -1013,6 +1081,13 @@ public:
     }
 };
 
+// The entries are stored inline, so the vector can be relocated with its bytes whenever they can
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+struct IsTriviallyRelocatable<FixedVector<T, MAXIMUM_SIZE, CheckingType>>
+  : std::bool_constant<TriviallyRelocatable<T>>
+{
+};
+
 template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
 [[nodiscard]] constexpr bool is_full(const FixedVector<T, MAXIMUM_SIZE, CheckingType>& container)
 {
@@ -3,6 +3,10 @@
 #include "fixed_containers/assert_or_abort.hpp"
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace fixed_containers::int_math
 {
@@ -98,4 +102,41 @@ constexpr T divide_integers_rounding_up(const T dividend, const T divisor)
     return ((dividend - static_cast<T>(1)) / divisor) + static_cast<T>(1);
 }
 
+// The size of the smallest unsigned integral type that can hold every value in
+// [0, maximum_value], with its `reserved_high_bits` most significant bits left free (e.g. for a
+// flag). Useful for storing sizes and indices that are bounded by a compile-time capacity.
+[[nodiscard]] constexpr std::size_t smallest_unsigned_integral_size_bytes(
+    const std::size_t maximum_value, const std::size_t reserved_high_bits = 0)
+{
+    const auto fits_in = [&](const std::size_t type_max)
+    { return maximum_value <= (type_max >> reserved_high_bits); };
+    if (fits_in((std::numeric_limits<std::uint8_t>::max)()))
+    {
+        return sizeof(std::uint8_t);
+    }
+    if (fits_in((std::numeric_limits<std::uint16_t>::max)()))
+    {
+        return sizeof(std::uint16_t);
+    }
+    if (fits_in((std::numeric_limits<std::uint32_t>::max)()))
+    {
+        return sizeof(std::uint32_t);
+    }
+    return sizeof(std::size_t);
+}
+
+template <std::size_t MAXIMUM_VALUE, std::size_t RESERVED_HIGH_BITS = 0>
+using SmallestUnsignedIntegralFor = std::conditional_t<
+    smallest_unsigned_integral_size_bytes(MAXIMUM_VALUE, RESERVED_HIGH_BITS) ==
+        sizeof(std::uint8_t),
+    std::uint8_t,
+    std::conditional_t<smallest_unsigned_integral_size_bytes(MAXIMUM_VALUE, RESERVED_HIGH_BITS) ==
+                           sizeof(std::uint16_t),
+                       std::uint16_t,
+                       std::conditional_t<smallest_unsigned_integral_size_bytes(
+                                              MAXIMUM_VALUE, RESERVED_HIGH_BITS) ==
+                                              sizeof(std::uint32_t),
+                                          std::uint32_t,
+                                          std::size_t>>>;
+
 }  // namespace fixed_containers::int_math
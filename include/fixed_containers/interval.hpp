@@ -0,0 +1,70 @@
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+// Anything with `low` and `high` endpoints of the same type that are ordered by `<`. Intervals are
+// half-open, i.e. they contain the points in [low, high).
+template <class T>
+concept IsInterval = requires(const T& interval) {
+    interval.low;
+    interval.high;
+    requires std::same_as<std::remove_cvref_t<decltype(interval.low)>,
+                          std::remove_cvref_t<decltype(interval.high)>>;
+    { interval.low < interval.high } -> std::convertible_to<bool>;
+};
+
+template <IsInterval T>
+using IntervalEndpointType = std::remove_cvref_t<decltype(std::declval<const T&>().high)>;
+
+// A plain half-open interval [low, high). Like `Pair`, this is trivially copyable and a structural
+// type whenever `T` is.
+template <class T>
+struct Interval
+{
+    using endpoint_type = T;
+
+    T low;
+    T high;
+
+    [[nodiscard]] constexpr bool contains(const T& point) const
+    {
+        return !(point < low) && point < high;
+    }
+    [[nodiscard]] constexpr bool overlaps(const Interval& other) const
+    {
+        return low < other.high && other.low < high;
+    }
+
+    // Same order as `IntervalLowThenHighLess`
+    constexpr auto operator<=>(const Interval& other) const = default;
+    constexpr bool operator==(const Interval& other) const = default;
+};
+
+template <class T>
+Interval(T low, T high) -> Interval<T>;
+
+// Orders intervals by their `low` endpoint first, then by their `high` one. Interval queries rely
+// on the intervals being visited in the order of their `low` endpoints.
+struct IntervalLowThenHighLess
+{
+    template <IsInterval T>
+    constexpr bool operator()(const T& left, const T& right) const
+    {
+        if (left.low < right.low)
+        {
+            return true;
+        }
+        if (right.low < left.low)
+        {
+            return false;
+        }
+        return left.high < right.high;
+    }
+};
+
+}  // namespace fixed_containers
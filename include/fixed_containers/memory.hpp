@@ -1,6 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
 
 namespace fixed_containers::memory
 {
@@ -34,6 +39,23 @@ constexpr void destroy_and_construct_at_address_of(T& ref, Args&&... args)
     construct_at_address_of(ref, std::forward<Args>(args)...);
 }
 
+// Hints the CPU to start loading the cache line of `ref`, ahead of a read. Only a hint: this is a
+// no-op during constant evaluation and on compilers without a prefetch intrinsic.
+template <typename T>
+constexpr void prefetch_for_read(const T& ref)
+{
+    if (std::is_constant_evaluated())
+    {
+        return;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(std::addressof(ref), 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(static_cast<const void*>(std::addressof(ref))),
+                 _MM_HINT_T0);
+#endif
+}
+
 template <typename T>
 const std::byte* addressof_as_const_byte_ptr(T& ref)
 {
@@ -248,6 +248,14 @@ public:
         return out;
     }
 
+    // The ReferenceProvider type is typically private to the iterator-owning class or in some
+    // detail namespace.
+    template <typename ReturnType>
+    [[nodiscard]] constexpr const ReturnType& private_reference_provider() const
+    {
+        return reference_provider_;
+    }
+
 private:
     constexpr void addition_assignment_op_impl(const std::size_t n)
     {
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "fixed_containers/forward_iterator.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/sorted_unique.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+
+namespace fixed_containers::set_operations_detail
+{
+enum class SetOperation
+{
+    UNION,
+    INTERSECTION,
+    DIFFERENCE,
+};
+
+// Walks two ranges that are sorted with no equivalent entries in lockstep, and provides the entries
+// that belong to the result of `OPERATION` in order. Entries that are present in both ranges are
+// taken from the first one. `Compare` orders the entries of either range against each other.
+template <SetOperation OPERATION, class It1, class It2, class Compare>
+class SetOperationEntryProvider
+{
+    It1 first1_;
+    It1 last1_;
+    It2 first2_;
+    It2 last2_;
+    const Compare* compare_;
+    bool from_first_;
+
+public:
+    constexpr SetOperationEntryProvider() noexcept
+      : first1_{}
+      , last1_{}
+      , first2_{}
+      , last2_{}
+      , compare_{nullptr}
+      , from_first_{true}
+    {
+    }
+
+    constexpr SetOperationEntryProvider(
+        It1 first1, It1 last1, It2 first2, It2 last2, const Compare& compare) noexcept
+      : first1_{first1}
+      , last1_{last1}
+      , first2_{first2}
+      , last2_{last2}
+      , compare_{&compare}
+      , from_first_{true}
+    {
+        settle();
+    }
+
+    constexpr void advance() noexcept
+    {
+        if constexpr (OPERATION == SetOperation::UNION)
+        {
+            if (!from_first_)
+            {
+                ++first2_;
+            }
+            else
+            {
+                if (first2_ != last2_ && !less(*first1_, *first2_))
+                {
+                    ++first2_;
+                }
+                ++first1_;
+            }
+        }
+        else if constexpr (OPERATION == SetOperation::INTERSECTION)
+        {
+            ++first1_;
+            ++first2_;
+        }
+        else
+        {
+            ++first1_;
+        }
+        settle();
+    }
+
+    [[nodiscard]] constexpr std::iter_reference_t<It1> get() const noexcept
+    {
+        if (from_first_)
+        {
+            return *first1_;
+        }
+        return *first2_;
+    }
+
+    constexpr bool operator==(const SetOperationEntryProvider& other) const noexcept
+    {
+        return first1_ == other.first1_ && first2_ == other.first2_;
+    }
+
+private:
+    [[nodiscard]] constexpr bool less(const auto& left, const auto& right) const
+    {
+        return (*compare_)(left, right);
+    }
+
+    // Moves to the next entry of the result. Once there are no more, both ranges are at their end,
+    // so that the provider compares equal to the one that was created past the end.
+    constexpr void settle() noexcept
+    {
+        if constexpr (OPERATION == SetOperation::UNION)
+        {
+            from_first_ = first2_ == last2_ || (first1_ != last1_ && !less(*first2_, *first1_));
+        }
+        else if constexpr (OPERATION == SetOperation::INTERSECTION)
+        {
+            while (first1_ != last1_ && first2_ != last2_)
+            {
+                if (less(*first1_, *first2_))
+                {
+                    ++first1_;
+                }
+                else if (less(*first2_, *first1_))
+                {
+                    ++first2_;
+                }
+                else
+                {
+                    return;
+                }
+            }
+            first1_ = last1_;
+            first2_ = last2_;
+        }
+        else
+        {
+            while (first1_ != last1_ && first2_ != last2_)
+            {
+                if (less(*first2_, *first1_))
+                {
+                    ++first2_;
+                }
+                else if (less(*first1_, *first2_))
+                {
+                    return;
+                }
+                else
+                {
+                    ++first1_;
+                    ++first2_;
+                }
+            }
+            if (first1_ == last1_)
+            {
+                first2_ = last2_;
+            }
+        }
+    }
+};
+
+// The entries of maps are ordered by their keys only.
+template <class ContainerType>
+class EntryCompare
+{
+    using KeyCompare = typename ContainerType::key_compare;
+    static constexpr bool IS_MAP = requires { typename ContainerType::mapped_type; };
+
+    KeyCompare key_compare_;
+
+public:
+    explicit constexpr EntryCompare(const KeyCompare& key_compare)
+      : key_compare_{key_compare}
+    {
+    }
+
+    constexpr bool operator()(const auto& left, const auto& right) const
+    {
+        if constexpr (IS_MAP)
+        {
+            return key_compare_(left.first, right.first);
+        }
+        else
+        {
+            return key_compare_(left, right);
+        }
+    }
+};
+
+// Both containers must iterate in the same order over the same kind of entries, and the result is
+// built through the sorted_unique constructor of the first one.
+template <class ContainerType, class OtherContainerType>
+concept SupportsSetOperations =
+    std::same_as<typename ContainerType::key_type, typename OtherContainerType::key_type> &&
+    std::same_as<typename ContainerType::key_compare,
+                 typename OtherContainerType::key_compare> &&
+    std::same_as<std::iter_reference_t<typename ContainerType::const_iterator>,
+                 std::iter_reference_t<typename OtherContainerType::const_iterator>> &&
+    requires(const ContainerType& container) {
+        ContainerType(std_transition::sorted_unique,
+                      container.cbegin(),
+                      container.cend(),
+                      container.key_comp(),
+                      std_transition::source_location::current());
+    };
+
+// Returns a `ContainerType` that holds the result of `OPERATION` on the two containers. Their
+// entries are visited in order, and the result is bulk-built with the sorted_unique constructor,
+// so this is O(N + M) without searching the result for every entry.
+template <SetOperation OPERATION, class ContainerType, class OtherContainerType>
+[[nodiscard]] constexpr ContainerType apply(const ContainerType& first,
+                                            const OtherContainerType& second,
+                                            const std_transition::source_location& loc)
+{
+    using EntryProvider = SetOperationEntryProvider<OPERATION,
+                                                    typename ContainerType::const_iterator,
+                                                    typename OtherContainerType::const_iterator,
+                                                    EntryCompare<ContainerType>>;
+    using Iterator =
+        ForwardIterator<EntryProvider, EntryProvider, IteratorConstness::CONSTANT_ITERATOR>;
+
+    const EntryCompare<ContainerType> compare{first.key_comp()};
+    const Iterator result_begin{
+        first.cbegin(), first.cend(), second.cbegin(), second.cend(), compare};
+    const Iterator result_end{first.cend(), first.cend(), second.cend(), second.cend(), compare};
+    return ContainerType(
+        std_transition::sorted_unique, result_begin, result_end, first.key_comp(), loc);
+}
+
+}  // namespace fixed_containers::set_operations_detail
+
+namespace fixed_containers
+{
+// Counterparts of `std::set_union()`, `std::set_intersection()`, `std::set_difference()` and
+// `std::includes()` for sorted containers. The results are of the same type as `first`, and entries
+// that are present in both containers are taken from `first`. For maps, only the keys are compared.
+template <class ContainerType, class OtherContainerType>
+    requires set_operations_detail::SupportsSetOperations<ContainerType, OtherContainerType>
+[[nodiscard]] constexpr ContainerType set_union(
+    const ContainerType& first,
+    const OtherContainerType& second,
+    const std_transition::source_location& loc = std_transition::source_location::current())
+{
+    return set_operations_detail::apply<set_operations_detail::SetOperation::UNION>(
+        first, second, loc);
+}
+
+template <class ContainerType, class OtherContainerType>
+    requires set_operations_detail::SupportsSetOperations<ContainerType, OtherContainerType>
+[[nodiscard]] constexpr ContainerType set_intersection(
+    const ContainerType& first,
+    const OtherContainerType& second,
+    const std_transition::source_location& loc = std_transition::source_location::current())
+{
+    return set_operations_detail::apply<set_operations_detail::SetOperation::INTERSECTION>(
+        first, second, loc);
+}
+
+template <class ContainerType, class OtherContainerType>
+    requires set_operations_detail::SupportsSetOperations<ContainerType, OtherContainerType>
+[[nodiscard]] constexpr ContainerType set_difference(
+    const ContainerType& first,
+    const OtherContainerType& second,
+    const std_transition::source_location& loc = std_transition::source_location::current())
+{
+    return set_operations_detail::apply<set_operations_detail::SetOperation::DIFFERENCE>(
+        first, second, loc);
+}
+
+template <class ContainerType, class OtherContainerType>
+    requires set_operations_detail::SupportsSetOperations<ContainerType, OtherContainerType>
+[[nodiscard]] constexpr bool includes(const ContainerType& first, const OtherContainerType& second)
+{
+    return std::includes(first.cbegin(),
+                         first.cend(),
+                         second.cbegin(),
+                         second.cend(),
+                         set_operations_detail::EntryCompare<ContainerType>{first.key_comp()});
+}
+}  // namespace fixed_containers
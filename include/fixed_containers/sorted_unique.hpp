@@ -0,0 +1,13 @@
+#pragma once
+
+namespace fixed_containers::std_transition
+{
+// Tags a range as sorted with no equivalent keys, so that it can be inserted without sorting or
+// deduplicating it first. Same as C++23's `std::sorted_unique_t` from <flat_map>.
+struct sorted_unique_t  // NOLINT(readability-identifier-naming)
+{
+    explicit sorted_unique_t() = default;
+};
+inline constexpr fixed_containers::std_transition::sorted_unique_t
+    sorted_unique{};  // NOLINT(readability-identifier-naming)
+}  // namespace fixed_containers::std_transition
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <cstdint>
@@ -7,6 +8,8 @@
 #include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 // This is a stripped-down implementation of wyhash: https://github.com/wangyi-fudan/wyhash
 // No big-endian support (because different values on different machines don't matter),
@@ -61,37 +64,48 @@ constexpr void mum(std::uint64_t* aaa, std::uint64_t* bbb)
     return aaa ^ bbb;
 }
 
+// Byte types that can be read without going through `void*`, which keeps hashing them constexpr.
+template <typename ByteT>
+concept ByteLike = sizeof(ByteT) == 1 && std::is_integral_v<ByteT>;
+
 // read functions. WARNING: we don't care about endianness, so results are different on big endian!
-[[nodiscard]] inline auto r8(const std::uint8_t* ppp) -> std::uint64_t
+template <ByteLike ByteT>
+[[nodiscard]] constexpr auto r8(const ByteT* ppp) -> std::uint64_t
 {
     std::array<std::uint8_t, 8> bytes{};
     std::copy_n(ppp, 8, bytes.begin());
     return std::bit_cast<std::uint64_t>(bytes);
 }
 
-[[nodiscard]] inline auto r4(const std::uint8_t* ppp) -> std::uint64_t
+template <ByteLike ByteT>
+[[nodiscard]] constexpr auto r4(const ByteT* ppp) -> std::uint64_t
 {
     std::array<std::uint8_t, 4> bytes{};
     std::copy_n(ppp, 4, bytes.begin());
     return static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(bytes));
 }
 
+template <ByteLike ByteT>
+[[nodiscard]] constexpr auto r1(const ByteT* ppp) -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint8_t>(*ppp));
+}
+
 // reads 1, 2, or 3 bytes
-[[nodiscard]] inline auto r3(const std::uint8_t* ppp, std::int64_t kkk) -> std::uint64_t
+template <ByteLike ByteT>
+[[nodiscard]] constexpr auto r3(const ByteT* ppp, std::int64_t kkk) -> std::uint64_t
 {
-    return (static_cast<std::uint64_t>(*ppp) << 16U) |
-           (static_cast<std::uint64_t>(*std::next(ppp, kkk >> 1U)) << 8U) |
-           *std::next(ppp, kkk - 1);
+    return (r1(ppp) << 16U) | (r1(std::next(ppp, kkk >> 1U)) << 8U) | r1(std::next(ppp, kkk - 1));
 }
 
-[[maybe_unused]] [[nodiscard]] inline auto hash(void const* key, std::int64_t len) -> std::uint64_t
+template <ByteLike ByteT>
+[[nodiscard]] constexpr auto hash_bytes(const ByteT* ppp, std::int64_t len) -> std::uint64_t
 {
     constexpr auto SECRET = std::array{UINT64_C(0xa0761d6478bd642f),
                                        UINT64_C(0xe7037ed1a0b428db),
                                        UINT64_C(0x8ebc6af09c88c6e3),
                                        UINT64_C(0x589965cc75374cc3)};
 
-    auto const* ppp = static_cast<std::uint8_t const*>(key);
     std::uint64_t seed = SECRET[0];
     std::uint64_t aaa{};
     std::uint64_t bbb{};
@@ -144,6 +158,11 @@ constexpr void mum(std::uint64_t* aaa, std::uint64_t* bbb)
     return mix(SECRET[1] ^ static_cast<std::uint64_t>(len), mix(aaa ^ SECRET[1], bbb ^ seed));
 }
 
+[[maybe_unused]] [[nodiscard]] inline auto hash(void const* key, std::int64_t len) -> std::uint64_t
+{
+    return hash_bytes(static_cast<std::uint8_t const*>(key), len);
+}
+
 [[nodiscard]] constexpr std::uint64_t hash(std::uint64_t value)
 {
     return mix(value, UINT64_C(0x9E3779B97F4A7C15));
@@ -166,24 +185,31 @@ struct hash  // NOLINT(readability-identifier-naming)
     }
 };
 
+// Transparent: anything convertible to a `std::basic_string_view<CharT>` (`std::basic_string`,
+// `FixedString`, `const CharT*`, ...) hashes to the same value as its contents, so lookups don't need
+// to construct the key type.
 template <typename CharT>
-struct hash<std::basic_string<CharT>>
+struct hash<std::basic_string_view<CharT>>
 {
-    std::uint64_t operator()(std::basic_string<CharT> const& str) const noexcept
+    using is_transparent = void;
+
+    constexpr std::uint64_t operator()(std::basic_string_view<CharT> str) const noexcept
     {
-        return wyhash_detail::hash(str.data(),
-                                   static_cast<std::int64_t>(sizeof(CharT) * str.size()));
+        if constexpr (wyhash_detail::ByteLike<CharT>)
+        {
+            return wyhash_detail::hash_bytes(str.data(), static_cast<std::int64_t>(str.size()));
+        }
+        else
+        {
+            return wyhash_detail::hash(str.data(),
+                                       static_cast<std::int64_t>(sizeof(CharT) * str.size()));
+        }
     }
 };
 
 template <typename CharT>
-struct hash<std::basic_string_view<CharT>>
+struct hash<std::basic_string<CharT>> : hash<std::basic_string_view<CharT>>
 {
-    std::uint64_t operator()(std::basic_string_view<CharT> const& str) const noexcept
-    {
-        return wyhash_detail::hash(str.data(),
-                                   static_cast<std::int64_t>(sizeof(CharT) * str.size()));
-    }
 };
 
 template <class T>
@@ -234,4 +260,11 @@ struct hash<T>
     }
 };
 
+// Character arrays hash their contents (up to the null terminator), like `std::basic_string_view`.
+// `FixedString` does the same, see its header.
+template <typename CharT, std::size_t N>
+struct hash<CharT[N]> : hash<std::basic_string_view<std::remove_const_t<CharT>>>
+{
+};
+
 }  // namespace fixed_containers::wyhash
@@ -0,0 +1,440 @@
+#pragma once
+
+#include "fixed_containers/sorted_unique.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers::benchmark_utils
+{
+// An element of (exactly) `SIZE` bytes. Used to parameterize benchmarks over the element size.
+template <std::size_t SIZE>
+struct Payload
+{
+    static_assert(SIZE >= sizeof(std::uint32_t) && SIZE % sizeof(std::uint32_t) == 0);
+
+    std::array<std::uint32_t, SIZE / sizeof(std::uint32_t)> data{};
+
+    constexpr Payload() = default;
+    explicit constexpr Payload(std::size_t value)
+      : data{}
+    {
+        data[0] = static_cast<std::uint32_t>(value);
+    }
+
+    constexpr auto operator<=>(const Payload& other) const = default;
+};
+
+struct PayloadHash
+{
+    template <std::size_t SIZE>
+    constexpr std::uint64_t operator()(const Payload<SIZE>& payload) const
+    {
+        return wyhash::hash<std::uint32_t>{}(payload.data[0]);
+    }
+};
+static_assert(sizeof(Payload<4>) == 4);
+static_assert(sizeof(Payload<1024>) == 1024);
+
+// Fill ratios (in percent of the capacity) that every container benchmark is run with.
+inline void fill_ratios(benchmark::internal::Benchmark* bench)
+{
+    for (const std::int64_t percent : {25, 50, 100})
+    {
+        bench->Arg(percent);
+    }
+}
+
+[[nodiscard]] inline std::size_t element_count(const benchmark::State& state, std::size_t capacity)
+{
+    return (std::max<std::size_t>)(1, (capacity * static_cast<std::size_t>(state.range(0))) / 100);
+}
+
+// Invokes `func.template operator()<ElementType, CAPACITY>()` for every (element size, capacity)
+// combination of the benchmark grid. Capacity is swept with small elements, and element size is
+// swept at a medium capacity.
+template <typename Func>
+void for_each_shape(Func&& func)
+{
+    func.template operator()<Payload<4>, 16>();
+    func.template operator()<Payload<4>, 256>();
+    func.template operator()<Payload<4>, 4096>();
+    func.template operator()<Payload<4>, 65536>();
+    func.template operator()<Payload<64>, 4096>();
+    func.template operator()<Payload<1024>, 4096>();
+}
+
+template <typename T, std::size_t CAPACITY>
+[[nodiscard]] std::string benchmark_name(std::string_view operation, std::string_view container)
+{
+    return std::string{operation} + "/" + std::string{container} + "<" +
+           std::to_string(sizeof(T)) + "B," + std::to_string(CAPACITY) + ">";
+}
+
+// Distinct keys (the multiplier is odd, so this is a bijection), in an order that is neither sorted
+// nor reverse-sorted.
+// Enum keys are dense, so they are used as-is.
+template <typename K>
+[[nodiscard]] constexpr K key_at(std::size_t i)
+{
+    if constexpr (std::is_enum_v<K>)
+    {
+        return static_cast<K>(i);
+    }
+    else
+    {
+        return static_cast<K>(static_cast<std::uint32_t>(i) * 2654435761U);
+    }
+}
+
+// An index sequence that visits [0, count) out of order, to defeat the prefetcher.
+[[nodiscard]] constexpr std::size_t scattered_index(std::size_t i, std::size_t count)
+{
+    return (i * 7919) % count;
+}
+
+// Containers with 64K entries of 1 KB each do not fit on the stack.
+template <typename ContainerType>
+[[nodiscard]] std::unique_ptr<ContainerType> make_heap_allocated()
+{
+    return std::make_unique<ContainerType>();
+}
+
+template <typename ContainerType, typename K>
+constexpr void insert_key(ContainerType& container, const K& key)
+{
+    if constexpr (requires { typename ContainerType::mapped_type; })
+    {
+        container.try_emplace(key);
+    }
+    else
+    {
+        container.insert(key);
+    }
+}
+
+template <typename ContainerType>
+void fill_associative(ContainerType& instance, std::size_t count)
+{
+    using K = typename ContainerType::key_type;
+    instance.clear();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        insert_key(instance, key_at<K>(i));
+    }
+}
+
+template <typename ContainerType>
+concept SupportsSortedUniqueInsertion =
+    requires(ContainerType& instance, const typename ContainerType::value_type* entries) {
+        instance.insert(std_transition::sorted_unique, entries, entries);
+    };
+
+// The same entries as `fill_associative()`, sorted by key.
+template <typename ContainerType>
+std::vector<typename ContainerType::value_type> sorted_entries(std::size_t count)
+{
+    using K = typename ContainerType::key_type;
+    std::vector<K> keys{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        keys.push_back(key_at<K>(i));
+    }
+    std::ranges::sort(keys);
+
+    std::vector<typename ContainerType::value_type> entries{};
+    for (const K& key : keys)
+    {
+        if constexpr (requires { typename ContainerType::mapped_type; })
+        {
+            entries.emplace_back(key, typename ContainerType::mapped_type{});
+        }
+        else
+        {
+            entries.emplace_back(key);
+        }
+    }
+    return entries;
+}
+
+// Containers that keep their entries in a sorted array insert a single entry in O(N), so filling
+// them one entry at a time takes O(N^2). Unless the filling itself is being measured, containers
+// that accept a sorted range are filled with one instead.
+template <typename ContainerType>
+void prepare_associative(ContainerType& instance, std::size_t count)
+{
+    if constexpr (SupportsSortedUniqueInsertion<ContainerType>)
+    {
+        const auto entries = sorted_entries<ContainerType>(count);
+        instance.clear();
+        instance.insert(std_transition::sorted_unique, entries.begin(), entries.end());
+    }
+    else
+    {
+        fill_associative(instance, count);
+    }
+}
+
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_insert(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+
+    for (auto _ : state)
+    {
+        fill_associative(*instance, count);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_insert_sorted_unique(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+    const auto entries = sorted_entries<ContainerType>(count);
+
+    for (auto _ : state)
+    {
+        instance->clear();
+        instance->insert(std_transition::sorted_unique, entries.begin(), entries.end());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+// Fills the container in ascending key order, e.g. with timestamps, optionally hinting every entry
+// at the end.
+template <typename ContainerType, std::size_t CAPACITY, bool HINTED>
+void benchmark_associative_insert_ascending(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+    const auto entries = sorted_entries<ContainerType>(count);
+
+    for (auto _ : state)
+    {
+        instance->clear();
+        for (const auto& entry : entries)
+        {
+            if constexpr (HINTED)
+            {
+                instance->insert(instance->cend(), entry);
+            }
+            else
+            {
+                instance->insert(entry);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_erase_and_reinsert(benchmark::State& state)
+{
+    using K = typename ContainerType::key_type;
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+    prepare_associative(*instance, count);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const K key = key_at<K>(scattered_index(i++, count));
+        instance->erase(key);
+        insert_key(*instance, key);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_lookup(benchmark::State& state)
+{
+    using K = typename ContainerType::key_type;
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+    prepare_associative(*instance, count);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        auto it = instance->find(key_at<K>(scattered_index(i++, count)));
+        benchmark::DoNotOptimize(it);
+    }
+}
+
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_lookup_miss(benchmark::State& state)
+{
+    using K = typename ContainerType::key_type;
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+    prepare_associative(*instance, count);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        // Only the first `count` keys were inserted
+        auto it = instance->find(key_at<K>(count + scattered_index(i++, count)));
+        benchmark::DoNotOptimize(it);
+    }
+}
+
+// Same keys as `lookup`, resolved `BATCH_SIZE` at a time with `find_batch()`.
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_lookup_batch(benchmark::State& state)
+{
+    static constexpr std::size_t BATCH_SIZE = 32;
+    using K = typename ContainerType::key_type;
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+    prepare_associative(*instance, count);
+
+    std::array<K, BATCH_SIZE> keys{};
+    std::array<typename ContainerType::const_iterator, BATCH_SIZE> out{};
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        for (K& key : keys)
+        {
+            key = key_at<K>(scattered_index(i++, count));
+        }
+        std::as_const(*instance).find_batch(keys, out);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BATCH_SIZE));
+}
+
+// Erase-heavy workload where every insertion is a key that was never seen before, by sliding a
+// window of `count` keys. Unlike `erase_and_reinsert`, this exposes any state that erasures leave
+// behind (e.g. tombstones in open-addressing hashtables).
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_sliding_window(benchmark::State& state)
+{
+    using K = typename ContainerType::key_type;
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+    prepare_associative(*instance, count);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        instance->erase(key_at<K>(i));
+        insert_key(*instance, key_at<K>(i + count));
+        i++;
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_iterate(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<ContainerType>();
+    prepare_associative(*instance, count);
+
+    for (auto _ : state)
+    {
+        for (const auto& entry : *instance)
+        {
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename ContainerType, std::size_t CAPACITY>
+void benchmark_associative_copy(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto source = make_heap_allocated<ContainerType>();
+    auto destination = make_heap_allocated<ContainerType>();
+    prepare_associative(*source, count);
+
+    for (auto _ : state)
+    {
+        *destination = *source;
+        benchmark::ClobberMemory();
+    }
+}
+
+// Registers insert/erase/lookup/iterate/copy benchmarks for a single container type, holding
+// `CAPACITY` elements of type `T` at most.
+template <typename ContainerType, typename T, std::size_t CAPACITY>
+void register_associative_benchmarks_for(std::string_view container_name)
+{
+    const auto name = [&](std::string_view operation)
+    { return benchmark_name<T, CAPACITY>(operation, container_name); };
+
+    benchmark::RegisterBenchmark(name("insert").c_str(),
+                                 benchmark_associative_insert<ContainerType, CAPACITY>)
+        ->Apply(fill_ratios);
+    if constexpr (SupportsSortedUniqueInsertion<ContainerType>)
+    {
+        benchmark::RegisterBenchmark(
+            name("insert_sorted_unique").c_str(),
+            benchmark_associative_insert_sorted_unique<ContainerType, CAPACITY>)
+            ->Apply(fill_ratios);
+    }
+    benchmark::RegisterBenchmark(name("erase_and_reinsert").c_str(),
+                                 benchmark_associative_erase_and_reinsert<ContainerType, CAPACITY>)
+        ->Apply(fill_ratios);
+    benchmark::RegisterBenchmark(name("lookup").c_str(),
+                                 benchmark_associative_lookup<ContainerType, CAPACITY>)
+        ->Apply(fill_ratios);
+    if constexpr (requires { &ContainerType::contains_batch; })
+    {
+        benchmark::RegisterBenchmark(name("lookup_batch").c_str(),
+                                     benchmark_associative_lookup_batch<ContainerType, CAPACITY>)
+            ->Apply(fill_ratios);
+    }
+    // Enum keys are exhausted at full capacity, so there are no keys to miss or slide to
+    if constexpr (!std::is_enum_v<typename ContainerType::key_type>)
+    {
+        benchmark::RegisterBenchmark(name("lookup_miss").c_str(),
+                                     benchmark_associative_lookup_miss<ContainerType, CAPACITY>)
+            ->Apply(fill_ratios);
+        benchmark::RegisterBenchmark(
+            name("sliding_window").c_str(),
+            benchmark_associative_sliding_window<ContainerType, CAPACITY>)
+            ->Apply(fill_ratios);
+    }
+    benchmark::RegisterBenchmark(name("iterate").c_str(),
+                                 benchmark_associative_iterate<ContainerType, CAPACITY>)
+        ->Apply(fill_ratios);
+    benchmark::RegisterBenchmark(name("copy").c_str(),
+                                 benchmark_associative_copy<ContainerType, CAPACITY>)
+        ->Apply(fill_ratios);
+}
+
+// Same as above, for `ContainerType<T, CAPACITY>` over the whole benchmark grid. Returns a value so
+// it can be used to initialize a namespace-scope variable.
+template <template <typename, std::size_t> class ContainerType>
+bool register_associative_benchmarks(std::string_view container_name)
+{
+    for_each_shape(
+        [&]<typename T, std::size_t CAPACITY>()
+        {
+            register_associative_benchmarks_for<ContainerType<T, CAPACITY>, T, CAPACITY>(
+                container_name);
+        });
+    return true;
+}
+
+}  // namespace fixed_containers::benchmark_utils
@@ -0,0 +1,49 @@
+#include "benchmark_utils.hpp"
+#include "enums_test_common.hpp"
+
+#include "fixed_containers/enum_map.hpp"
+#include "fixed_containers/enum_set.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <map>
+#include <set>
+
+namespace fixed_containers
+{
+namespace
+{
+using benchmark_utils::Payload;
+using benchmark_utils::register_associative_benchmarks_for;
+using rich_enums::TestEnum64;
+
+// The capacity of an EnumMap/EnumSet is the number of enum constants, so only the element size
+// is swept.
+constexpr std::size_t ENUM_COUNT = 64;
+
+template <typename T>
+bool register_enum_map_benchmarks()
+{
+    register_associative_benchmarks_for<std::map<TestEnum64, T>, T, ENUM_COUNT>("std::map");
+    register_associative_benchmarks_for<EnumMap<TestEnum64, T>, T, ENUM_COUNT>("EnumMap");
+    return true;
+}
+
+bool register_enum_set_benchmarks()
+{
+    using T = TestEnum64;
+    register_associative_benchmarks_for<std::set<TestEnum64>, T, ENUM_COUNT>("std::set");
+    register_associative_benchmarks_for<EnumSet<TestEnum64>, T, ENUM_COUNT>("EnumSet");
+    return true;
+}
+
+[[maybe_unused]] const bool REGISTERED = register_enum_map_benchmarks<Payload<4>>() &&
+                                         register_enum_map_benchmarks<Payload<64>>() &&
+                                         register_enum_map_benchmarks<Payload<1024>>() &&
+                                         register_enum_set_benchmarks();
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
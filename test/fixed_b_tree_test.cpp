@@ -0,0 +1,433 @@
+#include "fixed_containers/fixed_b_tree.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers::fixed_b_tree_detail
+{
+namespace
+{
+using IntIntTree10 = FixedBTree<int, int, 10>;
+
+static_assert(IsStructuralType<IntIntTree10>);
+static_assert(TriviallyCopyable<IntIntTree10>);
+static_assert(StandardLayout<IntIntTree10>);
+
+// Tiny nodes, so that a few dozen entries already need several levels of internal nodes
+template <typename K, typename V, std::size_t MAXIMUM_SIZE>
+using TinyNodeTree = FixedBTree<K, V, MAXIMUM_SIZE, std::less<K>, 4, 3>;
+using IntIntTinyTree = TinyNodeTree<int, int, 200>;
+
+static_assert(IntIntTinyTree::LEAF_ENTRY_COUNT == 4);
+static_assert(IntIntTinyTree::MIN_LEAF_ENTRY_COUNT == 2);
+static_assert(IntIntTinyTree::MIN_CHILD_COUNT == 2);
+static_assert(IntIntTinyTree::LEAF_NODE_COUNT == 100);
+// 100 leaves need at most 50 + 25 + 12 + 6 + 3 + 1 internal nodes above them
+static_assert(IntIntTinyTree::INTERNAL_NODE_COUNT == 97);
+static_assert(IntIntTinyTree::MAXIMUM_HEIGHT == 6);
+
+// A single leaf is enough for small capacities
+static_assert(IntIntTree10::LEAF_ENTRY_COUNT == 10);
+static_assert(IntIntTree10::LEAF_NODE_COUNT == 1);
+static_assert(IntIntTree10::INTERNAL_NODE_COUNT == 0);
+
+template <typename TreeType, typename K, typename... Args>
+constexpr void emplace_new(TreeType& tree, const K& key, Args&&... args)
+{
+    const auto idx = tree.opaque_index_of(key);
+    assert_or_abort(!tree.exists(idx));
+    tree.emplace(idx, key, std::forward<Args>(args)...);
+}
+
+template <typename TreeType, typename K>
+constexpr void erase_existing(TreeType& tree, const K& key)
+{
+    const auto idx = tree.opaque_index_of(key);
+    assert_or_abort(tree.exists(idx));
+    tree.erase(idx);
+}
+
+template <typename TreeType>
+std::vector<std::pair<int, int>> entries_of(const TreeType& tree)
+{
+    std::vector<std::pair<int, int>> out{};
+    for (auto entry = tree.begin_index(); entry != tree.end_index(); entry = tree.next_of(entry))
+    {
+        out.emplace_back(tree.key_at(entry), tree.value_at(entry));
+    }
+    return out;
+}
+
+// Walks the leaves backwards, from the end
+template <typename TreeType>
+std::vector<std::pair<int, int>> reversed_entries_of(const TreeType& tree)
+{
+    std::vector<std::pair<int, int>> out{};
+    for (auto entry = tree.prev_of(tree.end_index()); entry != tree.end_index();
+         entry = tree.prev_of(entry))
+    {
+        out.emplace_back(tree.key_at(entry), tree.value_at(entry));
+    }
+    return out;
+}
+
+template <typename TreeType>
+void expect_same_entries(const std::map<int, int>& reference, const TreeType& tree)
+{
+    ASSERT_EQ(reference.size(), tree.size());
+    const std::vector<std::pair<int, int>> expected{reference.begin(), reference.end()};
+    ASSERT_EQ(expected, entries_of(tree));
+    const std::vector<std::pair<int, int>> expected_reversed{reference.rbegin(), reference.rend()};
+    ASSERT_EQ(expected_reversed, reversed_entries_of(tree));
+    for (const auto& [key, value] : reference)
+    {
+        const auto idx = tree.opaque_index_of(key);
+        ASSERT_TRUE(tree.exists(idx));
+        ASSERT_EQ(value, tree.value(idx));
+    }
+}
+
+}  // namespace
+
+TEST(FixedBTree, EmplaceAndSearch)
+{
+    constexpr IntIntTree10 TREE = []()
+    {
+        IntIntTree10 tree{};
+        emplace_new(tree, 5, 50);
+        emplace_new(tree, 1, 10);
+        emplace_new(tree, 3, 30);
+        return tree;
+    }();
+
+    static_assert(TREE.size() == 3);
+    static_assert(TREE.height() == 0);
+    static_assert(TREE.value(TREE.opaque_index_of(3)) == 30);
+    static_assert(!TREE.exists(TREE.opaque_index_of(2)));
+    static_assert(!TREE.exists(TREE.opaque_index_of(6)));
+
+    // Iteration is in key order
+    static_assert(TREE.key_at(TREE.begin_index()) == 1);
+    static_assert(TREE.key_at(TREE.next_of(TREE.begin_index())) == 3);
+    static_assert(TREE.next_of(TREE.next_of(TREE.next_of(TREE.begin_index()))) ==
+                  TREE.end_index());
+}
+
+TEST(FixedBTree, EmptyTree)
+{
+    constexpr IntIntTree10 TREE{};
+    static_assert(TREE.size() == 0);
+    static_assert(TREE.begin_index() == TREE.end_index());
+    static_assert(!TREE.exists(TREE.opaque_index_of(1)));
+    static_assert(TREE.lower_bound_index(1) == TREE.end_index());
+    static_assert(TREE.upper_bound_index(1) == TREE.end_index());
+}
+
+TEST(FixedBTree, SplitsGrowTheTree)
+{
+    IntIntTinyTree tree{};
+    std::map<int, int> reference{};
+    for (int i = 0; i < 4; i++)
+    {
+        emplace_new(tree, i, i);
+        reference.emplace(i, i);
+    }
+    EXPECT_EQ(0, tree.height());
+
+    emplace_new(tree, 4, 4);
+    reference.emplace(4, 4);
+    EXPECT_EQ(1, tree.height());
+    expect_same_entries(reference, tree);
+
+    for (int i = 5; i < 200; i++)
+    {
+        emplace_new(tree, i, i);
+        reference.emplace(i, i);
+    }
+    EXPECT_LE(tree.height(), IntIntTinyTree::MAXIMUM_HEIGHT);
+    expect_same_entries(reference, tree);
+
+    // Erasing everything shrinks the tree back to a single leaf
+    for (int i = 0; i < 200; i++)
+    {
+        erase_existing(tree, i);
+    }
+    EXPECT_EQ(0, tree.size());
+    EXPECT_EQ(0, tree.height());
+    EXPECT_EQ(tree.end_index(), tree.begin_index());
+}
+
+TEST(FixedBTree, FillsUpToCapacityInAnyOrder)
+{
+    // Ascending insertions leave every leaf half full, which is the worst case for the pools
+    IntIntTinyTree ascending{};
+    IntIntTinyTree descending{};
+    for (int i = 0; i < 200; i++)
+    {
+        emplace_new(ascending, i, i);
+        emplace_new(descending, 199 - i, i);
+    }
+    EXPECT_EQ(200, ascending.size());
+    EXPECT_EQ(200, descending.size());
+    EXPECT_EQ(0, ascending.key_at(ascending.begin_index()));
+    EXPECT_EQ(0, descending.key_at(descending.begin_index()));
+}
+
+TEST(FixedBTree, LowerAndUpperBound)
+{
+    IntIntTinyTree tree{};
+    for (int i = 0; i < 100; i++)
+    {
+        emplace_new(tree, i * 2, i);
+    }
+
+    for (int key = -1; key < 201; key++)
+    {
+        const int expected_lower = key <= 0 ? 0 : ((key + 1) / 2) * 2;
+        const int expected_upper = key < 0 ? 0 : ((key / 2) + 1) * 2;
+        const auto lower = tree.lower_bound_index(key);
+        const auto upper = tree.upper_bound_index(key);
+        if (expected_lower >= 200)
+        {
+            EXPECT_EQ(tree.end_index(), lower);
+        }
+        else
+        {
+            EXPECT_EQ(expected_lower, tree.key_at(lower));
+        }
+        if (expected_upper >= 200)
+        {
+            EXPECT_EQ(tree.end_index(), upper);
+        }
+        else
+        {
+            EXPECT_EQ(expected_upper, tree.key_at(upper));
+        }
+    }
+}
+
+TEST(FixedBTree, EraseReturnsTheSuccessor)
+{
+    IntIntTinyTree tree{};
+    for (int i = 0; i < 100; i++)
+    {
+        emplace_new(tree, i, i);
+    }
+
+    // Erase every other entry through the returned successor, which crosses leaves that borrow
+    // and merge along the way
+    auto entry = tree.begin_index();
+    int expected_key = 0;
+    while (entry != tree.end_index())
+    {
+        ASSERT_EQ(expected_key, tree.key_at(entry));
+        entry = tree.erase({entry, true});
+        if (entry != tree.end_index())
+        {
+            ASSERT_EQ(expected_key + 1, tree.key_at(entry));
+            entry = tree.next_of(entry);
+        }
+        expected_key += 2;
+    }
+
+    std::map<int, int> reference{};
+    for (int i = 1; i < 100; i += 2)
+    {
+        reference.emplace(i, i);
+    }
+    expect_same_entries(reference, tree);
+}
+
+TEST(FixedBTree, EraseRange)
+{
+    IntIntTinyTree tree{};
+    std::map<int, int> reference{};
+    for (int i = 0; i < 100; i++)
+    {
+        emplace_new(tree, i, i);
+        reference.emplace(i, i);
+    }
+
+    const auto next = tree.erase_range(tree.lower_bound_index(10), tree.lower_bound_index(90));
+    reference.erase(reference.lower_bound(10), reference.lower_bound(90));
+    EXPECT_EQ(90, tree.key_at(next));
+    expect_same_entries(reference, tree);
+
+    EXPECT_EQ(tree.end_index(), tree.erase_range(tree.begin_index(), tree.end_index()));
+    EXPECT_EQ(0, tree.size());
+}
+
+TEST(FixedBTree, RandomizedConsistencyTest)
+{
+    TinyNodeTree<int, int, 500> tree{};
+    std::map<int, int> reference{};
+
+    std::mt19937 random_engine{42};
+    std::uniform_int_distribution<int> key_distribution{0, 700};
+
+    for (int round = 0; round < 20000; round++)
+    {
+        const int key = key_distribution(random_engine);
+        const auto idx = tree.opaque_index_of(key);
+        ASSERT_EQ(reference.contains(key), tree.exists(idx));
+        if (tree.exists(idx))
+        {
+            ASSERT_EQ(reference.at(key), tree.value(idx));
+            const auto successor = tree.erase(idx);
+            const auto reference_successor = reference.erase(reference.find(key));
+            if (reference_successor == reference.end())
+            {
+                ASSERT_EQ(tree.end_index(), successor);
+            }
+            else
+            {
+                ASSERT_EQ(reference_successor->first, tree.key_at(successor));
+            }
+        }
+        else if (reference.size() < 500)
+        {
+            tree.emplace(idx, key, round);
+            reference.emplace(key, round);
+        }
+
+        if (round % 1000 == 0)
+        {
+            expect_same_entries(reference, tree);
+        }
+    }
+    expect_same_entries(reference, tree);
+}
+
+TEST(FixedBTree, DefaultNodeSizes)
+{
+    using TreeType = FixedBTree<int, int, 100000>;
+    static_assert(TreeType::LEAF_ENTRY_COUNT == 64);
+    TreeType tree{};
+    std::map<int, int> reference{};
+    for (int i = 0; i < 100000; i++)
+    {
+        const int key = static_cast<int>((static_cast<std::uint32_t>(i) * 2654435761U) >> 1U);
+        emplace_new(tree, key, i);
+        reference.emplace(key, i);
+    }
+    EXPECT_EQ(2, tree.height());
+    expect_same_entries(reference, tree);
+
+    for (int i = 0; i < 100000; i += 3)
+    {
+        const int key = static_cast<int>((static_cast<std::uint32_t>(i) * 2654435761U) >> 1U);
+        erase_existing(tree, key);
+        reference.erase(key);
+    }
+    expect_same_entries(reference, tree);
+}
+
+TEST(FixedBTree, CopyAndMoveBuildTheTreeBottomUp)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<
+        FixedBTree<int, int, 2>>;
+    using TreeType = TinyNodeTree<InstanceCounterType, int, 200>;
+    static_assert(!TriviallyCopyable<TreeType>);
+
+    for (const int entry_count : {0, 1, 4, 5, 13, 64, 65, 101, 200})
+    {
+        TreeType tree{};
+        std::map<int, int> reference{};
+        for (int i = 0; i < entry_count; i++)
+        {
+            const int key = (i * 37) % 211;
+            emplace_new(tree, InstanceCounterType{key}, i);
+            reference.emplace(key, i);
+        }
+
+        // Filling the nodes from left to right never needs more levels than inserting did
+        const std::size_t inserted_height = tree.height();
+        const TreeType copy{tree};
+        TreeType moved{std::move(tree)};
+        for (const TreeType* built : std::array<const TreeType*, 2>{&copy, &moved})
+        {
+            ASSERT_EQ(reference.size(), built->size());
+            ASSERT_LE(built->height(), inserted_height);
+            auto entry = built->begin_index();
+            for (const auto& [key, value] : reference)
+            {
+                ASSERT_EQ(key, built->key_at(entry).get());
+                ASSERT_EQ(value, built->value_at(entry));
+                ASSERT_TRUE(built->exists(built->opaque_index_of(InstanceCounterType{key})));
+                entry = built->next_of(entry);
+            }
+            ASSERT_EQ(built->end_index(), entry);
+        }
+
+        // The built tree has valid nodes that split and merge as usual
+        for (const auto& [key, value] : reference)
+        {
+            erase_existing(moved, InstanceCounterType{key});
+            ASSERT_FALSE(moved.exists(moved.opaque_index_of(InstanceCounterType{key})));
+        }
+        ASSERT_EQ(0, moved.size());
+        for (const auto& [key, value] : reference)
+        {
+            emplace_new(moved, InstanceCounterType{key}, value);
+        }
+        ASSERT_EQ(reference.size(), moved.size());
+
+        moved = copy;
+        ASSERT_EQ(reference.size(), moved.size());
+    }
+    ASSERT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedBTree, NonTriviallyCopyableKeysAndValues)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<
+        FixedBTree<int, int, 1>>;
+    using TreeType = TinyNodeTree<InstanceCounterType, InstanceCounterType, 100>;
+    static_assert(!TriviallyCopyable<TreeType>);
+
+    ASSERT_EQ(0, InstanceCounterType::counter);
+    {
+        TreeType tree{};
+        for (int i = 0; i < 100; i++)
+        {
+            emplace_new(tree, InstanceCounterType{i}, i * 10);
+        }
+        // Internal nodes hold copies of some keys as well
+        ASSERT_LE(200, InstanceCounterType::counter);
+
+        TreeType copy{tree};
+        ASSERT_EQ(100, copy.size());
+        ASSERT_EQ(30, copy.value(copy.opaque_index_of(InstanceCounterType{3})).get());
+
+        const TreeType moved{std::move(copy)};
+        ASSERT_EQ(100, moved.size());
+        ASSERT_EQ(0, copy.size());  // NOLINT(bugprone-use-after-move)
+
+        for (int i = 0; i < 100; i += 2)
+        {
+            erase_existing(tree, InstanceCounterType{i});
+        }
+        ASSERT_EQ(50, tree.size());
+        ASSERT_EQ(1, tree.key_at(tree.begin_index()).get());
+
+        tree = moved;
+        ASSERT_EQ(100, tree.size());
+        tree.clear();
+        ASSERT_EQ(0, tree.size());
+    }
+    ASSERT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers::fixed_b_tree_detail
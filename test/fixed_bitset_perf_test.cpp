@@ -0,0 +1,143 @@
+#include "benchmark_utils.hpp"
+
+#include "fixed_containers/fixed_bitset.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+using benchmark_utils::element_count;
+using benchmark_utils::make_heap_allocated;
+using benchmark_utils::scattered_index;
+
+template <typename BitsetType>
+void fill(BitsetType& instance, std::size_t count)
+{
+    instance.reset();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        instance.set(scattered_index(i, instance.size()));
+    }
+}
+
+template <typename BitsetType, std::size_t BIT_COUNT>
+void benchmark_set(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, BIT_COUNT);
+    auto instance = make_heap_allocated<BitsetType>();
+
+    for (auto _ : state)
+    {
+        fill(*instance, count);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename BitsetType, std::size_t BIT_COUNT>
+void benchmark_reset_and_set(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, BIT_COUNT);
+    auto instance = make_heap_allocated<BitsetType>();
+    fill(*instance, count);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const std::size_t pos = scattered_index(i++, count);
+        instance->reset(pos);
+        instance->set(pos);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename BitsetType, std::size_t BIT_COUNT>
+void benchmark_test(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, BIT_COUNT);
+    auto instance = make_heap_allocated<BitsetType>();
+    fill(*instance, count);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        bool is_set = instance->test(scattered_index(i++, BIT_COUNT));
+        benchmark::DoNotOptimize(is_set);
+    }
+}
+
+template <typename BitsetType, std::size_t BIT_COUNT>
+void benchmark_count(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, BIT_COUNT);
+    auto instance = make_heap_allocated<BitsetType>();
+    fill(*instance, count);
+
+    for (auto _ : state)
+    {
+        std::size_t set_bits = instance->count();
+        benchmark::DoNotOptimize(set_bits);
+    }
+}
+
+template <typename BitsetType, std::size_t BIT_COUNT>
+void benchmark_copy(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, BIT_COUNT);
+    auto source = make_heap_allocated<BitsetType>();
+    auto destination = make_heap_allocated<BitsetType>();
+    fill(*source, count);
+
+    for (auto _ : state)
+    {
+        *destination = *source;
+        benchmark::ClobberMemory();
+    }
+}
+
+template <std::size_t BIT_COUNT>
+bool register_bitset_benchmarks()
+{
+    const auto register_for = [&]<typename BitsetType>(std::string_view container_name)
+    {
+        const auto name = [&](std::string_view operation)
+        {
+            return std::string{operation} + "/" + std::string{container_name} + "<" +
+                   std::to_string(BIT_COUNT) + ">";
+        };
+
+        benchmark::RegisterBenchmark(name("set").c_str(), benchmark_set<BitsetType, BIT_COUNT>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("reset_and_set").c_str(),
+                                     benchmark_reset_and_set<BitsetType, BIT_COUNT>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("test").c_str(), benchmark_test<BitsetType, BIT_COUNT>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("count").c_str(),
+                                     benchmark_count<BitsetType, BIT_COUNT>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("copy").c_str(), benchmark_copy<BitsetType, BIT_COUNT>)
+            ->Apply(benchmark_utils::fill_ratios);
+    };
+
+    register_for.template operator()<std::bitset<BIT_COUNT>>("std::bitset");
+    register_for.template operator()<FixedBitset<BIT_COUNT>>("FixedBitset");
+    return true;
+}
+
+[[maybe_unused]] const bool REGISTERED =
+    register_bitset_benchmarks<16>() && register_bitset_benchmarks<256>() &&
+    register_bitset_benchmarks<4096>() && register_bitset_benchmarks<65536>();
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -1831,6 +1831,43 @@ TEST(FixedDeque, EraseOne)
     run_test(FixedDequeInitialStateLastIndex{});
 }
 
+TEST(FixedDeque, TriviallyRelocatableEntriesAreNotMoved)
+{
+    static_assert(TriviallyRelocatable<FixedDeque<int, 8>>);
+    static_assert(TriviallyRelocatable<FixedDeque<MockTriviallyRelocatable, 8>>);
+    static_assert(NotTriviallyRelocatable<FixedDeque<std::deque<int>, 8>>);
+
+    static constexpr std::size_t MAXIMUM_SIZE = 7;
+    // Every starting index, so that the relocated spans wrap around at every possible position
+    for (std::size_t initial_starting_index = 0; initial_starting_index < MAXIMUM_SIZE;
+         initial_starting_index++)
+    {
+        for (std::size_t position = 0; position <= 4; position++)
+        {
+            FixedDeque<MockTriviallyRelocatable, MAXIMUM_SIZE> var{};
+            set_deque_initial_state(var, initial_starting_index);
+            std::deque<MockTriviallyRelocatable> reference{};
+            for (int i = 0; i < 4; i++)
+            {
+                var.emplace_back(i);
+                reference.push_back(i);
+            }
+
+            const auto offset = static_cast<std::ptrdiff_t>(position);
+            var.insert(std::next(var.cbegin(), offset), {7, 8, 9});
+            reference.insert(std::next(reference.cbegin(), offset), {7, 8, 9});
+            EXPECT_TRUE(std::ranges::equal(reference, var));
+
+            var.erase(std::next(var.cbegin(), offset), std::next(var.cbegin(), offset + 3));
+            reference.erase(std::next(reference.cbegin(), offset),
+                            std::next(reference.cbegin(), offset + 3));
+            EXPECT_TRUE(std::ranges::equal(reference, var));
+            EXPECT_TRUE(
+                std::ranges::all_of(var, [](const auto& entry) { return entry.move_count == 0; }));
+        }
+    }
+}
+
 TEST(FixedDeque, EraseEmpty)
 {
     auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
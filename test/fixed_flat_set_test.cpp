@@ -0,0 +1,925 @@
+#include "fixed_containers/fixed_flat_set.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_set_adapter.hpp"
+#include "fixed_containers/max_size.hpp"
+#include "fixed_containers/sorted_unique.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedFlatSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::random_access_iterator<ES_1::iterator>);
+static_assert(std::random_access_iterator<ES_1::const_iterator>);
+static_assert(!std::contiguous_iterator<ES_1::iterator>);
+static_assert(!std::contiguous_iterator<ES_1::const_iterator>);
+
+static_assert(std::is_same_v<std::iter_value_t<ES_1::iterator>, int>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, const int&>);
+static_assert(std::is_same_v<std::iter_difference_t<ES_1::iterator>, std::ptrdiff_t>);
+static_assert(std::is_same_v<typename std::iterator_traits<ES_1::iterator>::pointer, const int*>);
+static_assert(std::is_same_v<typename std::iterator_traits<ES_1::iterator>::iterator_category,
+                             std::random_access_iterator_tag>);
+
+static_assert(std::is_same_v<std::iter_value_t<ES_1::const_iterator>, int>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, const int&>);
+static_assert(std::is_same_v<std::iter_difference_t<ES_1::const_iterator>, std::ptrdiff_t>);
+static_assert(
+    std::is_same_v<typename std::iterator_traits<ES_1::const_iterator>::pointer, const int*>);
+static_assert(std::is_same_v<typename std::iterator_traits<ES_1::const_iterator>::iterator_category,
+                             std::random_access_iterator_tag>);
+
+}  // namespace
+
+TEST(FixedFlatSet, DefaultConstructor)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{};
+    static_assert(VAL1.empty());
+}
+
+TEST(FixedFlatSet, IteratorConstructor)
+{
+    constexpr std::array INPUT{2, 4};
+    constexpr FixedFlatSet<int, 10> VAL2{INPUT.begin(), INPUT.end()};
+
+    static_assert(VAL2.size() == 2);
+    static_assert(VAL2.contains(2));
+    static_assert(VAL2.contains(4));
+}
+
+TEST(FixedFlatSet, FromUnsorted)
+{
+    constexpr std::array INPUT{4, 2, 4, 3};
+    constexpr auto VAL1 = FixedFlatSet<int, 10>::from_unsorted(INPUT.begin(), INPUT.end());
+    static_assert(VAL1.size() == 3);
+    static_assert(*VAL1.begin() == 2);
+    static_assert(*std::prev(VAL1.end()) == 4);
+
+    constexpr auto VAL2 = FixedFlatSet<int, 10, std::greater<>>::from_unsorted({1, 3, 2});
+    static_assert(VAL2.size() == 3);
+    static_assert(*VAL2.begin() == 3);
+}
+
+TEST(FixedFlatSet, Initializer)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+
+    constexpr FixedFlatSet<int, 10> VAL2{3};
+    static_assert(VAL2.size() == 1);
+}
+
+TEST(FixedFlatSet, Find)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+
+    static_assert(VAL1.find(1) == VAL1.cend());
+    static_assert(VAL1.find(2) != VAL1.cend());
+    static_assert(VAL1.find(3) == VAL1.cend());
+    static_assert(VAL1.find(4) != VAL1.cend());
+}
+
+TEST(FixedFlatSet, Find_TransparentComparator)
+{
+    constexpr FixedFlatSet<MockAComparableToB, 3, std::less<>> var{};
+    constexpr MockBComparableToA b{5};
+    static_assert(var.find(b) == var.end());
+}
+
+TEST(FixedFlatSet, Contains)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+
+    static_assert(!VAL1.contains(1));
+    static_assert(VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, Contains_TransparentComparator)
+{
+    constexpr FixedFlatSet<MockAComparableToB, 5, std::less<>> var{
+        MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+    constexpr MockBComparableToA b{5};
+    static_assert(var.contains(b));
+}
+
+TEST(FixedFlatSet, Count_TransparentComparator)
+{
+    constexpr FixedFlatSet<MockAComparableToB, 5, std::less<>> var{
+        MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+    constexpr MockBComparableToA b{5};
+    static_assert(var.count(b) == 1);
+}
+
+TEST(FixedFlatSet, MaxSize)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.max_size() == 10);
+
+    constexpr FixedFlatSet<int, 4> VAL2{};
+    static_assert(VAL2.max_size() == 4);
+
+    static_assert(FixedFlatSet<int, 4>::static_max_size() == 4);
+    EXPECT_EQ(4, (FixedFlatSet<int, 4>::static_max_size()));
+    static_assert(max_size_v<FixedFlatSet<int, 4>> == 4);
+    EXPECT_EQ(4, (max_size_v<FixedFlatSet<int, 4>>));
+}
+
+TEST(FixedFlatSet, EmptySizeFull)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.empty());
+
+    constexpr FixedFlatSet<int, 10> VAL2{};
+    static_assert(VAL2.size() == 0);  // NOLINT(readability-container-size-empty)
+    static_assert(VAL2.empty());
+
+    constexpr FixedFlatSet<int, 2> VAL3{2, 4};
+    static_assert(VAL3.size() == 2);
+    static_assert(is_full(VAL3));
+
+    constexpr FixedFlatSet<int, 5> VAL4{2, 4};
+    static_assert(VAL4.size() == 2);
+    static_assert(!is_full(VAL4));
+}
+
+TEST(FixedFlatSet, MaxSizeDeduction)
+{
+    {
+        constexpr auto VAL1 = make_fixed_flat_set({30, 31});
+        static_assert(VAL1.size() == 2);
+        static_assert(VAL1.max_size() == 2);
+        static_assert(VAL1.contains(30));
+        static_assert(VAL1.contains(31));
+        static_assert(!VAL1.contains(32));
+    }
+    {
+        constexpr auto VAL1 = make_fixed_flat_set<int>({});
+        static_assert(VAL1.empty());
+        static_assert(VAL1.max_size() == 0);
+    }
+}
+
+TEST(FixedFlatSet, Insert)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{};
+        var.insert(2);
+        var.insert(4);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.contains(1));
+    static_assert(VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, InsertExceedsCapacity)
+{
+    {
+        FixedFlatSet<int, 2> var1{};
+        var1.insert(2);
+        var1.insert(4);
+        var1.insert(4);
+        var1.insert(4);
+        EXPECT_DEATH(var1.insert(6), "");
+    }
+    {
+        FixedFlatSet<int, 2> var1{};
+        var1.insert(2);
+        var1.insert(4);
+        var1.insert(4);
+        var1.insert(4);
+        const int key = 6;
+        EXPECT_DEATH(var1.insert(key), "");
+    }
+}
+
+TEST(FixedFlatSet, InsertMultipleTimes)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{};
+        {
+            auto [iter, was_inserted] = var.insert(2);
+            assert_or_abort(was_inserted);
+            assert_or_abort(2 == *iter);
+        }
+        {
+            auto [iter, was_inserted] = var.insert(4);
+            assert_or_abort(was_inserted);
+            assert_or_abort(4 == *iter);
+        }
+        {
+            auto [iter, was_inserted] = var.insert(2);
+            assert_or_abort(!was_inserted);
+            assert_or_abort(2 == *iter);
+        }
+        {
+            auto [iter, was_inserted] = var.insert(4);
+            assert_or_abort(!was_inserted);
+            assert_or_abort(4 == *iter);
+        }
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.contains(1));
+    static_assert(VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, InsertInitializer)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{};
+        var.insert({2, 4});
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.contains(1));
+    static_assert(VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, InsertIterators)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{};
+        std::array<int, 2> entry_a{2, 4};
+        var.insert(entry_a.begin(), entry_a.end());
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.contains(1));
+    static_assert(VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+
+    static_assert(std::is_same_v<decltype(*VAL1.begin()), const int&>);
+
+    const FixedFlatSet<int, 10> s_non_const{};
+    static_assert(std::is_same_v<decltype(*s_non_const.begin()), const int&>);
+}
+
+TEST(FixedFlatSet, InsertIteratorsUnsorted)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{4, 2};
+        const std::array<int, 7> entries{9, 4, 1, 9, 3, 1, 0};
+        var.insert(entries.begin(), entries.end());
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 6);
+    static_assert(std::ranges::equal(VAL1, std::array<int, 6>{0, 1, 2, 3, 4, 9}));
+}
+
+TEST(FixedFlatSet, InsertSortedUnique)
+{
+    static constexpr std::array<int, 3> ENTRIES{1, 3, 5};
+
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{std_transition::sorted_unique, ENTRIES.begin(), ENTRIES.end()};
+        const std::array<int, 3> more_entries{0, 3, 4};
+        var.insert(std_transition::sorted_unique, more_entries.begin(), more_entries.end());
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array<int, 5>{0, 1, 3, 4, 5}));
+}
+
+TEST(FixedFlatSet, Emplace)
+{
+    {
+        constexpr FixedFlatSet<int, 10> VAL = []()
+        {
+            FixedFlatSet<int, 10> var1{};
+            var1.emplace(2);
+            const int key = 2;
+            var1.emplace(key);
+            return var1;
+        }();
+
+        static_assert(consteval_compare::equal<1, VAL.size()>);
+        static_assert(VAL.contains(2));
+    }
+
+    {
+        FixedFlatSet<int, 10> var1{};
+
+        {
+            auto [iter, was_inserted] = var1.emplace(2);
+
+            ASSERT_EQ(1, var1.size());
+            ASSERT_TRUE(!var1.contains(1));
+            ASSERT_TRUE(var1.contains(2));
+            ASSERT_TRUE(!var1.contains(3));
+            ASSERT_TRUE(!var1.contains(4));
+            ASSERT_TRUE(var1.contains(2));
+            ASSERT_TRUE(was_inserted);
+            ASSERT_EQ(2, *iter);
+        }
+
+        {
+            auto [iter, was_inserted] = var1.emplace(2);
+            ASSERT_EQ(1, var1.size());
+            ASSERT_TRUE(!var1.contains(1));
+            ASSERT_TRUE(var1.contains(2));
+            ASSERT_TRUE(!var1.contains(3));
+            ASSERT_TRUE(!var1.contains(4));
+            ASSERT_TRUE(var1.contains(2));
+            ASSERT_FALSE(was_inserted);
+            ASSERT_EQ(2, *iter);
+        }
+    }
+}
+
+TEST(FixedFlatSet, EmplaceExceedsCapacity)
+{
+    {
+        FixedFlatSet<int, 2> var1{};
+        var1.emplace(2);
+        var1.emplace(4);
+        var1.emplace(4);
+        var1.emplace(4);
+        EXPECT_DEATH(var1.emplace(6), "");
+    }
+    {
+        FixedFlatSet<int, 2> var1{};
+        var1.emplace(2);
+        var1.emplace(4);
+        var1.emplace(4);
+        var1.emplace(4);
+        const int key = 6;
+        EXPECT_DEATH(var1.emplace(key), "");
+    }
+}
+
+TEST(FixedFlatSet, Clear)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{2, 4};
+        var.clear();
+        return var;
+    }();
+
+    static_assert(VAL1.empty());
+}
+
+TEST(FixedFlatSet, Erase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{2, 4};
+        auto removed_count = var.erase(2);
+        assert_or_abort(removed_count == 1);
+        removed_count = var.erase(3);
+        assert_or_abort(removed_count == 0);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 1);
+    static_assert(!VAL1.contains(1));
+    static_assert(!VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, EraseIterator)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{2, 3, 4};
+        {
+            auto iter = var.begin();
+            auto next = var.erase(iter);
+            assert_or_abort(*next == 3);
+        }
+
+        {
+            auto iter = var.cbegin();
+            auto next = var.erase(iter);
+            assert_or_abort(*next == 4);
+        }
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 1);
+    static_assert(!VAL1.contains(1));
+    static_assert(!VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, EraseIteratorAmbiguity)
+{
+    // If the iterator has extraneous auto-conversions, it might cause ambiguity between the various
+    // overloads
+    FixedFlatSet<std::string, 5> var1{};
+    var1.erase("");
+}
+
+TEST(FixedFlatSet, EraseIteratorInvalidIterator)
+{
+    FixedFlatSet<int, 10> var{2, 4};
+    {
+        auto iter = var.begin();
+        std::advance(iter, 2);
+        EXPECT_DEATH(var.erase(iter), "");
+    }
+}
+
+TEST(FixedFlatSet, EraseRange)
+{
+    {
+        constexpr auto VAL1 = []()
+        {
+            FixedFlatSet<int, 10> var{2, 3, 4};
+            auto erase_from = var.begin();
+            std::advance(erase_from, 1);
+            auto erase_to = var.begin();
+            std::advance(erase_to, 2);
+            auto next = var.erase(erase_from, erase_to);
+            assert_or_abort(*next == 4);
+            return var;
+        }();
+
+        static_assert(consteval_compare::equal<2, VAL1.size()>);
+        static_assert(!VAL1.contains(1));
+        static_assert(VAL1.contains(2));
+        static_assert(!VAL1.contains(3));
+        static_assert(VAL1.contains(4));
+    }
+    {
+        constexpr auto VAL1 = []()
+        {
+            FixedFlatSet<int, 10> var{2, 4};
+            auto erase_from = var.begin();
+            auto erase_to = var.begin();
+            auto next = var.erase(erase_from, erase_to);
+            assert_or_abort(*next == 2);
+            return var;
+        }();
+
+        static_assert(consteval_compare::equal<2, VAL1.size()>);
+        static_assert(!VAL1.contains(1));
+        static_assert(VAL1.contains(2));
+        static_assert(!VAL1.contains(3));
+        static_assert(VAL1.contains(4));
+    }
+    {
+        constexpr auto VAL1 = []()
+        {
+            FixedFlatSet<int, 10> var{1, 4};
+            auto erase_from = var.begin();
+            auto erase_to = var.end();
+            auto next = var.erase(erase_from, erase_to);
+            assert_or_abort(next == var.end());
+            return var;
+        }();
+
+        static_assert(consteval_compare::equal<0, VAL1.size()>);
+        static_assert(!VAL1.contains(1));
+        static_assert(!VAL1.contains(2));
+        static_assert(!VAL1.contains(3));
+        static_assert(!VAL1.contains(4));
+    }
+}
+
+TEST(FixedFlatSet, EraseIf)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{2, 3, 4};
+        const std::size_t removed_count =
+            fixed_containers::erase_if(var, [](const auto& key) { return key == 2 or key == 4; });
+        assert_or_abort(2 == removed_count);
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<1, VAL1.size()>);
+    static_assert(!VAL1.contains(1));
+    static_assert(!VAL1.contains(2));
+    static_assert(VAL1.contains(3));
+    static_assert(!VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, IteratorBasic)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{1, 2, 3, 4};
+
+    static_assert(std::distance(VAL1.cbegin(), VAL1.cend()) == 4);
+
+    static_assert(*VAL1.begin() == 1);
+    static_assert(*std::next(VAL1.begin(), 1) == 2);
+    static_assert(*std::next(VAL1.begin(), 2) == 3);
+    static_assert(*std::next(VAL1.begin(), 3) == 4);
+}
+
+TEST(FixedFlatSet, IteratorOffByOneIssues)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{{1, 4}};
+
+    static_assert(std::distance(VAL1.cbegin(), VAL1.cend()) == 2);
+
+    static_assert(*VAL1.begin() == 1);
+    static_assert(*std::next(VAL1.begin(), 1) == 4);
+
+    static_assert(*std::prev(VAL1.end(), 1) == 4);
+    static_assert(*std::prev(VAL1.end(), 2) == 1);
+}
+
+TEST(FixedFlatSet, IteratorEnsureOrder)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 10> var{};
+        var.insert(3);
+        var.insert(4);
+        var.insert(1);
+        return var;
+    }();
+
+    static_assert(std::distance(VAL1.cbegin(), VAL1.cend()) == 3);
+
+    // Iteration is in key order, not insertion order
+    static_assert(*VAL1.begin() == 1);
+    static_assert(*std::next(VAL1.begin(), 1) == 3);
+    static_assert(*std::next(VAL1.begin(), 2) == 4);
+}
+
+TEST(FixedFlatSet, IteratorRandomAccess)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{1, 2, 3, 4};
+
+    static_assert(VAL1.end() - VAL1.begin() == 4);
+    static_assert(*(VAL1.begin() + 2) == 3);
+    static_assert(*(VAL1.end() - 1) == 4);
+    static_assert(VAL1.begin()[1] == 2);
+    static_assert(VAL1.begin() < VAL1.end());
+    static_assert(*std::lower_bound(VAL1.begin(), VAL1.end(), 3) == 3);
+}
+
+TEST(FixedFlatSet, ReverseIteratorBasic)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{1, 2, 3, 4};
+
+    static_assert(consteval_compare::equal<4, std::distance(VAL1.crbegin(), VAL1.crend())>);
+    static_assert(VAL1.rend() - VAL1.rbegin() == 4);
+
+    static_assert(*VAL1.rbegin() == 4);
+    static_assert(*(VAL1.rbegin() + 1) == 3);
+    static_assert(VAL1.crbegin()[2] == 2);
+    static_assert(*std::prev(VAL1.rend(), 1) == 1);
+}
+
+TEST(FixedFlatSet, ReverseIteratorBase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedFlatSet<int, 7> var{1, 2, 3};
+        auto iter = var.rbegin();  // points to 3
+        std::advance(iter, 1);     // points to 2
+        // https://stackoverflow.com/questions/1830158/how-to-call-erase-with-a-reverse-iterator
+        var.erase(std::next(iter).base());
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.contains(1));
+    static_assert(VAL1.contains(3));
+    static_assert(VAL1.rend().base() == VAL1.begin());
+}
+
+TEST(FixedFlatSet, IteratorInvalidation)
+{
+    // Entries move between slots and nodes as the tree changes, so unlike with `FixedSet`, any
+    // insertion or erasure invalidates all iterators. The ones that are returned stay valid.
+    FixedFlatSet<int, 10> var1{10, 20, 30, 40};
+
+    // Deletion
+    {
+        auto next = var1.erase(var1.find(20));
+        EXPECT_EQ(30, *next);
+        next = var1.erase(next);
+        EXPECT_EQ(40, *next);
+        EXPECT_EQ(var1.end(), var1.erase(next));
+    }
+
+    // Insertion
+    {
+        auto [it1, inserted1] = var1.insert(30);
+        EXPECT_TRUE(inserted1);
+        EXPECT_EQ(30, *it1);
+        auto [it2, inserted2] = var1.insert(1);
+        EXPECT_TRUE(inserted2);
+        EXPECT_EQ(1, *it2);
+        EXPECT_EQ(10, *std::next(it2));
+    }
+
+    EXPECT_EQ(var1, (FixedFlatSet<int, 10>{1, 10, 30}));
+}
+
+TEST(FixedFlatSet, LowerBound)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+
+    static_assert(*VAL1.lower_bound(1) == 2);
+    static_assert(*VAL1.lower_bound(2) == 2);
+    static_assert(*VAL1.lower_bound(3) == 4);
+    static_assert(*VAL1.lower_bound(4) == 4);
+    static_assert(VAL1.lower_bound(5) == VAL1.cend());
+}
+
+TEST(FixedFlatSet, LowerBoundTransparentComparator)
+{
+    constexpr FixedFlatSet<MockAComparableToB, 5, std::less<>> VAL{
+        MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+    constexpr MockBComparableToA KEY_B{3};
+    static_assert(*VAL.lower_bound(KEY_B) == MockAComparableToB{3});
+}
+
+TEST(FixedFlatSet, UpperBound)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+
+    static_assert(*VAL1.upper_bound(1) == 2);
+    static_assert(*VAL1.upper_bound(2) == 4);
+    static_assert(*VAL1.upper_bound(3) == 4);
+    static_assert(VAL1.upper_bound(4) == VAL1.cend());
+    static_assert(VAL1.upper_bound(5) == VAL1.cend());
+}
+
+TEST(FixedFlatSet, UpperBoundTransparentComparator)
+{
+    constexpr FixedFlatSet<MockAComparableToB, 5, std::less<>> VAL{
+        MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+    constexpr MockBComparableToA KEY_B{3};
+    static_assert(*VAL.upper_bound(KEY_B) == MockAComparableToB{5});
+}
+
+TEST(FixedFlatSet, EqualRange)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+
+    static_assert(VAL1.equal_range(1).first == VAL1.lower_bound(1));
+    static_assert(VAL1.equal_range(1).second == VAL1.upper_bound(1));
+
+    static_assert(VAL1.equal_range(2).first == VAL1.lower_bound(2));
+    static_assert(VAL1.equal_range(2).second == VAL1.upper_bound(2));
+
+    static_assert(VAL1.equal_range(5).first == VAL1.lower_bound(5));
+    static_assert(VAL1.equal_range(5).second == VAL1.upper_bound(5));
+}
+
+TEST(FixedFlatSet, EqualRangeTransparentComparator)
+{
+    constexpr FixedFlatSet<MockAComparableToB, 5, std::less<>> VAL{
+        MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+    constexpr MockBComparableToA KEY_B{3};
+    static_assert(VAL.equal_range(KEY_B).first == VAL.lower_bound(KEY_B));
+    static_assert(VAL.equal_range(KEY_B).second == VAL.upper_bound(KEY_B));
+}
+
+TEST(FixedFlatSet, KeyCompare)
+{
+    constexpr FixedFlatSet<int, 10, std::greater<int>> VAL1{2, 4, 3};
+    static_assert(VAL1.key_comp()(4, 2));
+    static_assert(VAL1.value_comp()(4, 2));
+    static_assert(*VAL1.begin() == 4);
+    static_assert(*VAL1.lower_bound(3) == 3);
+    static_assert(*VAL1.upper_bound(3) == 2);
+}
+
+TEST(FixedFlatSet, ManyEntries)
+{
+    // Enough entries for several levels of nodes
+    static constexpr int ENTRY_COUNT = 5000;
+    auto var1 = std::make_unique<FixedFlatSet<int, ENTRY_COUNT>>();
+    for (int i = 0; i < ENTRY_COUNT; i++)
+    {
+        var1->insert((i * 7919) % ENTRY_COUNT);
+    }
+    ASSERT_EQ(ENTRY_COUNT, var1->size());
+    ASSERT_TRUE(std::ranges::is_sorted(*var1));
+
+    for (int i = 0; i < ENTRY_COUNT; i += 2)
+    {
+        ASSERT_EQ(1, var1->erase(i));
+    }
+    ASSERT_EQ(ENTRY_COUNT / 2, var1->size());
+    int expected_key = 1;
+    for (const int key : *var1)
+    {
+        ASSERT_EQ(expected_key, key);
+        expected_key += 2;
+    }
+    ASSERT_EQ(101, *var1->lower_bound(100));
+    ASSERT_EQ(103, *var1->upper_bound(101));
+}
+
+TEST(FixedFlatSet, Equality)
+{
+    constexpr FixedFlatSet<int, 10> VAL1{{1, 4}};
+    constexpr FixedFlatSet<int, 10> VAL2{{4, 1}};
+    constexpr FixedFlatSet<int, 10> VAL3{{1, 3}};
+    constexpr FixedFlatSet<int, 10> VAL4{1};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL2 == VAL1);
+
+    static_assert(VAL1 != VAL3);
+    static_assert(VAL3 != VAL1);
+
+    static_assert(VAL1 != VAL4);
+    static_assert(VAL4 != VAL1);
+}
+
+TEST(FixedFlatSet, Ranges)
+{
+#if !defined(__clang__) || __clang_major__ >= 16
+    FixedFlatSet<int, 10> var1{1, 4};
+    auto filtered =
+        var1 | std::ranges::views::filter([](const auto& entry) -> bool { return entry == 4; });
+
+    EXPECT_EQ(1, std::ranges::distance(filtered));
+    EXPECT_EQ(4, *filtered.begin());
+#endif
+}
+
+TEST(FixedFlatSet, OverloadedAddressOfOperator)
+{
+    {
+        FixedFlatSet<MockFailingAddressOfOperator, 15> var{};
+        var.insert({2});
+        var.emplace(3);
+        var.erase(3);
+        var.clear();
+        ASSERT_TRUE(var.empty());
+    }
+
+    {
+        constexpr FixedFlatSet<MockFailingAddressOfOperator, 15> VAL{{2, {}}};
+        static_assert(!VAL.empty());
+    }
+
+    {
+        const FixedFlatSet<MockFailingAddressOfOperator, 15> var{{2, 3, 4}};
+        ASSERT_FALSE(var.empty());
+        auto iter = var.begin();
+        iter->do_nothing();
+        (void)iter++;
+        ++iter;
+        iter->do_nothing();
+    }
+
+    {
+        constexpr FixedFlatSet<MockFailingAddressOfOperator, 15> VAL{{2, 3, 4}};
+        static_assert(!VAL.empty());
+        auto iter = VAL.cbegin();
+        iter->do_nothing();
+        (void)iter++;
+        ++iter;
+        iter->do_nothing();
+    }
+}
+
+TEST(FixedFlatSet, ClassTemplateArgumentDeduction)
+{
+    // Compile-only test
+    const FixedFlatSet var1 = FixedFlatSet<int, 5>{};
+    (void)var1;
+}
+
+TEST(FixedFlatSet, StdRangesRangesIntersection)
+{
+    constexpr FixedFlatSet<int, 10> VAL1 = []()
+    {
+        const FixedFlatSet<int, 10> var1{1, 4};
+        const FixedFlatSet<int, 10> var2{1};
+
+        FixedFlatSet<int, 10> v_intersection;
+        std::ranges::set_intersection(
+            var1, var2, std::inserter(v_intersection, v_intersection.begin()));
+        return v_intersection;
+    }();
+
+    static_assert(consteval_compare::equal<1, VAL1.size()>);
+    static_assert(VAL1.contains(1));
+    static_assert(!VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, StdRangesDifference)
+{
+    constexpr FixedFlatSet<int, 10> VAL1 = []()
+    {
+        const FixedFlatSet<int, 10> var1{1, 4};
+        const FixedFlatSet<int, 10> var2{1};
+
+        FixedFlatSet<int, 10> v_difference;
+        std::ranges::set_difference(var1, var2, std::inserter(v_difference, v_difference.begin()));
+        return v_difference;
+    }();
+    static_assert(consteval_compare::equal<1, VAL1.size()>);
+    static_assert(!VAL1.contains(1));
+    static_assert(!VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedFlatSet, StdRangesUnion)
+{
+    constexpr FixedFlatSet<int, 10> VAL1 = []()
+    {
+        const FixedFlatSet<int, 10> var1{1, 2};
+        const FixedFlatSet<int, 10> var2{3};
+
+        FixedFlatSet<int, 10> v_union;
+        std::ranges::set_union(var1, var2, std::inserter(v_union, v_union.begin()));
+        return v_union;
+    }();
+    static_assert(consteval_compare::equal<3, VAL1.size()>);
+    static_assert(VAL1.contains(1));
+    static_assert(VAL1.contains(2));
+    static_assert(VAL1.contains(3));
+    static_assert(!VAL1.contains(4));
+}
+
+namespace
+{
+template <FixedFlatSet<int, 5> /*INSTANCE*/>
+struct FixedFlatSetInstanceCanBeUsedAsATemplateParameter
+{
+};
+
+template <FixedFlatSet<int, 5> /*INSTANCE*/>
+constexpr void fixed_flat_set_instance_can_be_used_as_a_template_parameter()
+{
+}
+}  // namespace
+
+TEST(FixedFlatSet, UsageAsTemplateParameter)
+{
+    static constexpr FixedFlatSet<int, 5> INSTANCE1{};
+    fixed_flat_set_instance_can_be_used_as_a_template_parameter<INSTANCE1>();
+    const FixedFlatSetInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+}  // namespace fixed_containers
+
+namespace another_namespace_unrelated_to_the_fixed_containers_namespace
+{
+TEST(FixedFlatSet, ArgumentDependentLookup)
+{
+    // Compile-only test
+    fixed_containers::FixedFlatSet<int, 5> var1{};
+    erase_if(var1, [](int) { return true; });
+    (void)is_full(var1);
+}
+}  // namespace another_namespace_unrelated_to_the_fixed_containers_namespace
@@ -0,0 +1,309 @@
+#include "fixed_containers/fixed_flat_table.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers::fixed_flat_table_detail
+{
+namespace
+{
+template <typename K, typename V, std::size_t MAXIMUM_SIZE>
+using EytzingerTable =
+    FixedFlatTable<K, V, MAXIMUM_SIZE, std::less<K>, FlatTableSearch::EYTZINGER>;
+using IntIntTable10 = FixedFlatTable<int, int, 10>;
+using IntIntEytzingerTable10 = EytzingerTable<int, int, 10>;
+
+static_assert(IsStructuralType<IntIntTable10>);
+static_assert(TriviallyCopyable<IntIntTable10>);
+static_assert(StandardLayout<IntIntTable10>);
+static_assert(IsStructuralType<IntIntEytzingerTable10>);
+static_assert(TriviallyCopyable<IntIntEytzingerTable10>);
+static_assert(StandardLayout<IntIntEytzingerTable10>);
+
+template <typename TableType, typename K, typename... Args>
+constexpr void emplace_new(TableType& table, const K& key, Args&&... args)
+{
+    const auto idx = table.opaque_index_of(key);
+    assert_or_abort(!table.exists(idx));
+    table.emplace(idx, key, std::forward<Args>(args)...);
+}
+
+template <typename TableType>
+std::vector<std::pair<int, int>> entries_of(const TableType& table)
+{
+    std::vector<std::pair<int, int>> out{};
+    for (auto entry = table.begin_index(); entry != table.end_index(); entry = table.next_of(entry))
+    {
+        out.emplace_back(table.key_at(entry), table.value_at(entry));
+    }
+    return out;
+}
+
+template <typename TableType>
+void expect_same_entries(const std::map<int, int>& reference, const TableType& table)
+{
+    ASSERT_EQ(reference.size(), table.size());
+    const std::vector<std::pair<int, int>> expected{reference.begin(), reference.end()};
+    ASSERT_EQ(expected, entries_of(table));
+    for (const auto& [key, value] : reference)
+    {
+        const auto idx = table.opaque_index_of(key);
+        ASSERT_TRUE(table.exists(idx));
+        ASSERT_EQ(value, table.value(idx));
+    }
+}
+
+template <typename TableType>
+constexpr TableType make_table_with_three_entries()
+{
+    TableType table{};
+    emplace_new(table, 5, 50);
+    emplace_new(table, 1, 10);
+    emplace_new(table, 3, 30);
+    return table;
+}
+
+// Every table size, so that the Eytzinger layout is checked for complete and incomplete trees
+template <typename TableType>
+void expect_bounds_of_every_size()
+{
+    for (int size = 0; size <= static_cast<int>(TableType::CAPACITY); size++)
+    {
+        TableType table{};
+        for (int i = 0; i < size; i++)
+        {
+            emplace_new(table, i * 2, i);
+        }
+
+        for (int key = -1; key <= (size * 2) + 1; key++)
+        {
+            const int expected_lower = key <= 0 ? 0 : ((key + 1) / 2) * 2;
+            const int expected_upper = key < 0 ? 0 : ((key / 2) + 1) * 2;
+            const auto lower = table.lower_bound_index(key);
+            const auto upper = table.upper_bound_index(key);
+            if (expected_lower >= size * 2)
+            {
+                ASSERT_EQ(table.end_index(), lower);
+            }
+            else
+            {
+                ASSERT_EQ(expected_lower, table.key_at(lower));
+            }
+            if (expected_upper >= size * 2)
+            {
+                ASSERT_EQ(table.end_index(), upper);
+            }
+            else
+            {
+                ASSERT_EQ(expected_upper, table.key_at(upper));
+            }
+            ASSERT_EQ(key >= 0 && key % 2 == 0 && key < size * 2,
+                      table.exists(table.opaque_index_of(key)));
+        }
+    }
+}
+
+template <typename TableType>
+void expect_random_bulk_insertions_match_std_map()
+{
+    TableType table{};
+    std::map<int, int> reference{};
+
+    std::mt19937 random_engine{42};
+    std::uniform_int_distribution<int> key_distribution{0, 3000};
+    std::uniform_int_distribution<std::size_t> chunk_size_distribution{0, 200};
+
+    std::size_t entry_count = 0;
+    while (reference.size() < 1000)
+    {
+        std::vector<std::pair<int, int>> chunk(chunk_size_distribution(random_engine));
+        for (std::pair<int, int>& entry : chunk)
+        {
+            entry = {key_distribution(random_engine), static_cast<int>(entry_count++)};
+        }
+
+        const auto first_not_inserted = table.insert_unsorted(chunk.begin(), chunk.end());
+        for (auto it = chunk.begin(); it != first_not_inserted; ++it)
+        {
+            reference.emplace(*it);
+        }
+        expect_same_entries(reference, table);
+    }
+    EXPECT_EQ(1000, table.size());
+}
+
+}  // namespace
+
+TEST(FixedFlatTable, EmplaceAndSearch)
+{
+    constexpr auto TABLE = make_table_with_three_entries<IntIntTable10>();
+    static_assert(TABLE.size() == 3);
+    static_assert(TABLE.value(TABLE.opaque_index_of(3)) == 30);
+    static_assert(!TABLE.exists(TABLE.opaque_index_of(2)));
+    static_assert(!TABLE.exists(TABLE.opaque_index_of(6)));
+
+    // Iteration is in key order
+    static_assert(TABLE.key_at(TABLE.begin_index()) == 1);
+    static_assert(TABLE.key_at(TABLE.next_of(TABLE.begin_index())) == 3);
+    static_assert(TABLE.next_of(TABLE.next_of(TABLE.next_of(TABLE.begin_index()))) ==
+                  TABLE.end_index());
+
+    constexpr auto EYTZINGER_TABLE = make_table_with_three_entries<IntIntEytzingerTable10>();
+    static_assert(EYTZINGER_TABLE.value(EYTZINGER_TABLE.opaque_index_of(3)) == 30);
+    static_assert(EYTZINGER_TABLE.value(EYTZINGER_TABLE.opaque_index_of(5)) == 50);
+    static_assert(!EYTZINGER_TABLE.exists(EYTZINGER_TABLE.opaque_index_of(2)));
+}
+
+TEST(FixedFlatTable, EmptyTable)
+{
+    constexpr IntIntTable10 TABLE{};
+    static_assert(TABLE.size() == 0);
+    static_assert(TABLE.begin_index() == TABLE.end_index());
+    static_assert(!TABLE.exists(TABLE.opaque_index_of(1)));
+    static_assert(TABLE.lower_bound_index(1) == TABLE.end_index());
+    static_assert(TABLE.upper_bound_index(1) == TABLE.end_index());
+
+    constexpr IntIntEytzingerTable10 EYTZINGER_TABLE{};
+    static_assert(!EYTZINGER_TABLE.exists(EYTZINGER_TABLE.opaque_index_of(1)));
+    static_assert(EYTZINGER_TABLE.lower_bound_index(1) == EYTZINGER_TABLE.end_index());
+}
+
+TEST(FixedFlatTable, LowerAndUpperBound)
+{
+    expect_bounds_of_every_size<FixedFlatTable<int, int, 70>>();
+    expect_bounds_of_every_size<EytzingerTable<int, int, 70>>();
+}
+
+TEST(FixedFlatTable, EraseReturnsTheSuccessor)
+{
+    IntIntEytzingerTable10 table{};
+    for (int i = 0; i < 10; i++)
+    {
+        emplace_new(table, i, i);
+    }
+
+    auto entry = table.erase(table.opaque_index_of(4));
+    EXPECT_EQ(5, table.key_at(entry));
+    entry = table.erase_range(entry, table.lower_bound_index(8));
+    EXPECT_EQ(8, table.key_at(entry));
+    EXPECT_EQ(table.end_index(), table.erase_range(entry, table.end_index()));
+    expect_same_entries({{0, 0}, {1, 1}, {2, 2}, {3, 3}}, table);
+
+    // The Eytzinger index is rebuilt along with the sorted keys
+    EXPECT_TRUE(table.exists(table.opaque_index_of(3)));
+    EXPECT_FALSE(table.exists(table.opaque_index_of(5)));
+}
+
+TEST(FixedFlatTable, InsertUnsortedKeepsTheFirstOfEquivalentEntries)
+{
+    constexpr IntIntTable10 TABLE = []()
+    {
+        IntIntTable10 table{};
+        emplace_new(table, 4, 40);
+        const std::array<std::pair<int, int>, 6> entries{
+            {{7, 70}, {4, 41}, {1, 10}, {7, 71}, {2, 20}, {1, 11}}};
+        table.insert_unsorted(entries.begin(), entries.end());
+        return table;
+    }();
+
+    static_assert(TABLE.size() == 4);
+    static_assert(TABLE.key_at(TABLE.begin_index()) == 1);
+    static_assert(TABLE.value(TABLE.opaque_index_of(1)) == 10);
+    static_assert(TABLE.value(TABLE.opaque_index_of(2)) == 20);
+    static_assert(TABLE.value(TABLE.opaque_index_of(4)) == 40);
+    static_assert(TABLE.value(TABLE.opaque_index_of(7)) == 70);
+}
+
+TEST(FixedFlatTable, InsertSortedUnique)
+{
+    constexpr IntIntEytzingerTable10 TABLE = []()
+    {
+        IntIntEytzingerTable10 table{};
+        emplace_new(table, 2, 20);
+        emplace_new(table, 6, 60);
+        const std::array<std::pair<int, int>, 4> entries{{{1, 10}, {2, 21}, {3, 30}, {9, 90}}};
+        table.insert_sorted_unique(entries.begin(), entries.end());
+        return table;
+    }();
+
+    static_assert(TABLE.size() == 5);
+    static_assert(TABLE.value(TABLE.opaque_index_of(1)) == 10);
+    static_assert(TABLE.value(TABLE.opaque_index_of(2)) == 20);
+    static_assert(TABLE.value(TABLE.opaque_index_of(3)) == 30);
+    static_assert(TABLE.value(TABLE.opaque_index_of(6)) == 60);
+    static_assert(TABLE.value(TABLE.opaque_index_of(9)) == 90);
+}
+
+TEST(FixedFlatTable, InsertUnsortedStopsAtCapacity)
+{
+    FixedFlatTable<int, int, 4> table{};
+    emplace_new(table, 3, 30);
+
+    // Duplicates past the capacity do not need room, so only the 5 stops the insertion
+    const std::array<std::pair<int, int>, 7> entries{
+        {{2, 20}, {1, 10}, {2, 21}, {4, 40}, {3, 31}, {5, 50}, {0, 0}}};
+    const auto first_not_inserted = table.insert_unsorted(entries.begin(), entries.end());
+    EXPECT_EQ(std::next(entries.begin(), 5), first_not_inserted);
+    expect_same_entries({{1, 10}, {2, 20}, {3, 30}, {4, 40}}, table);
+}
+
+TEST(FixedFlatTable, RandomizedBulkInsertion)
+{
+    expect_random_bulk_insertions_match_std_map<FixedFlatTable<int, int, 1000>>();
+    expect_random_bulk_insertions_match_std_map<EytzingerTable<int, int, 1000>>();
+}
+
+TEST(FixedFlatTable, NonTriviallyCopyableKeysAndValues)
+{
+    using InstanceCounterType =
+        instance_counter::InstanceCounterNonTrivialAssignment<FixedFlatTable<int, int, 1>>;
+    using TableType = EytzingerTable<InstanceCounterType, InstanceCounterType, 100>;
+    static_assert(!TriviallyCopyable<TableType>);
+
+    ASSERT_EQ(0, InstanceCounterType::counter);
+    {
+        TableType table{};
+        std::vector<std::pair<InstanceCounterType, InstanceCounterType>> entries{};
+        for (int i = 0; i < 100; i++)
+        {
+            entries.emplace_back((i * 37) % 100, i);
+        }
+        table.insert_unsorted(entries.begin(), entries.end());
+        entries.clear();
+        // The Eytzinger index holds a copy of every key
+        ASSERT_EQ(300, InstanceCounterType::counter);
+
+        TableType copy{table};
+        ASSERT_EQ(100, copy.size());
+        ASSERT_EQ(0, copy.key_at(copy.begin_index()).get());
+
+        const TableType moved{std::move(copy)};
+        ASSERT_EQ(100, moved.size());
+        ASSERT_EQ(0, copy.size());  // NOLINT(bugprone-use-after-move)
+
+        table.erase_range(table.begin_index(), table.lower_bound_index(InstanceCounterType{50}));
+        ASSERT_EQ(50, table.size());
+        ASSERT_TRUE(table.exists(table.opaque_index_of(InstanceCounterType{50})));
+
+        table = moved;
+        ASSERT_EQ(100, table.size());
+        table.clear();
+        ASSERT_EQ(0, table.size());
+    }
+    ASSERT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers::fixed_flat_table_detail
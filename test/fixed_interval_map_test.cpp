@@ -0,0 +1,210 @@
+#include "fixed_containers/fixed_interval_map.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_map.hpp"
+#include "fixed_containers/interval.hpp"
+#include "fixed_containers/pair.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedIntervalMap<Interval<int>, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(TriviallyCopyable<Interval<int>>);
+static_assert(IsStructuralType<Interval<int>>);
+
+// Any type with `low` and `high` endpoints works as a key
+struct PriceBand
+{
+    double low;
+    double high;
+    int tier;
+};
+static_assert(IsInterval<PriceBand>);
+static_assert(!IsInterval<int>);
+static_assert(!IsInterval<Pair<int, int>>);
+
+template <class MapType>
+concept HasIntervalQueries = requires(const MapType& map) {
+    map.for_each_containing(0, [](auto) {});
+    map.for_each_overlapping(typename MapType::key_type{}, [](auto) {});
+};
+
+static_assert(HasIntervalQueries<ES_1>);
+static_assert(!HasIntervalQueries<FixedMap<Interval<int>, int, 10>>);
+
+template <class MapType>
+std::vector<Interval<int>> keys_containing(const MapType& map, const int point)
+{
+    std::vector<Interval<int>> keys{};
+    map.for_each_containing(point, [&keys](auto it) { keys.push_back(it->first); });
+    return keys;
+}
+
+template <class MapType>
+std::vector<Interval<int>> keys_overlapping(const MapType& map, const Interval<int>& interval)
+{
+    std::vector<Interval<int>> keys{};
+    map.for_each_overlapping(interval, [&keys](auto it) { keys.push_back(it->first); });
+    return keys;
+}
+}  // namespace
+
+TEST(FixedIntervalMap, Interval)
+{
+    constexpr Interval<int> VAL1{2, 5};
+    static_assert(!VAL1.contains(1));
+    static_assert(VAL1.contains(2));
+    static_assert(VAL1.contains(4));
+    static_assert(!VAL1.contains(5));
+
+    static_assert(VAL1.overlaps(Interval{4, 8}));
+    static_assert(VAL1.overlaps(Interval{0, 3}));
+    static_assert(VAL1.overlaps(Interval{3, 4}));
+    static_assert(!VAL1.overlaps(Interval{5, 8}));
+    static_assert(!VAL1.overlaps(Interval{0, 2}));
+
+    static_assert(Interval{1, 9} < VAL1);
+    static_assert(Interval{2, 4} < VAL1);
+    static_assert(!IntervalLowThenHighLess{}(VAL1, Interval{2, 4}));
+    static_assert(IntervalLowThenHighLess{}(Interval{2, 4}, VAL1));
+}
+
+TEST(FixedIntervalMap, ForEachContaining)
+{
+    constexpr ES_1 VAL1{{{0, 10}, 1}, {{2, 4}, 2}, {{3, 8}, 3}, {{6, 7}, 4}, {{9, 12}, 5}};
+
+    constexpr auto SUM_CONTAINING = [](const ES_1& map, const int point)
+    {
+        int sum = 0;
+        map.for_each_containing(point, [&sum](auto it) { sum += it->second; });
+        return sum;
+    };
+    static_assert(SUM_CONTAINING(VAL1, -1) == 0);
+    static_assert(SUM_CONTAINING(VAL1, 0) == 1);
+    static_assert(SUM_CONTAINING(VAL1, 3) == 1 + 2 + 3);
+    static_assert(SUM_CONTAINING(VAL1, 4) == 1 + 3);
+    static_assert(SUM_CONTAINING(VAL1, 6) == 1 + 3 + 4);
+    static_assert(SUM_CONTAINING(VAL1, 10) == 5);
+    static_assert(SUM_CONTAINING(VAL1, 12) == 0);
+
+    const std::vector<Interval<int>> expected{{0, 10}, {3, 8}, {6, 7}};
+    ASSERT_EQ(expected, keys_containing(VAL1, 6));
+}
+
+TEST(FixedIntervalMap, ForEachOverlapping)
+{
+    constexpr ES_1 VAL1{{{0, 10}, 1}, {{2, 4}, 2}, {{3, 8}, 3}, {{6, 7}, 4}, {{9, 12}, 5}};
+
+    ASSERT_EQ((std::vector<Interval<int>>{{0, 10}, {3, 8}, {6, 7}}),
+              keys_overlapping(VAL1, Interval{5, 7}));
+    ASSERT_EQ((std::vector<Interval<int>>{{0, 10}, {9, 12}}),
+              keys_overlapping(VAL1, Interval{9, 20}));
+    ASSERT_EQ((std::vector<Interval<int>>{{9, 12}}), keys_overlapping(VAL1, Interval{10, 11}));
+    ASSERT_TRUE(keys_overlapping(VAL1, Interval{12, 20}).empty());
+    ASSERT_TRUE(keys_overlapping(VAL1, Interval{-5, 0}).empty());
+    ASSERT_EQ(VAL1.size(), keys_overlapping(VAL1, Interval{-5, 20}).size());
+}
+
+TEST(FixedIntervalMap, ModifyThroughQuery)
+{
+    ES_1 var1{{{0, 10}, 1}, {{2, 4}, 2}, {{3, 8}, 3}};
+    var1.for_each_containing(3, [](auto it) { it->second *= 10; });
+    ASSERT_EQ(10, var1.at({0, 10}));
+    ASSERT_EQ(20, var1.at({2, 4}));
+    ASSERT_EQ(30, var1.at({3, 8}));
+
+    // Matches can be erased once the query is done
+    std::vector<Interval<int>> to_erase{};
+    var1.for_each_overlapping({7, 9}, [&to_erase](auto it) { to_erase.push_back(it->first); });
+    for (const Interval<int>& key : to_erase)
+    {
+        var1.erase(key);
+    }
+    ASSERT_EQ(1, var1.size());
+    ASSERT_EQ((std::vector<Interval<int>>{{2, 4}}), keys_containing(var1, 3));
+}
+
+TEST(FixedIntervalMap, CustomIntervalType)
+{
+    FixedIntervalMap<PriceBand, int, 10> var1{};
+    var1.try_emplace(PriceBand{.low = 1.0, .high = 2.5, .tier = 0}, 1);
+    var1.try_emplace(PriceBand{.low = 2.0, .high = 4.0, .tier = 0}, 2);
+    var1.try_emplace(PriceBand{.low = 5.0, .high = 6.0, .tier = 0}, 3);
+
+    int sum = 0;
+    var1.for_each_containing(2.25, [&sum](auto it) { sum += it->second; });
+    ASSERT_EQ(1 + 2, sum);
+}
+
+TEST(FixedIntervalMap, QueriesMatchBruteForce)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 300;
+    FixedIntervalMap<Interval<int>, int, MAXIMUM_SIZE> var1{};
+    std::map<Interval<int>, int> reference{};
+
+    std::mt19937 rng(97531);
+    std::uniform_int_distribution<int> low_distribution(0, 499);
+    std::uniform_int_distribution<int> length_distribution(1, 60);
+    for (std::size_t iteration = 0; iteration < 3000; iteration++)
+    {
+        const int low = low_distribution(rng);
+        const Interval<int> key{low, low + length_distribution(rng)};
+        if (reference.contains(key) || is_full(var1))
+        {
+            const Interval<int> to_erase =
+                reference.contains(key) ? key : std::next(reference.begin(), rng() % 100)->first;
+            var1.erase(to_erase);
+            reference.erase(to_erase);
+        }
+        else
+        {
+            var1.try_emplace(key, low);
+            reference.try_emplace(key, low);
+        }
+
+        if (iteration % 100 != 0)
+        {
+            continue;
+        }
+        for (int point = -1; point < 570; point += 3)
+        {
+            std::vector<Interval<int>> expected{};
+            for (const auto& [interval, value] : reference)
+            {
+                if (interval.contains(point))
+                {
+                    expected.push_back(interval);
+                }
+            }
+            ASSERT_EQ(expected, keys_containing(var1, point));
+
+            const Interval<int> query{point, point + 25};
+            expected.clear();
+            for (const auto& [interval, value] : reference)
+            {
+                if (interval.overlaps(query))
+                {
+                    expected.push_back(interval);
+                }
+            }
+            ASSERT_EQ(expected, keys_overlapping(var1, query));
+        }
+    }
+}
+
+}  // namespace fixed_containers
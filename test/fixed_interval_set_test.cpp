@@ -0,0 +1,50 @@
+#include "fixed_containers/fixed_interval_set.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/interval.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedIntervalSet<Interval<int>, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+}  // namespace
+
+TEST(FixedIntervalSet, ForEachContaining)
+{
+    constexpr ES_1 VAL1{{0, 10}, {2, 4}, {3, 8}, {6, 7}, {9, 12}};
+
+    constexpr auto COUNT_CONTAINING = [](const ES_1& set, const int point)
+    {
+        std::size_t count = 0;
+        set.for_each_containing(point, [&count](auto) { count++; });
+        return count;
+    };
+    static_assert(COUNT_CONTAINING(VAL1, -1) == 0);
+    static_assert(COUNT_CONTAINING(VAL1, 3) == 3);
+    static_assert(COUNT_CONTAINING(VAL1, 9) == 2);
+    static_assert(COUNT_CONTAINING(VAL1, 12) == 0);
+}
+
+TEST(FixedIntervalSet, ForEachOverlapping)
+{
+    ES_1 var1{{0, 10}, {2, 4}, {3, 8}, {6, 7}, {9, 12}};
+    var1.erase({3, 8});
+    var1.insert({4, 6});
+
+    std::vector<Interval<int>> found{};
+    var1.for_each_overlapping({4, 7}, [&found](auto it) { found.push_back(*it); });
+    ASSERT_EQ((std::vector<Interval<int>>{{0, 10}, {4, 6}, {6, 7}}), found);
+}
+
+}  // namespace fixed_containers
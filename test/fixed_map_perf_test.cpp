@@ -1,15 +1,31 @@
+#include "benchmark_utils.hpp"
+
 #include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_b_tree_map.hpp"
+#include "fixed_containers/fixed_b_tree_set.hpp"
+#include "fixed_containers/fixed_flat_map.hpp"
+#include "fixed_containers/fixed_flat_set.hpp"
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_map.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
+#include "fixed_containers/fixed_set.hpp"
+#include "fixed_containers/set_operations.hpp"
+#include "fixed_containers/source_location.hpp"
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <map>
+#include <set>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -57,32 +73,313 @@ using DedicatedColorBitContiguousFixedMap =
 
 // The reference boost-based fixed_map (with an array-backed pool-allocator) was at 51000
 // at the time of writing.
-static_assert(consteval_compare::equal<50992, sizeof(FixedMap<int, V, CAP>)>);
-static_assert(consteval_compare::equal<50992, sizeof(CompactPoolFixedMap<int, V, CAP>)>);
-static_assert(consteval_compare::equal<50992, sizeof(CompactContiguousFixedMap<int, V, CAP>)>);
-static_assert(consteval_compare::equal<52032, sizeof(DedicatedColorBitPoolFixedMap<int, V, CAP>)>);
+static_assert(consteval_compare::equal<48920, sizeof(FixedMap<int, V, CAP>)>);
+static_assert(consteval_compare::equal<48920, sizeof(CompactPoolFixedMap<int, V, CAP>)>);
+static_assert(consteval_compare::equal<48400, sizeof(CompactContiguousFixedMap<int, V, CAP>)>);
+// With 2-byte indices, the dedicated color byte fits in the tail padding of the (4-byte aligned)
+// node, so it no longer costs any space over the embedded color.
+static_assert(consteval_compare::equal<48400, sizeof(DedicatedColorBitPoolFixedMap<int, V, CAP>)>);
 static_assert(
-    consteval_compare::equal<52032, sizeof(DedicatedColorBitContiguousFixedMap<int, V, CAP>)>);
+    consteval_compare::equal<48400, sizeof(DedicatedColorBitContiguousFixedMap<int, V, CAP>)>);
+
+// Node indices are as narrow as the capacity allows. They were always 8 bytes wide, which put
+// these at 3232, 32032 and 3200032 bytes.
+static_assert(consteval_compare::equal<1640, sizeof(FixedMap<int, int, 100>)>);
+static_assert(consteval_compare::equal<16040, sizeof(FixedMap<int, int, 1000>)>);
+static_assert(consteval_compare::equal<2400040, sizeof(FixedMap<int, int, 100000>)>);
 
+// Looks up the entries in scattered order, so that neither the path nor the comparisons repeat.
 template <typename MapType>
 void benchmark_map_lookup(benchmark::State& state)
 {
     using KeyType = typename MapType::key_type;
-    MapType instance{};
-    for (std::size_t i = 0; i < 100; i++)
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto instance = benchmark_utils::make_heap_allocated<MapType>();
+    for (std::size_t i = 0; i < count; i++)
     {
-        instance.try_emplace(static_cast<KeyType>(i));
+        instance->try_emplace(static_cast<KeyType>(i));
     }
 
+    std::size_t i = 0;
     for (auto _ : state)
     {
-        auto& entry = instance.at(7);
+        const auto key = static_cast<KeyType>(benchmark_utils::scattered_index(i++, count));
+        auto& entry = instance->at(key);
         benchmark::DoNotOptimize(entry);
     }
 }
 
-BENCHMARK(benchmark_map_lookup<std::map<int, int>>);
-BENCHMARK(benchmark_map_lookup<FixedMap<int, int, 200>>);
+BENCHMARK(benchmark_map_lookup<std::map<int, int>>)->Arg(100)->Arg(10000)->Arg(1000000);
+BENCHMARK(benchmark_map_lookup<FixedMap<int, int, 200>>)->Arg(100);
+BENCHMARK(benchmark_map_lookup<FixedMap<int, int, 1000000>>)->Arg(100)->Arg(10000)->Arg(1000000);
+
+template <typename T, std::size_t /*CAPACITY*/>
+using StdMap = std::map<std::uint32_t, T>;
+template <typename T, std::size_t CAPACITY>
+using FixedMapAlias = FixedMap<std::uint32_t, T, CAPACITY>;
+template <typename T, std::size_t /*CAPACITY*/>
+using StdSet = std::set<T>;
+template <typename T, std::size_t CAPACITY>
+using FixedSetAlias = FixedSet<T, CAPACITY>;
+template <typename T, std::size_t CAPACITY>
+using FixedBTreeMapAlias = FixedBTreeMap<std::uint32_t, T, CAPACITY>;
+template <typename T, std::size_t CAPACITY>
+using FixedBTreeSetAlias = FixedBTreeSet<T, CAPACITY>;
+template <typename T, std::size_t CAPACITY>
+using FixedFlatMapAlias = FixedFlatMap<std::uint32_t, T, CAPACITY>;
+template <typename T, std::size_t CAPACITY>
+using FixedFlatSetAlias = FixedFlatSet<T, CAPACITY>;
+template <typename T, std::size_t CAPACITY>
+using EytzingerFixedFlatMap = FixedFlatMap<std::uint32_t,
+                                           T,
+                                           CAPACITY,
+                                           std::less<std::uint32_t>,
+                                           fixed_flat_table_detail::FlatTableSearch::EYTZINGER>;
+
+// Red-black tree vs B-tree vs sorted arrays as the maps outgrow the caches, at full capacity only.
+// The whole grid would spend most of its time filling the largest containers.
+template <typename ContainerType, std::size_t CAPACITY, bool MEASURE_INSERTION = true>
+void register_ordered_scaling_benchmarks_for(std::string_view container_name)
+{
+    using T = benchmark_utils::Payload<4>;
+    const auto name = [&](std::string_view operation)
+    { return benchmark_utils::benchmark_name<T, CAPACITY>(operation, container_name); };
+
+    benchmark::RegisterBenchmark(
+        name("lookup").c_str(),
+        benchmark_utils::benchmark_associative_lookup<ContainerType, CAPACITY>)
+        ->Arg(100);
+    benchmark::RegisterBenchmark(
+        name("lookup_miss").c_str(),
+        benchmark_utils::benchmark_associative_lookup_miss<ContainerType, CAPACITY>)
+        ->Arg(100);
+    benchmark::RegisterBenchmark(
+        name("erase_and_reinsert").c_str(),
+        benchmark_utils::benchmark_associative_erase_and_reinsert<ContainerType, CAPACITY>)
+        ->Arg(100);
+    benchmark::RegisterBenchmark(
+        name("iterate").c_str(),
+        benchmark_utils::benchmark_associative_iterate<ContainerType, CAPACITY>)
+        ->Arg(100);
+    if constexpr (MEASURE_INSERTION)
+    {
+        benchmark::RegisterBenchmark(
+            name("insert_ascending").c_str(),
+            benchmark_utils::benchmark_associative_insert_ascending<ContainerType, CAPACITY, false>)
+            ->Arg(100);
+        benchmark::RegisterBenchmark(
+            name("insert_ascending_hinted").c_str(),
+            benchmark_utils::benchmark_associative_insert_ascending<ContainerType, CAPACITY, true>)
+            ->Arg(100);
+    }
+}
+
+template <std::size_t CAPACITY>
+void register_ordered_scaling_benchmarks()
+{
+    using T = benchmark_utils::Payload<4>;
+    register_ordered_scaling_benchmarks_for<FixedMapAlias<T, CAPACITY>, CAPACITY>("FixedMap");
+    register_ordered_scaling_benchmarks_for<FixedBTreeMapAlias<T, CAPACITY>, CAPACITY>(
+        "FixedBTreeMap");
+    register_ordered_scaling_benchmarks_for<FixedFlatMapAlias<T, CAPACITY>, CAPACITY>(
+        "FixedFlatMap");
+    // Rebuilds its search index on every insertion, so filling it one entry at a time is O(N^2)
+    register_ordered_scaling_benchmarks_for<EytzingerFixedFlatMap<T, CAPACITY>, CAPACITY, false>(
+        "FixedFlatMap[Eytzinger]");
+    register_ordered_scaling_benchmarks_for<FixedSetAlias<T, CAPACITY>, CAPACITY>("FixedSet");
+    register_ordered_scaling_benchmarks_for<FixedBTreeSetAlias<T, CAPACITY>, CAPACITY>(
+        "FixedBTreeSet");
+    register_ordered_scaling_benchmarks_for<FixedFlatSetAlias<T, CAPACITY>, CAPACITY>(
+        "FixedFlatSet");
+}
+
+bool register_all_ordered_scaling_benchmarks()
+{
+    register_ordered_scaling_benchmarks<1024>();
+    register_ordered_scaling_benchmarks<16384>();
+    register_ordered_scaling_benchmarks<262144>();
+    register_ordered_scaling_benchmarks<1048576>();
+    return true;
+}
+
+// Erasing every entry in scattered order and inserting them back in ascending order leaves the
+// nodes scattered too, as the freelist hands the slots back in reverse order of erasure.
+template <typename MapType, std::size_t CAPACITY, bool COMPACT>
+void benchmark_iterate_after_churn(benchmark::State& state)
+{
+    using K = typename MapType::key_type;
+    auto instance = benchmark_utils::make_heap_allocated<MapType>();
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        instance->try_emplace(static_cast<K>(i));
+    }
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        instance->erase(static_cast<K>(benchmark_utils::scattered_index(i, CAPACITY)));
+    }
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        instance->try_emplace(static_cast<K>(i));
+    }
+    if constexpr (COMPACT)
+    {
+        instance->compact();
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& entry : *instance)
+        {
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * CAPACITY));
+}
+
+BENCHMARK(benchmark_iterate_after_churn<FixedMapAlias<std::uint32_t, 16384>, 16384, false>);
+BENCHMARK(benchmark_iterate_after_churn<FixedMapAlias<std::uint32_t, 16384>, 16384, true>);
+BENCHMARK(benchmark_iterate_after_churn<FixedMapAlias<std::uint32_t, 1048576>, 1048576, false>);
+BENCHMARK(benchmark_iterate_after_churn<FixedMapAlias<std::uint32_t, 1048576>, 1048576, true>);
+
+enum class SetOperationMethod
+{
+    // fixed_containers::set_union() and friends: one ordered walk and a bulk build of the result
+    LINEAR,
+    // std::set_union() and friends into a std::inserter(), which passes the end as a hint
+    STD_ALGORITHM_HINTED_INSERT,
+    // std::set_union() and friends into a buffer, followed by an insert() per entry
+    STD_ALGORITHM_INSERT,
+};
+
+// The first container holds the multiples of 2 and the second one the multiples of 3, so a third
+// of the entries of the first container are also in the second one.
+template <typename ContainerType,
+          std::size_t CAPACITY,
+          set_operations_detail::SetOperation OPERATION,
+          SetOperationMethod METHOD>
+void benchmark_set_operation(benchmark::State& state)
+{
+    using K = typename ContainerType::key_type;
+    const std::size_t count = CAPACITY / 2;
+    auto first = benchmark_utils::make_heap_allocated<ContainerType>();
+    auto second = benchmark_utils::make_heap_allocated<ContainerType>();
+    auto result = benchmark_utils::make_heap_allocated<ContainerType>();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        benchmark_utils::insert_key(*first, static_cast<K>(i * 2));
+        benchmark_utils::insert_key(*second, static_cast<K>(i * 3));
+    }
+    std::vector<typename ContainerType::value_type> buffer{};
+    buffer.reserve(CAPACITY);
+
+    const auto std_algorithm = [&](auto output)
+    {
+        const auto compare = set_operations_detail::EntryCompare<ContainerType>{first->key_comp()};
+        if constexpr (OPERATION == set_operations_detail::SetOperation::UNION)
+        {
+            std::set_union(
+                first->begin(), first->end(), second->begin(), second->end(), output, compare);
+        }
+        else if constexpr (OPERATION == set_operations_detail::SetOperation::INTERSECTION)
+        {
+            std::set_intersection(
+                first->begin(), first->end(), second->begin(), second->end(), output, compare);
+        }
+        else
+        {
+            std::set_difference(
+                first->begin(), first->end(), second->begin(), second->end(), output, compare);
+        }
+    };
+
+    for (auto _ : state)
+    {
+        if constexpr (METHOD == SetOperationMethod::LINEAR)
+        {
+            *result = set_operations_detail::apply<OPERATION>(
+                *first, *second, std_transition::source_location::current());
+        }
+        else if constexpr (METHOD == SetOperationMethod::STD_ALGORITHM_HINTED_INSERT)
+        {
+            result->clear();
+            std_algorithm(std::inserter(*result, result->end()));
+        }
+        else
+        {
+            buffer.clear();
+            std_algorithm(std::back_inserter(buffer));
+            result->clear();
+            for (const auto& entry : buffer)
+            {
+                result->insert(entry);
+            }
+        }
+        benchmark::DoNotOptimize(result->size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count * 2));
+}
+
+template <typename ContainerType,
+          std::size_t CAPACITY,
+          set_operations_detail::SetOperation OPERATION>
+void register_set_operation_benchmarks_for(std::string_view operation,
+                                           std::string_view container_name)
+{
+    using T = typename ContainerType::value_type;
+    const auto name = [&](std::string_view method)
+    {
+        return benchmark_utils::benchmark_name<T, CAPACITY>(
+            std::string{operation} + "[" + std::string{method} + "]", container_name);
+    };
+
+    benchmark::RegisterBenchmark(
+        name("linear").c_str(),
+        benchmark_set_operation<ContainerType, CAPACITY, OPERATION, SetOperationMethod::LINEAR>);
+    benchmark::RegisterBenchmark(
+        name("std_hinted_insert").c_str(),
+        benchmark_set_operation<ContainerType,
+                                CAPACITY,
+                                OPERATION,
+                                SetOperationMethod::STD_ALGORITHM_HINTED_INSERT>);
+    benchmark::RegisterBenchmark(
+        name("std_insert").c_str(),
+        benchmark_set_operation<ContainerType,
+                                CAPACITY,
+                                OPERATION,
+                                SetOperationMethod::STD_ALGORITHM_INSERT>);
+}
+
+template <typename ContainerType, std::size_t CAPACITY>
+void register_set_operation_benchmarks(std::string_view container_name)
+{
+    using set_operations_detail::SetOperation;
+    register_set_operation_benchmarks_for<ContainerType, CAPACITY, SetOperation::UNION>(
+        "set_union", container_name);
+    register_set_operation_benchmarks_for<ContainerType, CAPACITY, SetOperation::INTERSECTION>(
+        "set_intersection", container_name);
+    register_set_operation_benchmarks_for<ContainerType, CAPACITY, SetOperation::DIFFERENCE>(
+        "set_difference", container_name);
+}
+
+bool register_all_set_operation_benchmarks()
+{
+    register_set_operation_benchmarks<FixedSet<std::uint32_t, 1024>, 1024>("FixedSet");
+    register_set_operation_benchmarks<FixedSet<std::uint32_t, 16384>, 16384>("FixedSet");
+    register_set_operation_benchmarks<FixedMap<std::uint32_t, int, 16384>, 16384>("FixedMap");
+    return true;
+}
+
+[[maybe_unused]] const bool REGISTERED =
+    benchmark_utils::register_associative_benchmarks<StdMap>("std::map") &&
+    benchmark_utils::register_associative_benchmarks<FixedMapAlias>("FixedMap") &&
+    benchmark_utils::register_associative_benchmarks<StdSet>("std::set") &&
+    benchmark_utils::register_associative_benchmarks<FixedSetAlias>("FixedSet") &&
+    benchmark_utils::register_associative_benchmarks<FixedBTreeMapAlias>("FixedBTreeMap") &&
+    benchmark_utils::register_associative_benchmarks<FixedBTreeSetAlias>("FixedBTreeSet") &&
+    benchmark_utils::register_associative_benchmarks<FixedFlatMapAlias>("FixedFlatMap") &&
+    benchmark_utils::register_associative_benchmarks<FixedFlatSetAlias>("FixedFlatSet") &&
+    register_all_ordered_scaling_benchmarks() && register_all_set_operation_benchmarks();
 }  // namespace
 }  // namespace fixed_containers
 
@@ -8,7 +8,9 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <memory>
 #include <ranges>
 #include <type_traits>
 
@@ -158,5 +160,33 @@ TEST(FixedMapRawView, OddMap)
     }
 }
 
+// Node indices are stored in 1, 2 or 4 bytes depending on the capacity, and they may be narrower
+// than the alignment of the key.
+TEST(FixedMapRawView, IndexWidths)
+{
+    {
+        FixedMap<std::int64_t, char, 100> map{{1, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'}};
+        check(map);
+    }
+
+    {
+        auto map = std::make_unique<FixedMap<std::int64_t, char, 1000>>();
+        for (std::int64_t i = 0; i < 500; i++)
+        {
+            map->try_emplace(i * 7, static_cast<char>(i));
+        }
+        check(*map);
+    }
+
+    {
+        auto map = std::make_unique<FixedMap<int, std::int64_t, 40000>>();
+        for (int i = 0; i < 40000; i++)
+        {
+            map->try_emplace(i, i * 3);
+        }
+        check(*map);
+    }
+}
+
 }  // namespace
 }  // namespace fixed_containers
@@ -8,8 +8,13 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_red_black_tree_nodes.hpp"
+#include "fixed_containers/map_checking.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
+#include "fixed_containers/set_operations.hpp"
+#include "fixed_containers/sorted_unique.hpp"
 
 #include <gtest/gtest.h>
 
@@ -21,6 +26,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <random>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -334,6 +340,106 @@ TEST(FixedMap, InsertIterators)
     static_assert(VAL1.contains(4));
 }
 
+TEST(FixedMap, InsertSortedUnique)
+{
+    static constexpr std::array<std::pair<int, int>, 3> ENTRIES{{{1, 10}, {3, 30}, {5, 50}}};
+
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{std_transition::sorted_unique, ENTRIES.begin(), ENTRIES.end()};
+        // Not empty anymore, so these are inserted one by one.
+        const std::array<std::pair<int, int>, 3> more_entries{{{0, 0}, {3, 31}, {4, 40}}};
+        var.insert(std_transition::sorted_unique, more_entries.begin(), more_entries.end());
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 5);
+    static_assert(VAL1.at(0) == 0);
+    static_assert(VAL1.at(3) == 30);
+    static_assert(VAL1.at(4) == 40);
+    static_assert(VAL1.at(5) == 50);
+    static_assert(std::ranges::is_sorted(VAL1, {}, [](const auto& pair) { return pair.first; }));
+
+    // Large enough to have several levels, and with the pool handing out recycled indices.
+    FixedMap<int, std::string, 100> var{};
+    for (int i = 0; i < 100; i++)
+    {
+        var[i] = "x";
+    }
+    var.clear();
+    std::map<int, std::string> expected{};
+    for (int i = 0; i < 100; i++)
+    {
+        expected[i * 3] = std::to_string(i);
+    }
+    var.insert(std_transition::sorted_unique, expected.begin(), expected.end());
+    ASSERT_TRUE(std::ranges::equal(var,
+                                   expected,
+                                   [](const auto& lhs, const auto& rhs)
+                                   { return lhs.first == rhs.first && lhs.second == rhs.second; }));
+    ASSERT_EQ(var.begin()->first, 0);
+    ASSERT_EQ(std::prev(var.end())->first, 297);
+    ASSERT_EQ(var.lower_bound(100)->first, 102);
+    ASSERT_EQ(var.erase(150), 1);
+    var.erase(var.begin(), var.lower_bound(200));
+    ASSERT_EQ(var.size(), 33);
+    ASSERT_EQ(var.begin()->first, 201);
+}
+
+TEST(FixedMap, InsertSortedUniqueExceedsCapacity)
+{
+    const std::array<std::pair<int, int>, 3> entries{{{1, 10}, {3, 30}, {5, 50}}};
+    FixedMap<int, int, 2> var1{};
+    EXPECT_DEATH(var1.insert(std_transition::sorted_unique, entries.begin(), entries.end()), "");
+}
+
+TEST(FixedMap, InsertWithHint)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{};
+        // Monotonically increasing keys, hinted at the end
+        for (int i = 0; i < 5; i++)
+        {
+            var.insert(var.cend(), {i * 10, i});
+        }
+        // The right hint, a wrong hint, and an existing key
+        var.insert(var.find(20), {15, 15});
+        var.insert(var.begin(), {35, 35});
+        const auto it = var.insert(var.end(), {20, 999});
+        assert_or_abort(it->second == 2);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 7);
+    static_assert(VAL1.at(0) == 0);
+    static_assert(VAL1.at(15) == 15);
+    static_assert(VAL1.at(20) == 2);
+    static_assert(VAL1.at(35) == 35);
+    static_assert(VAL1.at(40) == 4);
+    static_assert(std::ranges::is_sorted(VAL1, {}, [](const auto& pair) { return pair.first; }));
+}
+
+TEST(FixedMap, InsertWithHintMatchesStdMap)
+{
+    FixedMap<int, int, 100> var{};
+    std::map<int, int> expected{};
+    for (int i = 0; i < 100; i++)
+    {
+        const int key = (i * 37) % 101;
+        // Alternate between good and bad hints
+        const auto hint = (i % 2 == 0) ? var.lower_bound(key) : var.cbegin();
+        const auto it = var.insert(hint, {key, i});
+        ASSERT_EQ(key, it->first);
+        expected.insert({key, i});
+    }
+
+    ASSERT_TRUE(std::ranges::equal(var,
+                                   expected,
+                                   [](const auto& lhs, const auto& rhs)
+                                   { return lhs.first == rhs.first && lhs.second == rhs.second; }));
+}
+
 TEST(FixedMap, InsertInitializer)
 {
     constexpr auto VAL1 = []()
@@ -469,6 +575,38 @@ TEST(FixedMap, TryEmplace)
     }
 }
 
+TEST(FixedMap, TryEmplaceWithHint)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{};
+        var.try_emplace(var.cend(), 2, 20);
+        var.try_emplace(var.cend(), 4, 40);
+        var.try_emplace(var.find(4), 3, 30);
+        var.try_emplace(var.cend(), 1, 10);
+        var.try_emplace(var.cbegin(), 4, 99);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 4);
+    static_assert(VAL1.at(1) == 10);
+    static_assert(VAL1.at(3) == 30);
+    static_assert(VAL1.at(4) == 40);
+
+    constexpr auto VAL2 = []()
+    {
+        FixedMap<int, int, 10> var{};
+        var.insert_or_assign(var.cend(), 2, 20);
+        var.insert_or_assign(var.cbegin(), 1, 10);
+        var.insert_or_assign(var.find(2), 2, 22);
+        return var;
+    }();
+
+    static_assert(VAL2.size() == 2);
+    static_assert(VAL2.at(1) == 10);
+    static_assert(VAL2.at(2) == 22);
+}
+
 TEST(FixedMap, TryEmplaceExceedsCapacity)
 {
     {
@@ -580,6 +718,26 @@ TEST(FixedMap, Emplace)
     }
 }
 
+TEST(FixedMap, EmplaceHint)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{};
+        var.emplace_hint(var.cend(), 2, 20);
+        var.emplace_hint(var.cend(), std::pair<int, int>{4, 40});
+        var.emplace_hint(
+            var.find(4), std::piecewise_construct, std::forward_as_tuple(3), std::make_tuple(30));
+        const auto [it, was_inserted] = var.emplace_hint(var.cbegin(), 4, 99);
+        assert_or_abort(!was_inserted && it->second == 40);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.at(2) == 20);
+    static_assert(VAL1.at(3) == 30);
+    static_assert(VAL1.at(4) == 40);
+}
+
 TEST(FixedMap, EmplaceExceedsCapacity)
 {
     {
@@ -762,6 +920,94 @@ TEST(FixedMap, EraseIf)
     static_assert(VAL1.at(3) == 30);
 }
 
+TEST(FixedMap, SetOperations)
+{
+    constexpr FixedMap<int, int, 10> VAL1{{1, 10}, {3, 30}, {5, 50}};
+    constexpr FixedMap<int, int, 5> VAL2{{3, 31}, {4, 41}};
+
+    // Only the keys are compared, and entries in both maps are taken from the first one
+    constexpr auto UNION = set_union(VAL1, VAL2);
+    static_assert(std::is_same_v<const FixedMap<int, int, 10>, decltype(UNION)>);
+    static_assert(UNION == FixedMap<int, int, 10>{{1, 10}, {3, 30}, {4, 41}, {5, 50}});
+    static_assert(set_intersection(VAL2, VAL1) == FixedMap<int, int, 5>{{3, 31}});
+    static_assert(set_difference(VAL1, VAL2) == FixedMap<int, int, 10>{{1, 10}, {5, 50}});
+
+    static_assert(includes(VAL1, FixedMap<int, int, 5>{{3, 0}, {5, 0}}));
+    static_assert(!includes(VAL1, VAL2));
+}
+
+TEST(FixedMap, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var1{{2, 20}, {3, 30}};
+        FixedMap<int, int, 5> var2{{1, 10}, {3, 99}, {4, 40}};
+        var1.merge(var2);
+        assert_or_abort(var2 == FixedMap<int, int, 5>{{3, 99}});
+        return var1;
+    }();
+
+    static_assert(VAL1 == FixedMap<int, int, 10>{{1, 10}, {2, 20}, {3, 30}, {4, 40}});
+}
+
+TEST(FixedMap, MergeMovesTheMappedValues)
+{
+    FixedMap<int, MockMoveableButNotCopyable, 10> var1{};
+    var1.try_emplace(2);
+    var1.try_emplace(3);
+    FixedMap<int, MockMoveableButNotCopyable, 5> var2{};
+    var2.try_emplace(1);
+    var2.try_emplace(3);
+    var2.try_emplace(4);
+
+    var1.merge(var2);
+    EXPECT_EQ(4, var1.size());
+    EXPECT_EQ(1, var2.size());
+    EXPECT_TRUE(var2.contains(3));
+}
+
+TEST(FixedMap, Compact)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var1{};
+        for (int i = 0; i < 10; i++)
+        {
+            var1[(i * 3) % 10] = i;
+        }
+        var1.erase(0);
+        var1.erase(5);
+        var1.compact();
+        var1[20] = 20;
+        return var1;
+    }();
+
+    static_assert(VAL1 ==
+                  FixedMap<int, int, 10>{
+                      {1, 7}, {2, 4}, {3, 1}, {4, 8}, {6, 2}, {7, 9}, {8, 6}, {9, 3}, {20, 20}});
+
+    FixedMap<int, int, 50> var2{};
+    for (int i = 0; i < 50; i++)
+    {
+        var2[(i * 13) % 50] = i;
+    }
+    erase_if(var2, [](const auto& entry) { return entry.first % 3 == 0; });
+    const FixedMap<int, int, 50> before_compaction{var2};
+    var2.compact();
+    EXPECT_EQ(before_compaction, var2);
+
+    // Iterating visits ascending addresses
+    const int* previous = nullptr;
+    for (const auto& [key, value] : var2)
+    {
+        if (previous != nullptr)
+        {
+            EXPECT_TRUE(std::less<const int*>{}(previous, &value));
+        }
+        previous = &value;
+    }
+}
+
 TEST(FixedMap, IteratorStructuredBinding)
 {
     constexpr auto VAL1 = []()
@@ -1373,6 +1619,95 @@ TEST(FixedMap, EqualRangeTransparentComparator)
     static_assert(VAL.equal_range(KEY_B).second == VAL.upper_bound(KEY_B));
 }
 
+namespace
+{
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare = std::less<K>>
+using OrderStatisticFixedMap =
+    FixedMap<K,
+             V,
+             MAXIMUM_SIZE,
+             Compare,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedPoolStorage,
+             customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::SUBTREE_SIZE>;
+
+template <class MapType>
+concept HasOrderStatistics = requires(const MapType& map) {
+    map.nth(0);
+    map.rank(0);
+    map.count_range(0, 0);
+};
+
+static_assert(HasOrderStatistics<OrderStatisticFixedMap<int, int, 10>>);
+static_assert(!HasOrderStatistics<FixedMap<int, int, 10>>);
+}  // namespace
+
+TEST(FixedMap, OrderStatistics)
+{
+    constexpr OrderStatisticFixedMap<int, int, 10> VAL1{{2, 20}, {4, 40}, {6, 60}, {8, 80}};
+
+    static_assert(VAL1.nth(0)->first == 2);
+    static_assert(VAL1.nth(3)->first == 8);
+    static_assert(VAL1.nth(4) == VAL1.cend());
+    static_assert(VAL1.nth(5) == VAL1.cend());
+
+    static_assert(VAL1.rank(1) == 0);
+    static_assert(VAL1.rank(2) == 0);
+    static_assert(VAL1.rank(5) == 2);
+    static_assert(VAL1.rank(9) == 4);
+
+    static_assert(VAL1.count_range(2, 8) == 3);
+    static_assert(VAL1.count_range(1, 9) == 4);
+    static_assert(VAL1.count_range(3, 4) == 0);
+    static_assert(VAL1.count_range(8, 2) == 0);
+
+    OrderStatisticFixedMap<int, int, 10> var2{VAL1};
+    var2.nth(1)->second = 41;
+    ASSERT_EQ(41, var2.at(4));
+    var2.erase(var2.nth(0));
+    var2.insert({5, 50});
+    ASSERT_EQ(5, var2.nth(1)->first);
+    ASSERT_EQ(2, var2.rank(6));
+    ASSERT_EQ(3, var2.count_range(4, 7));
+}
+
+TEST(FixedMap, OrderStatisticsMatchIteration)
+{
+    OrderStatisticFixedMap<int, int, 200> var1{};
+    std::mt19937 rng(777);
+    std::uniform_int_distribution<int> key_distribution(0, 299);
+    for (std::size_t iteration = 0; iteration < 1000; iteration++)
+    {
+        const int key = key_distribution(rng);
+        if (var1.contains(key) || is_full(var1))
+        {
+            var1.erase(key);
+        }
+        else
+        {
+            var1.try_emplace(key, key);
+        }
+    }
+
+    std::size_t n = 0;
+    for (auto it = var1.begin(); it != var1.end(); ++it, ++n)
+    {
+        ASSERT_EQ(it, var1.nth(n));
+        ASSERT_EQ(n, var1.rank(it->first));
+        ASSERT_EQ(n, var1.count_range(var1.begin()->first, it->first));
+    }
+    ASSERT_EQ(var1.size(), n);
+}
+
+TEST(FixedMap, OrderStatisticsTransparentComparator)
+{
+    constexpr OrderStatisticFixedMap<MockAComparableToB, int, 5, std::less<>> VAL{
+        {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+    static_assert(VAL.rank(MockBComparableToA{3}) == 1);
+    static_assert(VAL.count_range(MockBComparableToA{2}, MockBComparableToA{6}) == 2);
+}
+
 TEST(FixedMap, Equality)
 {
     {
@@ -9,6 +9,7 @@
 #include "fixed_containers/fixed_red_black_tree_ops.hpp"
 #include "fixed_containers/fixed_red_black_tree_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/interval.hpp"
 
 #include <gtest/gtest.h>
 
@@ -16,10 +17,16 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <memory>
+#include <numeric>
 #include <queue>
 #include <random>
+#include <string>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -51,6 +58,32 @@ using Storage_1 = FixedRedBlackTreeStorage<int,
 static_assert(IsFixedRedBlackTreeStorage<Storage_1>);
 static_assert(IsStructuralType<Storage_1>);
 
+using AugmentedStorage_1 = FixedRedBlackTreeStorage<int,
+                                                    double,
+                                                    10,
+                                                    RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                                    FixedIndexBasedPoolStorage,
+                                                    RedBlackTreeNodeAugmentation::SUBTREE_SIZE>;
+static_assert(IsFixedRedBlackTreeStorage<AugmentedStorage_1>);
+static_assert(IsStructuralType<AugmentedStorage_1>);
+static_assert(!Storage_1::HAS_SUBTREE_SIZE);
+static_assert(AugmentedStorage_1::HAS_SUBTREE_SIZE);
+// The augmentation is opt-in, and nodes without it are unchanged
+static_assert(std::is_same_v<Storage_1::NodeType, CompactRedBlackTreeNode<int, double, uint8_t>>);
+
+using IntervalStorage_1 =
+    FixedRedBlackTreeStorage<Interval<int>,
+                             double,
+                             10,
+                             RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                             FixedIndexBasedPoolStorage,
+                             RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT>;
+static_assert(IsFixedRedBlackTreeStorage<IntervalStorage_1>);
+static_assert(IsStructuralType<IntervalStorage_1>);
+static_assert(IntervalStorage_1::HAS_MAX_HIGH_ENDPOINT);
+static_assert(!IntervalStorage_1::HAS_SUBTREE_SIZE);
+static_assert(!AugmentedStorage_1::HAS_MAX_HIGH_ENDPOINT);
+
 using ES_1 = FixedRedBlackTree<int, int, 10>;
 static_assert(TriviallyCopyable<ES_1>);
 static_assert(NotTrivial<ES_1>);
@@ -221,6 +254,112 @@ std::size_t max_height_of_red_black_tree(const std::size_t size)
     return 2 * static_cast<std::size_t>(std::log2(size + 1));
 }
 
+// Returns the number of black nodes on every path from `index` to a leaf, or -1 if the subtree
+// breaks any of the parent links, the key order or the red-black invariants.
+template <class TreeType>
+int checked_black_height(const TreeType& tree, const NodeIndex& index, const NodeIndex& parent)
+{
+    if (index == NULL_INDEX)
+    {
+        return 1;
+    }
+
+    const auto node = tree.node_at(index);
+    if (node.parent_index() != parent)
+    {
+        return -1;
+    }
+    if (node.color() == COLOR_RED &&
+        (parent == NULL_INDEX || tree.node_at(parent).color() == COLOR_RED))
+    {
+        return -1;
+    }
+    const NodeIndex left_index = node.left_index();
+    const NodeIndex right_index = node.right_index();
+    if ((left_index != NULL_INDEX && !(tree.node_at(left_index).key() < node.key())) ||
+        (right_index != NULL_INDEX && !(node.key() < tree.node_at(right_index).key())))
+    {
+        return -1;
+    }
+
+    const int left_height = checked_black_height(tree, left_index, index);
+    const int right_height = checked_black_height(tree, right_index, index);
+    if (left_height < 0 || left_height != right_height)
+    {
+        return -1;
+    }
+    return left_height + (node.color() == COLOR_BLACK ? 1 : 0);
+}
+
+// Returns the number of nodes in the subtree at `index`, or -1 if any node of it stores a wrong
+// subtree size.
+template <class TreeType>
+int checked_subtree_size(const TreeType& tree, const NodeIndex& index)
+{
+    if (index == NULL_INDEX)
+    {
+        return 0;
+    }
+
+    const auto node = tree.node_at(index);
+    const int left_size = checked_subtree_size(tree, node.left_index());
+    const int right_size = checked_subtree_size(tree, node.right_index());
+    if (left_size < 0 || right_size < 0 ||
+        node.subtree_size() != static_cast<std::size_t>(left_size + right_size + 1))
+    {
+        return -1;
+    }
+    return left_size + right_size + 1;
+}
+
+// Returns whether every node in the subtree at `index` stores the greatest `high` endpoint of the
+// subtree.
+template <class TreeType>
+bool has_valid_max_high_endpoints(const TreeType& tree, const NodeIndex& index)
+{
+    if (index == NULL_INDEX)
+    {
+        return true;
+    }
+
+    const auto node = tree.node_at(index);
+    auto expected = node.key().high;
+    for (const NodeIndex child_index : {node.left_index(), node.right_index()})
+    {
+        if (child_index == NULL_INDEX)
+        {
+            continue;
+        }
+        if (!has_valid_max_high_endpoints(tree, child_index))
+        {
+            return false;
+        }
+        expected = std::max(expected, tree.node_at(child_index).max_high_endpoint());
+    }
+    return node.max_high_endpoint() == expected;
+}
+
+template <class TreeType>
+bool is_valid_red_black_tree(const TreeType& tree)
+{
+    if constexpr (TreeType::HAS_SUBTREE_SIZE)
+    {
+        if (checked_subtree_size(tree, tree.root_index()) != static_cast<int>(tree.size()))
+        {
+            return false;
+        }
+    }
+    if constexpr (TreeType::HAS_MAX_HIGH_ENDPOINT)
+    {
+        if (!has_valid_max_high_endpoints(tree, tree.root_index()))
+        {
+            return false;
+        }
+    }
+    return checked_black_height(tree, tree.root_index(), NULL_INDEX) > 0 &&
+           tree.index_of_max_at() == tree.index_of_max_at(tree.root_index());
+}
+
 }  // namespace
 
 TEST(NodeIndexWithColorEmbeddedInTheMostSignificantBit, Basic)
@@ -306,6 +445,92 @@ TEST(NodeIndexWithColorEmbeddedInTheMostSignificantBit, Basic)
     }
 }
 
+TEST(NodeIndexStorageType, SmallestTypeThatFitsTheCapacity)
+{
+    static_assert(std::is_same_v<std::uint8_t, NodeIndexStorageType<1>>);
+    static_assert(std::is_same_v<std::uint8_t, NodeIndexStorageType<127>>);
+    static_assert(std::is_same_v<std::uint16_t, NodeIndexStorageType<128>>);
+    static_assert(std::is_same_v<std::uint16_t, NodeIndexStorageType<32767>>);
+    static_assert(std::is_same_v<std::uint32_t, NodeIndexStorageType<32768>>);
+
+    static_assert(
+        consteval_compare::equal<12, sizeof(CompactRedBlackTreeNode<int, int, std::uint8_t>)>);
+    static_assert(
+        consteval_compare::equal<8,
+                                 sizeof(CompactRedBlackTreeNode<int,
+                                                                EmptyValue,
+                                                                NodeIndexStorageType<100>>)>);
+    static_assert(
+        consteval_compare::equal<12,
+                                 sizeof(DefaultRedBlackTreeNode<int,
+                                                                EmptyValue,
+                                                                NodeIndexStorageType<1000>>)>);
+    static_assert(
+        consteval_compare::equal<32,
+                                 sizeof(CompactRedBlackTreeNode<int,
+                                                                EmptyValue,
+                                                                NodeIndexStorageType<SIZE_MAX>>)>);
+}
+
+TEST(BasicStoredNodeIndex, Basic)
+{
+    constexpr auto DEFAULT_VALUE = []() { return BasicStoredNodeIndex<std::uint8_t>{}; }();
+    static_assert(consteval_compare::equal<NULL_INDEX, DEFAULT_VALUE.get_index()>);
+
+    constexpr auto SET_VALUE = []()
+    {
+        BasicStoredNodeIndex<std::uint8_t> ret{};
+        ret.set_index(254);
+        return ret;
+    }();
+    static_assert(consteval_compare::equal<254, SET_VALUE.get_index()>);
+
+    constexpr auto SET_NULL_VALUE = []()
+    {
+        BasicStoredNodeIndex<std::uint8_t> ret{};
+        ret.set_index(254);
+        ret.set_index(NULL_INDEX);
+        return ret;
+    }();
+    static_assert(consteval_compare::equal<NULL_INDEX, SET_NULL_VALUE.get_index()>);
+
+    BasicStoredNodeIndex<std::uint8_t> ret{};
+    EXPECT_DEATH(ret.set_index(256), "");
+}
+
+TEST(BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit, NarrowStorage)
+{
+    using IndexWithColor = BasicNodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint8_t>;
+    static_assert(sizeof(IndexWithColor) == sizeof(std::uint8_t));
+
+    constexpr auto DEFAULT_VALUE = []() { return IndexWithColor{}; }();
+    static_assert(consteval_compare::equal<NULL_INDEX, DEFAULT_VALUE.get_index()>);
+    static_assert(consteval_compare::equal<COLOR_BLACK, DEFAULT_VALUE.get_color()>);
+
+    constexpr auto SET_MAX_VALUE_WITH_RED = []()
+    {
+        IndexWithColor ret{};
+        ret.set_index(126);
+        ret.set_color(COLOR_RED);
+        return ret;
+    }();
+    static_assert(consteval_compare::equal<126, SET_MAX_VALUE_WITH_RED.get_index()>);
+    static_assert(consteval_compare::equal<COLOR_RED, SET_MAX_VALUE_WITH_RED.get_color()>);
+
+    constexpr auto SET_NULL_VALUE_WITH_RED = []()
+    {
+        IndexWithColor ret{};
+        ret.set_color(COLOR_RED);
+        ret.set_index(NULL_INDEX);
+        return ret;
+    }();
+    static_assert(consteval_compare::equal<NULL_INDEX, SET_NULL_VALUE_WITH_RED.get_index()>);
+    static_assert(consteval_compare::equal<COLOR_RED, SET_NULL_VALUE_WITH_RED.get_color()>);
+
+    IndexWithColor ret{};
+    EXPECT_DEATH(ret.set_index(128), "");
+}
+
 TEST(DefaultRedBlackTreeNode, Construction)
 {
     // Without Value
@@ -962,6 +1187,20 @@ TEST(FixedRedBlackTree, SwapNodes)
         ASSERT_TRUE(are_equal(original_bst.node_at(2), bst.node_at(2)));
     }
 
+    // Swap non-neighbors #2: the siblings again, but starting from the left child
+    {
+        auto bst = get_new_swap_test_base_tree();
+        Ops::swap_nodes_including_key_and_value(bst, 2, 1);
+        //        bst[17] = 170;  // Position 0
+        //        bst[15] = 150;  // Position 1
+        //        bst[19] = 190;  // Position 2
+        ASSERT_TRUE(are_equal(make_node(17, 170, NULL_INDEX, 1, 2, COLOR_BLACK), bst.node_at(0)));
+        ASSERT_TRUE(
+            are_equal(make_node(15, 150, 0, NULL_INDEX, NULL_INDEX, COLOR_RED), bst.node_at(1)));
+        ASSERT_TRUE(
+            are_equal(make_node(19, 190, 0, NULL_INDEX, NULL_INDEX, COLOR_RED), bst.node_at(2)));
+    }
+
     // Swap left-child/parent
     {
         /*
@@ -1760,6 +1999,7 @@ void consistency_test_helper(const std::array<int, MAXIMUM_SIZE>& insertion_orde
             bst.contains_at(successor_index) ? bst.node_at(successor_index).value() : 0;
         ASSERT_EQ(expected_successor_value == 0, successor_index == NULL_INDEX);
         ASSERT_EQ(expected_successor_value, actual_successor_value);
+        ASSERT_EQ(bst.index_of_max_at(bst.root_index()), bst.index_of_max_at());
     }
     ASSERT_TRUE(bst.empty());
 
@@ -1832,6 +2072,456 @@ TEST(FixedRedBlackTree, RandomizedConsistencyTest)
     }
 }
 
+TEST(FixedRedBlackTree, BuildFromSortedUnique)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 70;
+
+    const auto build_and_check = []<class TreeType>(TreeType& bst, const std::size_t count)
+    {
+        int next_key = 0;
+        bst.build_from_sorted_unique(count,
+                                     [&next_key](auto& tree_storage)
+                                     {
+                                         const int key = next_key;
+                                         next_key += 2;
+                                         return tree_storage.emplace_and_return_index(key, -key);
+                                     });
+        ASSERT_EQ(count, bst.size());
+        ASSERT_TRUE(is_valid_red_black_tree(bst));
+        ASSERT_LE(find_height(bst), static_cast<std::size_t>(std::log2(count + 1)));
+
+        int expected_key = 0;
+        for (NodeIndex i = bst.index_of_min_at(); i != NULL_INDEX; i = bst.index_of_successor_at(i))
+        {
+            ASSERT_EQ(expected_key, bst.node_at(i).key());
+            ASSERT_EQ(-expected_key, bst.node_at(i).value());
+            expected_key += 2;
+        }
+        ASSERT_EQ(2 * static_cast<int>(count), expected_key);
+
+        // The result is an ordinary tree: fill the gaps, then empty it out of order.
+        for (std::size_t i = 0; i < count && !bst.full(); i++)
+        {
+            bst[(2 * static_cast<int>(i)) + 1] = 0;
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+        }
+        for (std::size_t i = 0; i < count; i += 3)
+        {
+            bst.delete_node(2 * static_cast<int>(i));
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+        }
+        bst.clear();
+    };
+
+    for (std::size_t count = 0; count <= MAXIMUM_SIZE; count++)
+    {
+        // Reused after clear(), so the pool hands out indices in scrambled order.
+        FixedRedBlackTree<int, int, MAXIMUM_SIZE> bst{};
+        build_and_check(bst, count);
+        build_and_check(bst, count);
+
+        FixedRedBlackTree<int,
+                          int,
+                          MAXIMUM_SIZE,
+                          std::less<int>,
+                          RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                          FixedIndexBasedContiguousStorage>
+            contiguous_bst{};
+        build_and_check(contiguous_bst, count);
+
+        FixedRedBlackTree<int,
+                          int,
+                          MAXIMUM_SIZE,
+                          std::less<int>,
+                          RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                          FixedIndexBasedPoolStorage,
+                          RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+            augmented_bst{};
+        build_and_check(augmented_bst, count);
+        build_and_check(augmented_bst, count);
+    }
+}
+
+TEST(FixedRedBlackTree, BuildFromSortedUniqueInConstexprContext)
+{
+    constexpr auto BST = []()
+    {
+        FixedRedBlackTree<int, int, 10> bst{};
+        int next_key = 0;
+        bst.build_from_sorted_unique(
+            7,
+            [&next_key](auto& tree_storage)
+            { return tree_storage.emplace_and_return_index(next_key++, 0); });
+        return bst;
+    }();
+
+    static_assert(BST.size() == 7);
+    static_assert(BST.contains_node(0));
+    static_assert(BST.contains_node(6));
+    static_assert(!BST.contains_node(7));
+}
+
+TEST(FixedRedBlackTree, CopyAndMoveOfNonTriviallyCopyableEntries)
+{
+    using TreeType = FixedRedBlackTree<std::string, MockNonTrivialInt, 40>;
+    TreeType bst{};
+    for (int i = 0; i < 40; i++)
+    {
+        bst[std::to_string((i * 7) % 40)] = MockNonTrivialInt{i};
+    }
+
+    TreeType copy{bst};
+    ASSERT_EQ(40, copy.size());
+    ASSERT_TRUE(is_valid_red_black_tree(copy));
+
+    const TreeType moved{std::move(copy)};
+    ASSERT_EQ(40, moved.size());
+    ASSERT_TRUE(is_valid_red_black_tree(moved));
+
+    TreeType assigned{};
+    assigned = moved;
+    ASSERT_TRUE(is_valid_red_black_tree(assigned));
+
+    for (int i = 0; i < 40; i++)
+    {
+        const NodeIndex index = assigned.index_of_node_or_null(std::to_string((i * 7) % 40));
+        ASSERT_TRUE(assigned.contains_at(index));
+        ASSERT_EQ(i, assigned.node_at(index).value().value);
+    }
+}
+
+TEST(FixedRedBlackTree, IndexOfNodeWithParentNear)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 64;
+    FixedRedBlackTree<int, int, MAXIMUM_SIZE> bst{};
+
+    // Ascending keys hinted at the end are appended without a search
+    for (int i = 0; i < 20; i++)
+    {
+        NodeIndexAndParentIndex np_idxs = bst.index_of_node_with_parent_near(NULL_INDEX, i * 2);
+        ASSERT_EQ(bst.index_of_max_at(), np_idxs.parent);
+        bst.insert_new_at(np_idxs, i * 2, i);
+        ASSERT_TRUE(is_valid_red_black_tree(bst));
+    }
+
+    // Hints that are right, off by some entries and wrong altogether must all find the same spot
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> key_distribution(-20, 100);
+    for (std::size_t iteration = 0; iteration < 200 && !bst.full(); iteration++)
+    {
+        const int key = key_distribution(rng);
+        const NodeIndexAndParentIndex expected = bst.index_of_node_with_parent(key);
+
+        NodeIndex hint = bst.index_of_node_ceiling(key);
+        for (std::size_t steps = rng() % 4; steps > 0 && hint != NULL_INDEX; steps--)
+        {
+            hint = (rng() % 2 == 0) ? bst.index_of_successor_at(hint)
+                                    : bst.index_of_predecessor_at(hint);
+        }
+
+        NodeIndexAndParentIndex np_idxs = bst.index_of_node_with_parent_near(hint, key);
+        ASSERT_EQ(bst.contains_at(expected.i), bst.contains_at(np_idxs.i));
+        if (bst.contains_at(np_idxs.i))
+        {
+            ASSERT_EQ(expected.i, np_idxs.i);
+            ASSERT_EQ(expected.parent, np_idxs.parent);
+            continue;
+        }
+
+        bst.insert_new_at(np_idxs, key, key);
+        ASSERT_TRUE(is_valid_red_black_tree(bst));
+        ASSERT_EQ(np_idxs.i, bst.index_of_node_or_null(key));
+    }
+
+    for (NodeIndex i = bst.index_of_min_at(); bst.index_of_successor_at(i) != NULL_INDEX;
+         i = bst.index_of_successor_at(i))
+    {
+        ASSERT_LT(bst.node_at(i).key(), bst.node_at(bst.index_of_successor_at(i)).key());
+    }
+}
+
+TEST(FixedRedBlackTree, OrderStatistics)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 100;
+    static constexpr int KEY_COUNT = 150;
+
+    const auto run = []<class TreeType>(TreeType& bst)
+    {
+        std::array<bool, KEY_COUNT> present{};
+        std::mt19937 rng(4242);
+        std::uniform_int_distribution<int> key_distribution(0, KEY_COUNT - 1);
+
+        for (std::size_t iteration = 0; iteration < 2000; iteration++)
+        {
+            const int key = key_distribution(rng);
+            // Grow towards the capacity, then oscillate around it
+            if (present[static_cast<std::size_t>(key)] || bst.full())
+            {
+                bst.delete_node(key);
+                present[static_cast<std::size_t>(key)] = false;
+            }
+            else
+            {
+                bst[key] = -key;
+                present[static_cast<std::size_t>(key)] = true;
+            }
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+
+            std::size_t expected_rank = 0;
+            for (int k = 0; k < KEY_COUNT; k++)
+            {
+                ASSERT_EQ(expected_rank, bst.rank_of(k));
+                if (!present[static_cast<std::size_t>(k)])
+                {
+                    continue;
+                }
+                const NodeIndex nth = bst.index_of_nth(expected_rank);
+                ASSERT_EQ(k, bst.node_at(nth).key());
+                ASSERT_EQ(expected_rank, bst.rank_at(nth));
+                expected_rank++;
+            }
+            ASSERT_EQ(bst.size(), expected_rank);
+            ASSERT_EQ(NULL_INDEX, bst.index_of_nth(bst.size()));
+            ASSERT_EQ(bst.size(), bst.rank_at(NULL_INDEX));
+        }
+    };
+
+    FixedRedBlackTree<int,
+                      int,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                      FixedIndexBasedPoolStorage,
+                      RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+        pool_bst{};
+    run(pool_bst);
+
+    // Deleting from contiguous storage relocates the last node
+    FixedRedBlackTree<int,
+                      int,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                      FixedIndexBasedContiguousStorage,
+                      RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+        contiguous_bst{};
+    run(contiguous_bst);
+}
+
+TEST(FixedRedBlackTree, OrderStatisticsInConstexprContext)
+{
+    constexpr auto BST = []()
+    {
+        FixedRedBlackTree<int,
+                          int,
+                          10,
+                          std::less<int>,
+                          RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                          FixedIndexBasedPoolStorage,
+                          RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+            bst{};
+        for (const int key : {5, 1, 9, 3, 7})
+        {
+            bst[key] = key;
+        }
+        bst.delete_node(3);
+        return bst;
+    }();
+
+    static_assert(BST.node_at(BST.index_of_nth(0)).key() == 1);
+    static_assert(BST.node_at(BST.index_of_nth(2)).key() == 7);
+    static_assert(BST.index_of_nth(4) == NULL_INDEX);
+    static_assert(BST.rank_of(7) == 2);
+    static_assert(BST.rank_of(8) == 3);
+}
+
+TEST(FixedRedBlackTree, Compact)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 60;
+    static constexpr int KEY_COUNT = 90;
+
+    const auto run = []<class TreeType>(TreeType& bst)
+    {
+        std::array<bool, KEY_COUNT> present{};
+        std::mt19937 rng(1717);
+        std::uniform_int_distribution<int> key_distribution(0, KEY_COUNT - 1);
+
+        for (std::size_t iteration = 0; iteration < 1000; iteration++)
+        {
+            const int key = key_distribution(rng);
+            if (present[static_cast<std::size_t>(key)] || bst.full())
+            {
+                bst.delete_node(key);
+                present[static_cast<std::size_t>(key)] = false;
+            }
+            else
+            {
+                bst[key] = MockNonTrivialInt{-key};
+                present[static_cast<std::size_t>(key)] = true;
+            }
+            if (iteration % 25 != 0)
+            {
+                continue;
+            }
+
+            bst.compact();
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+
+            // The entries are laid out in order, and nothing was lost on the way
+            NodeIndex index = bst.index_of_min_at();
+            NodeIndex expected_index = 0;
+            for (int k = 0; k < KEY_COUNT; k++)
+            {
+                if (!present[static_cast<std::size_t>(k)])
+                {
+                    ASSERT_FALSE(bst.contains_node(k));
+                    continue;
+                }
+                ASSERT_EQ(expected_index, index);
+                ASSERT_EQ(k, bst.node_at(index).key());
+                ASSERT_EQ(-k, bst.node_at(index).value().value);
+                index = bst.index_of_successor_at(index);
+                expected_index++;
+            }
+            ASSERT_EQ(NULL_INDEX, index);
+            ASSERT_EQ(bst.size(), expected_index);
+        }
+    };
+
+    FixedRedBlackTree<int, MockNonTrivialInt, MAXIMUM_SIZE> pool_bst{};
+    run(pool_bst);
+
+    FixedRedBlackTree<int,
+                      MockNonTrivialInt,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                      FixedIndexBasedContiguousStorage>
+        contiguous_bst{};
+    run(contiguous_bst);
+
+    FixedRedBlackTree<int,
+                      MockNonTrivialInt,
+                      MAXIMUM_SIZE,
+                      std::less<int>,
+                      RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                      FixedIndexBasedPoolStorage,
+                      RedBlackTreeNodeAugmentation::SUBTREE_SIZE>
+        augmented_bst{};
+    run(augmented_bst);
+}
+
+TEST(FixedRedBlackTree, CompactFullTree)
+{
+    FixedRedBlackTree<int, int, 31> bst{};
+    for (int i = 0; i < 31; i++)
+    {
+        bst[(i * 11) % 31] = i;
+    }
+    ASSERT_TRUE(bst.full());
+
+    bst.compact();
+    ASSERT_TRUE(is_valid_red_black_tree(bst));
+    for (int k = 0; k < 31; k++)
+    {
+        ASSERT_EQ(static_cast<NodeIndex>(k), bst.index_of_node_or_null(k));
+    }
+
+    // The freelist hands out the slots that follow the entries
+    bst.delete_node(30);
+    bst.compact();
+    bst[100] = 100;
+    ASSERT_EQ(30, bst.index_of_node_or_null(100));
+    ASSERT_TRUE(is_valid_red_black_tree(bst));
+}
+
+TEST(FixedRedBlackTree, CompactInConstexprContext)
+{
+    constexpr auto BST = []()
+    {
+        FixedRedBlackTree<int, int, 10> bst{};
+        for (const int key : {5, 1, 9, 3, 7, 2})
+        {
+            bst[key] = key;
+        }
+        bst.delete_node(3);
+        bst.delete_node(1);
+        bst.compact();
+        return bst;
+    }();
+
+    static_assert(BST.index_of_min_at() == 0);
+    static_assert(BST.node_at(0).key() == 2);
+    static_assert(BST.node_at(1).key() == 5);
+    static_assert(BST.node_at(3).key() == 9);
+    static_assert(BST.index_of_max_at() == 3);
+}
+
+TEST(FixedRedBlackTree, BranchlessLookupMatchesThreeWayLookup)
+{
+    // Not std::less, so lookups take the three-way comparison path
+    struct PlainLess
+    {
+        constexpr bool operator()(const int left, const int right) const { return left < right; }
+    };
+
+    using BranchlessTree = FixedRedBlackTree<int, int, 8192>;
+    static constexpr std::size_t MINIMUM_SIZE = BranchlessTree::BRANCHLESS_LOOKUP_MINIMUM_SIZE;
+    static_assert(BranchlessTree::HAS_BRANCHLESS_LOOKUP<int>);
+    static_assert(!FixedRedBlackTree<int, int, MINIMUM_SIZE - 1>::HAS_BRANCHLESS_LOOKUP<int>);
+
+    auto branchless_bst = std::make_unique<BranchlessTree>();
+    auto three_way_bst = std::make_unique<FixedRedBlackTree<int, int, 8192, PlainLess>>();
+
+    // Grow past the threshold, with every other key missing
+    static constexpr int KEY_COUNT = static_cast<int>(MINIMUM_SIZE + 100);
+    std::mt19937 rng(99);
+    std::vector<int> keys(static_cast<std::size_t>(KEY_COUNT));
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    for (const int key : keys)
+    {
+        (*branchless_bst)[key * 2] = key;
+        (*three_way_bst)[key * 2] = key;
+    }
+
+    const auto expect_same_lookup = [&](const int key)
+    {
+        // Both trees went through the same operations, so they have the same layout
+        const NodeIndexAndParentIndex expected = three_way_bst->index_of_node_with_parent(key);
+        const NodeIndexAndParentIndex actual = branchless_bst->index_of_node_with_parent(key);
+        ASSERT_EQ(expected.i, actual.i);
+        ASSERT_EQ(expected.parent, actual.parent);
+        ASSERT_EQ(expected.is_left_child, actual.is_left_child);
+    };
+
+    std::uniform_int_distribution<int> key_distribution(-1, (KEY_COUNT * 2) + 1);
+    for (std::size_t iteration = 0; iteration < 500; iteration++)
+    {
+        const int key = key_distribution(rng);
+        if (branchless_bst->contains_node(key) || branchless_bst->full())
+        {
+            branchless_bst->delete_node(key);
+            three_way_bst->delete_node(key);
+        }
+        else
+        {
+            (*branchless_bst)[key] = key;
+            (*three_way_bst)[key] = key;
+        }
+        ASSERT_GE(branchless_bst->size(), MINIMUM_SIZE);
+
+        for (int k = key - 3; k <= key + 3; k++)
+        {
+            expect_same_lookup(k);
+        }
+    }
+    for (int k = -1; k <= (KEY_COUNT * 2) + 1; k++)
+    {
+        expect_same_lookup(k);
+    }
+}
+
 TEST(FixedRedBlackTree, TreeMaxHeight)
 {
     static constexpr std::size_t MAXIMUM_SIZE = 512;
@@ -1872,4 +2562,159 @@ TEST(FixedRedBlackTree, TreeMaxHeight)
         }
     }
 }
+namespace
+{
+template <class TreeType>
+std::vector<Interval<int>> intervals_found_by(const TreeType& bst, const auto& query)
+{
+    std::vector<Interval<int>> found{};
+    const auto collect = [&bst, &found](const NodeIndex& index)
+    { found.push_back(bst.node_at(index).key()); };
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(query)>, int>)
+    {
+        bst.for_each_index_containing(query, collect);
+    }
+    else
+    {
+        bst.for_each_index_overlapping(query, collect);
+    }
+    return found;
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, IntervalQueries)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 100;
+    static constexpr int MAX_LOW = 80;
+    static constexpr int MAX_LENGTH = 20;
+
+    const auto run = []<class TreeType>(TreeType& bst)
+    {
+        std::vector<Interval<int>> present{};
+        std::mt19937 rng(2468);
+        std::uniform_int_distribution<int> low_distribution(0, MAX_LOW - 1);
+        std::uniform_int_distribution<int> length_distribution(1, MAX_LENGTH);
+
+        const auto check_queries = [&bst, &present]()
+        {
+            std::ranges::sort(present, IntervalLowThenHighLess{});
+            for (int point = -1; point <= MAX_LOW + MAX_LENGTH; point++)
+            {
+                std::vector<Interval<int>> expected{};
+                std::ranges::copy_if(present,
+                                     std::back_inserter(expected),
+                                     [point](const Interval<int>& i) { return i.contains(point); });
+                ASSERT_EQ(expected, intervals_found_by(bst, point));
+            }
+            for (int low = -1; low <= MAX_LOW + MAX_LENGTH; low += 7)
+            {
+                for (int high = low; high <= low + 30; high += 5)
+                {
+                    const Interval<int> query{low, high};
+                    std::vector<Interval<int>> expected{};
+                    std::ranges::copy_if(present,
+                                         std::back_inserter(expected),
+                                         [&query](const Interval<int>& i)
+                                         { return i.overlaps(query); });
+                    ASSERT_EQ(expected, intervals_found_by(bst, query));
+                }
+            }
+        };
+
+        for (std::size_t iteration = 0; iteration < 1500; iteration++)
+        {
+            const int low = low_distribution(rng);
+            const Interval<int> key{low, low + length_distribution(rng)};
+            const auto it = std::ranges::find(present, key);
+            // Grow towards the capacity, then oscillate around it
+            if (it != present.end() || bst.full())
+            {
+                const Interval<int> to_delete = it != present.end() ? *it : present[rng() % 50];
+                bst.delete_node(to_delete);
+                present.erase(std::ranges::find(present, to_delete));
+            }
+            else
+            {
+                bst[key] = low;
+                present.push_back(key);
+            }
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+            if (iteration % 50 == 0)
+            {
+                check_queries();
+            }
+        }
+        check_queries();
+
+        bst.compact();
+        ASSERT_TRUE(is_valid_red_black_tree(bst));
+        check_queries();
+
+        // Rebuild from the intervals in order
+        bst.clear();
+        std::size_t next = 0;
+        bst.build_from_sorted_unique(present.size(),
+                                     [&present, &next](auto& tree_storage)
+                                     {
+                                         const Interval<int> key = present[next++];
+                                         return tree_storage.emplace_and_return_index(key, key.low);
+                                     });
+        ASSERT_TRUE(is_valid_red_black_tree(bst));
+        check_queries();
+    };
+
+    FixedRedBlackTree<Interval<int>,
+                      int,
+                      MAXIMUM_SIZE,
+                      IntervalLowThenHighLess,
+                      RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                      FixedIndexBasedPoolStorage,
+                      RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT>
+        pool_bst{};
+    run(pool_bst);
+
+    // Deleting from contiguous storage relocates the last node
+    FixedRedBlackTree<Interval<int>,
+                      int,
+                      MAXIMUM_SIZE,
+                      IntervalLowThenHighLess,
+                      RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                      FixedIndexBasedContiguousStorage,
+                      RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT>
+        contiguous_bst{};
+    run(contiguous_bst);
+}
+
+TEST(FixedRedBlackTree, IntervalQueriesInConstexprContext)
+{
+    constexpr auto BST = []()
+    {
+        FixedRedBlackTree<Interval<int>,
+                          int,
+                          10,
+                          IntervalLowThenHighLess,
+                          RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                          FixedIndexBasedPoolStorage,
+                          RedBlackTreeNodeAugmentation::MAX_HIGH_ENDPOINT>
+            bst{};
+        for (const Interval<int> key : {Interval{0, 10}, Interval{2, 3}, Interval{5, 20}})
+        {
+            bst[key] = key.low;
+        }
+        bst.delete_node(Interval{2, 3});
+        return bst;
+    }();
+
+    constexpr auto COUNT_CONTAINING = [](const auto& bst, const int point)
+    {
+        std::size_t count = 0;
+        bst.for_each_index_containing(point, [&count](const NodeIndex&) { count++; });
+        return count;
+    };
+    static_assert(COUNT_CONTAINING(BST, 2) == 1);
+    static_assert(COUNT_CONTAINING(BST, 7) == 2);
+    static_assert(COUNT_CONTAINING(BST, 10) == 1);
+    static_assert(COUNT_CONTAINING(BST, 20) == 0);
+}
+
 }  // namespace fixed_containers::fixed_red_black_tree_detail
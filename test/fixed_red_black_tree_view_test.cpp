@@ -15,6 +15,7 @@
 #include <cstring>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <ranges>
 
 namespace fixed_containers
@@ -125,6 +126,71 @@ TEST(FixedRedBlackTreeView, ViewOfContiguousStorage)
     EXPECT_EQ(var1, var2);
 }
 
+// Node indices are stored in 1, 2 or 4 bytes depending on the capacity.
+template <std::size_t MAXIMUM_SIZE,
+          fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS,
+          template <typename, std::size_t> typename StorageTemplate,
+          fixed_red_black_tree_detail::RedBlackTreeStorageType STORAGE_TYPE>
+void check_view_of_full_set()
+{
+    using FixedSetType = FixedSet<int, MAXIMUM_SIZE, std::less<>, COMPACTNESS, StorageTemplate>;
+
+    auto var1 = std::make_unique<FixedSetType>();
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        var1->insert(static_cast<int>((i * 7919) % MAXIMUM_SIZE));
+    }
+
+    auto view = FixedRedBlackTreeRawView(var1.get(),
+                                         sizeof(typename FixedSetType::value_type),
+                                         var1->max_size(),
+                                         COMPACTNESS,
+                                         STORAGE_TYPE,
+                                         alignof(typename FixedSetType::value_type));
+
+    EXPECT_EQ(var1->size(), view.size());
+    const auto as_int = [](const std::byte* ptr) { return *reinterpret_cast<const int*>(ptr); };
+    EXPECT_TRUE(std::ranges::equal(*var1, view, {}, {}, as_int));
+}
+
+template <std::size_t MAXIMUM_SIZE>
+void check_view_of_full_set_for_all_node_types()
+{
+    using fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness;
+    using fixed_red_black_tree_detail::RedBlackTreeStorageType;
+
+    check_view_of_full_set<MAXIMUM_SIZE,
+                           RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                           FixedIndexBasedPoolStorage,
+                           RedBlackTreeStorageType::FIXED_INDEX_POOL>();
+    check_view_of_full_set<MAXIMUM_SIZE,
+                           RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                           FixedIndexBasedPoolStorage,
+                           RedBlackTreeStorageType::FIXED_INDEX_POOL>();
+    check_view_of_full_set<MAXIMUM_SIZE,
+                           RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                           FixedIndexBasedContiguousStorage,
+                           RedBlackTreeStorageType::FIXED_INDEX_CONTIGUOUS>();
+    check_view_of_full_set<MAXIMUM_SIZE,
+                           RedBlackTreeNodeColorCompactness::DEDICATED_COLOR,
+                           FixedIndexBasedContiguousStorage,
+                           RedBlackTreeStorageType::FIXED_INDEX_CONTIGUOUS>();
+}
+
+static_assert(FixedRedBlackTreeRawView::default_elem_align_bytes(1) == 1);
+static_assert(FixedRedBlackTreeRawView::default_elem_align_bytes(4) == 4);
+static_assert(FixedRedBlackTreeRawView::default_elem_align_bytes(12) == 4);
+static_assert(FixedRedBlackTreeRawView::default_elem_align_bytes(1024) ==
+              alignof(std::max_align_t));
+
+TEST(FixedRedBlackTreeView, IndexWidths)
+{
+    check_view_of_full_set_for_all_node_types<127>();
+    check_view_of_full_set_for_all_node_types<128>();
+    check_view_of_full_set_for_all_node_types<32767>();
+    check_view_of_full_set_for_all_node_types<32768>();
+}
+
 TEST(FixedRedBlackTreeView, PreservedOrdering)
 {
     constexpr auto COMPACTNESS =
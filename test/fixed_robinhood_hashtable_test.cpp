@@ -4,9 +4,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <iostream>
+#include <type_traits>
+#include <vector>
 
 namespace fixed_containers::fixed_robinhood_hashtable_detail
 {
@@ -32,6 +36,15 @@ using IntIntMap10 = FixedRobinhoodHashtable<int, int, 10, 10, ConvenientIntHash,
 using OIT = typename IntIntMap10::OpaqueIndexType;
 using IT = typename IntIntMap10::OpaqueIteratedType;
 
+using DenseIntIntMap10 = FixedRobinhoodHashtable<int,
+                                                 int,
+                                                 10,
+                                                 10,
+                                                 ConvenientIntHash,
+                                                 std::equal_to<>,
+                                                 ModuloBucketIndexing,
+                                                 DenseValueStorage>;
+
 static_assert(IsStructuralType<IntIntMap10>);
 
 #if defined(__clang__) && __clang_major__ >= 16
@@ -41,6 +54,13 @@ static_assert(TriviallyCopyAssignable<IntIntMap10>);
 static_assert(TriviallyMoveAssignable<IntIntMap10>);
 static_assert(StandardLayout<IntIntMap10>);
 
+static_assert(IsStructuralType<DenseIntIntMap10>);
+#if defined(__clang__) && __clang_major__ >= 16
+static_assert(TriviallyCopyable<DenseIntIntMap10>);
+#endif
+static_assert(StandardLayout<DenseIntIntMap10>);
+static_assert(sizeof(DenseIntIntMap10) < sizeof(IntIntMap10));
+
 template <typename T>
 [[maybe_unused]] void print_map_state(const T& map)
 {
@@ -92,6 +112,91 @@ TEST(BucketOperations, DistAndFingerprint)
     static_assert(DOWN_TWO < UP_TWO);
 }
 
+TEST(BucketOperations, WideBucket)
+{
+    static_assert(IsStructuralType<WideBucket>);
+    static_assert(StandardLayout<WideBucket>);
+    static_assert(Trivial<WideBucket>);
+    static_assert(TriviallyCopyable<WideBucket>);
+
+    static_assert(Bucket::MAX_NUM_BUCKETS == (1U << 24U) - 1);
+    static_assert(WideBucket::MAX_NUM_BUCKETS > Bucket::MAX_NUM_BUCKETS);
+
+    constexpr uint64_t DIST_AND_FINGERPRINT = WideBucket::dist_and_fingerprint_from_hash(0x1234UL);
+    static_assert((DIST_AND_FINGERPRINT & WideBucket::FINGERPRINT_MASK) == 0x34);
+    static_assert((DIST_AND_FINGERPRINT >> WideBucket::FINGERPRINT_BITS) == 1);
+
+    // Distances that would overflow the compact bucket
+    constexpr WideBucket FAR_AWAY{
+        .dist_and_fingerprint_ =
+            DIST_AND_FINGERPRINT + (uint64_t{Bucket::MAX_NUM_BUCKETS} * WideBucket::DIST_INC),
+        .value_index_ = 7};
+    static_assert(FAR_AWAY.dist() == Bucket::MAX_NUM_BUCKETS + 1);
+    static_assert(FAR_AWAY.fingerprint() == 0x34);
+    static_assert(FAR_AWAY.plus_dist().dist() == Bucket::MAX_NUM_BUCKETS + 2);
+    static_assert(FAR_AWAY.plus_dist().fingerprint() == 0x34);
+    static_assert(FAR_AWAY.plus_dist().minus_dist().dist_and_fingerprint_ ==
+                  FAR_AWAY.dist_and_fingerprint_);
+    static_assert(FAR_AWAY.plus_dist().value_index_ == 7);
+}
+
+TEST(BucketOperations, BucketSelection)
+{
+    static_assert(std::is_same_v<Bucket, IntIntMap10::BucketType>);
+    static_assert(std::is_same_v<Bucket, BucketForTableSize<Bucket::MAX_NUM_BUCKETS>>);
+    static_assert(std::is_same_v<WideBucket, BucketForTableSize<Bucket::MAX_NUM_BUCKETS + 1>>);
+
+    // Only the type is instantiated: an instance would need 256 MiB of buckets
+    using LargeTable = FixedRobinhoodHashtable<int,
+                                               int,
+                                               10,
+                                               Bucket::MAX_NUM_BUCKETS + 1,
+                                               ConvenientIntHash,
+                                               std::equal_to<>>;
+    static_assert(std::is_same_v<WideBucket, LargeTable::BucketType>);
+    static_assert(LargeTable::INTERNAL_TABLE_SIZE > Bucket::MAX_NUM_BUCKETS);
+}
+
+TEST(BucketOperations, HashtableTuning)
+{
+    using Compact = FixedRobinhoodHashtable<int,
+                                            int,
+                                            100,
+                                            HashtableTuning<110, 16>::bucket_count(100),
+                                            ConvenientIntHash,
+                                            std::equal_to<>,
+                                            ModuloBucketIndexing,
+                                            LinkedListValueStorage,
+                                            HashtableTuning<110, 16>>;
+    static_assert(Compact::INTERNAL_TABLE_SIZE == 110);
+    static_assert(Compact::BucketType::FINGERPRINT_BITS == 16);
+    static_assert(std::is_same_v<Compact::DistAndFingerprintType, std::uint32_t>);
+
+    // `AUTO_BUCKET_COUNT` resolves to the bucket count of the tuning, and the default tuning keeps
+    // the default bucket count
+    static_assert(resolve_bucket_count<HashtableTuning<110, 16>>(AUTO_BUCKET_COUNT, 100) == 110);
+    static_assert(resolve_bucket_count<DefaultHashtableTuning>(AUTO_BUCKET_COUNT, 100) ==
+                  default_bucket_count(100));
+    static_assert(resolve_bucket_count<HashtableTuning<110, 16>>(150, 100) == 150);
+
+    // An explicit bucket count can't be combined with the load factor of a tuning
+    static_assert(is_valid_bucket_count_for_tuning<HashtableTuning<110, 16>>(AUTO_BUCKET_COUNT));
+    static_assert(!is_valid_bucket_count_for_tuning<HashtableTuning<110, 16>>(150));
+    static_assert(is_valid_bucket_count_for_tuning<HashtableTuning<130, 16>>(150));
+
+    // Wider fingerprints leave fewer bits for the distance
+    using Bucket16 = BasicBucket<std::uint32_t, 16>;
+    static_assert(Bucket16::MAX_NUM_BUCKETS == 0xFFFF);
+    static_assert(std::is_same_v<Bucket16, BucketForTableSize<0xFFFF, 16>>);
+    static_assert(
+        std::is_same_v<BasicBucket<std::uint64_t, 16>, BucketForTableSize<0x10000, 16>>);
+
+    constexpr std::uint32_t DIST_AND_FINGERPRINT =
+        Bucket16::dist_and_fingerprint_from_hash(0x123456UL);
+    static_assert((DIST_AND_FINGERPRINT & Bucket16::FINGERPRINT_MASK) == 0x3456);
+    static_assert((DIST_AND_FINGERPRINT >> Bucket16::FINGERPRINT_BITS) == 1);
+}
+
 TEST(BucketOperations, BucketArray)
 {
     static_assert(IntIntMap10::bucket_index_from_hash(0 << Bucket::FINGERPRINT_BITS) == 0);
@@ -105,6 +210,52 @@ TEST(BucketOperations, BucketArray)
     static_assert(IntIntMap10::next_bucket_index(9) == 0);
 }
 
+TEST(BucketOperations, PowerOfTwoBucketIndexing)
+{
+    using PowerOfTwoMap = FixedRobinhoodHashtable<int,
+                                                  int,
+                                                  10,
+                                                  10,
+                                                  ConvenientIntHash,
+                                                  std::equal_to<>,
+                                                  PowerOfTwoBucketIndexing>;
+    static_assert(PowerOfTwoMap::INTERNAL_TABLE_SIZE == 16);
+
+    static_assert(PowerOfTwoMap::bucket_index_from_hash(0 << Bucket::FINGERPRINT_BITS) == 0);
+    static_assert(PowerOfTwoMap::bucket_index_from_hash(11 << Bucket::FINGERPRINT_BITS) == 11);
+    static_assert(PowerOfTwoMap::bucket_index_from_hash(16 << Bucket::FINGERPRINT_BITS) == 0);
+    static_assert(PowerOfTwoMap::bucket_index_from_hash(17 << Bucket::FINGERPRINT_BITS) == 1);
+
+    static_assert(PowerOfTwoMap::next_bucket_index(9) == 10);
+    static_assert(PowerOfTwoMap::next_bucket_index(15) == 0);
+
+    static_assert(PowerOfTwoBucketIndexing::table_size(0) == 1);
+    static_assert(PowerOfTwoBucketIndexing::table_size(16) == 16);
+    static_assert(PowerOfTwoBucketIndexing::table_size(17) == 32);
+}
+
+TEST(BucketOperations, FastRangeBucketIndexing)
+{
+    using FastRangeMap = FixedRobinhoodHashtable<int,
+                                                 int,
+                                                 10,
+                                                 10,
+                                                 ConvenientIntHash,
+                                                 std::equal_to<>,
+                                                 FastRangeBucketIndexing>;
+    static_assert(FastRangeMap::INTERNAL_TABLE_SIZE == 10);
+
+    static_assert(FastRangeBucketIndexing::bucket_index_from_hash<10>(0) == 0);
+    static_assert(FastRangeBucketIndexing::bucket_index_from_hash<10>(0x7FFFFFFFULL) == 4);
+    static_assert(FastRangeBucketIndexing::bucket_index_from_hash<10>(0x80000000ULL) == 5);
+    static_assert(FastRangeBucketIndexing::bucket_index_from_hash<10>(0xFFFFFFFFULL) == 9);
+    // Only the low 32 bits participate
+    static_assert(FastRangeBucketIndexing::bucket_index_from_hash<10>(0x1'80000000ULL) == 5);
+
+    static_assert(FastRangeMap::bucket_index_from_hash(0xFFFFFFFFULL << Bucket::FINGERPRINT_BITS) ==
+                  9);
+}
+
 TEST(MapOperations, Emplace)
 {
     IntIntMap10 map{};
@@ -393,6 +544,45 @@ TEST(MapOperations, Search)
     EXPECT_FALSE(map.exists(idx));
 }
 
+TEST(MapOperations, BatchedSearch)
+{
+    IntIntMap10 map{};
+    for (const int key : {13, 33, 9, 43, 6, 23, 66, 128, 0})
+    {
+        map.emplace(map.opaque_index_of(key), key, key * 2);
+    }
+
+    // Any contiguous range of keys, longer than the lookup window, with hits and misses
+    std::vector<int> keys{};
+    for (int i = 0; i < 3; i++)
+    {
+        keys.insert(keys.end(), {13, 10, 33, 1, 9, 43, 2, 6, 23, 46, 66, 128, 0, 99});
+    }
+    ASSERT_GT(keys.size(), IntIntMap10::LOOKUP_WINDOW_SIZE);
+
+    std::vector<std::size_t> visited{};
+    map.for_each_opaque_index_of(keys,
+                                 [&](std::size_t i, const OIT& idx)
+                                 {
+                                     visited.push_back(i);
+                                     const OIT expected = map.opaque_index_of(keys[i]);
+                                     EXPECT_EQ(expected.bucket_index, idx.bucket_index);
+                                     EXPECT_EQ(map.exists(expected), map.exists(idx));
+                                     if (map.exists(idx))
+                                     {
+                                         EXPECT_EQ(keys[i] * 2, map.value(idx));
+                                     }
+                                 });
+    ASSERT_EQ(keys.size(), visited.size());
+    for (std::size_t i = 0; i < visited.size(); i++)
+    {
+        EXPECT_EQ(i, visited[i]);
+    }
+
+    map.for_each_opaque_index_of(std::vector<int>{},
+                                 [](std::size_t, const OIT&) { ADD_FAILURE(); });
+}
+
 TEST(MapOperations, Erase)
 {
     // same operation sequence as the test above, map is in the same state:
@@ -742,6 +932,56 @@ TEST(MapOperations, EraseRange)
     idx = map.opaque_index_of(0);
 }
 
+TEST(MapOperations, Clear)
+{
+    const auto fill_and_clear = []<typename MapType>()
+    {
+        MapType map{};
+        // Colliding keys, so that the probe sequences wrap around the end of the table
+        for (const int key : {9, 19, 29, 6, 16, 0})
+        {
+            map.emplace(map.opaque_index_of(key), key, key * 10);
+        }
+        map.clear();
+
+        EXPECT_EQ(map.size(), 0);
+        EXPECT_EQ(map.begin_index(), map.end_index());
+        for (typename MapType::SizeType i = 0; i < MapType::INTERNAL_TABLE_SIZE; i++)
+        {
+            EXPECT_EQ(map.bucket_at(i).dist_and_fingerprint_, 0);
+        }
+
+        // The table is fully usable again, up to its capacity
+        for (int key = 0; key < 10; key++)
+        {
+            const auto idx = map.opaque_index_of(key * 11);
+            EXPECT_FALSE(map.exists(idx));
+            map.emplace(idx, key * 11, key);
+        }
+        EXPECT_EQ(map.size(), 10);
+        for (int key = 0; key < 10; key++)
+        {
+            const auto idx = map.opaque_index_of(key * 11);
+            EXPECT_TRUE(map.exists(idx));
+            EXPECT_EQ(map.value(idx), key);
+        }
+    };
+
+    fill_and_clear.template operator()<IntIntMap10>();
+    fill_and_clear.template operator()<DenseIntIntMap10>();
+    // Few values for the bucket count: only the occupied buckets are looked up and zeroed
+    fill_and_clear.template operator()<
+        FixedRobinhoodHashtable<int, int, 10, 200, ConvenientIntHash, std::equal_to<>>>();
+    fill_and_clear.template operator()<FixedRobinhoodHashtable<int,
+                                                               int,
+                                                               10,
+                                                               200,
+                                                               ConvenientIntHash,
+                                                               std::equal_to<>,
+                                                               ModuloBucketIndexing,
+                                                               DenseValueStorage>>();
+}
+
 // in very rare cases, we could have a key that collides both in index AND in fingerprint
 TEST(MapCornerCases, PerfectCollisions)
 {
@@ -878,4 +1118,243 @@ TEST(MapCornerCases, PerfectCollisions)
     EXPECT_EQ(idx.bucket_index, 6);
 }
 
+// Long probe chains (every key lands in a handful of buckets) that also wrap around the end of the
+// table. The runtime (possibly vectorized) probe must agree with the scalar one everywhere.
+TEST(MapCornerCases, ProbeModesAgree)
+{
+    using IntIntMap64 =
+        FixedRobinhoodHashtable<int, int, 64, 64, ConvenientIntHash, std::equal_to<>>;
+    using OIT64 = typename IntIntMap64::OpaqueIndexType;
+    IntIntMap64 map{};
+
+    const auto expect_probes_agree = [&map](int key)
+    {
+        const std::uint64_t key_hash = map.hash(key);
+        const OIT64 scalar = map.probe_scalar(key,
+                                            IntIntMap64::bucket_index_from_hash(key_hash),
+                                            Bucket::dist_and_fingerprint_from_hash(key_hash));
+        const OIT64 actual = map.opaque_index_of(key);
+        EXPECT_EQ(scalar.bucket_index, actual.bucket_index);
+        EXPECT_EQ(scalar.dist_and_fingerprint, actual.dist_and_fingerprint);
+    };
+
+    // With ConvenientIntHash, keys that differ by a multiple of 256 collide in both the bucket
+    // index and the fingerprint. Start near the end of the table so that the chains wrap around.
+    for (int i = 0; i < 48; i++)
+    {
+        const int key = 60 + ((i % 6) * 256) + (i / 6);
+        const OIT64 idx = map.opaque_index_of(key);
+        ASSERT_FALSE(map.exists(idx));
+        map.emplace(idx, key, i);
+    }
+
+    for (int key = 0; key < 2048; key++)
+    {
+        expect_probes_agree(key);
+    }
+
+    map.erase(map.opaque_index_of(60 + 256));
+    map.erase(map.opaque_index_of(63));
+    for (int key = 0; key < 2048; key++)
+    {
+        expect_probes_agree(key);
+    }
+}
+
+// Misses only call `key_equal` on fingerprint matches, so wider fingerprints call it less.
+TEST(MapCornerCases, WiderFingerprintsCallKeyEqualLess)
+{
+    // splitmix64's finalizer
+    struct MixingHash
+    {
+        constexpr std::uint64_t operator()(const int& value) const
+        {
+            std::uint64_t hash = static_cast<std::uint64_t>(value);
+            hash = (hash ^ (hash >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+            hash = (hash ^ (hash >> 27U)) * 0x94D049BB133111EBULL;
+            return hash ^ (hash >> 31U);
+        }
+    };
+    struct CountingKeyEqual
+    {
+        int* call_count;
+        constexpr bool operator()(const int& lhs, const int& rhs) const
+        {
+            ++*call_count;
+            return lhs == rhs;
+        }
+    };
+
+    const auto count_key_equal_calls_on_misses = []<std::uint32_t FINGERPRINT_BITS>()
+    {
+        using Table = FixedRobinhoodHashtable<int,
+                                              int,
+                                              200,
+                                              200,
+                                              MixingHash,
+                                              CountingKeyEqual,
+                                              ModuloBucketIndexing,
+                                              LinkedListValueStorage,
+                                              HashtableTuning<100, FINGERPRINT_BITS>>;
+        int call_count = 0;
+        Table table{MixingHash{}, CountingKeyEqual{&call_count}};
+        for (int i = 0; i < 200; i++)
+        {
+            const auto idx = table.opaque_index_of(i);
+            EXPECT_FALSE(table.exists(idx));
+            table.emplace(idx, i, i);
+        }
+        for (int i = 0; i < 200; i++)
+        {
+            EXPECT_TRUE(table.exists(table.opaque_index_of(i)));
+        }
+
+        call_count = 0;
+        for (int i = 200; i < 2200; i++)
+        {
+            EXPECT_FALSE(table.exists(table.opaque_index_of(i)));
+        }
+        return call_count;
+    };
+
+    const int calls_with_8_bits = count_key_equal_calls_on_misses.template operator()<8>();
+    const int calls_with_16_bits = count_key_equal_calls_on_misses.template operator()<16>();
+    EXPECT_GT(calls_with_8_bits, 0);
+    EXPECT_LT(calls_with_16_bits, calls_with_8_bits);
+}
+
+TEST(DenseValueStorage, EraseMovesLastValue)
+{
+    DenseIntIntMap10 map{};
+    for (int key : {13, 33, 9, 43, 6})
+    {
+        map.emplace(map.opaque_index_of(key), key, key * 10);
+    }
+    // values are packed in insertion order
+    EXPECT_EQ(0, map.iterated_index_from(map.opaque_index_of(13)));
+    EXPECT_EQ(4, map.iterated_index_from(map.opaque_index_of(6)));
+
+    // the last value (6) takes the place of the erased one, and is the next one to iterate
+    const IT next = map.erase(map.opaque_index_of(33));
+    EXPECT_EQ(1, next);
+    EXPECT_EQ(6, map.key_at(next));
+    EXPECT_EQ(60, map.value_at(next));
+    EXPECT_EQ(4, map.size());
+    EXPECT_EQ(1, map.iterated_index_from(map.opaque_index_of(6)));
+    EXPECT_FALSE(map.exists(map.opaque_index_of(33)));
+
+    // erasing the last value moves nothing
+    EXPECT_EQ(map.invalid_index(), map.erase(map.opaque_index_of(43)));
+    EXPECT_EQ(3, map.size());
+
+    for (int key : {13, 9, 6})
+    {
+        const auto idx = map.opaque_index_of(key);
+        ASSERT_TRUE(map.exists(idx));
+        EXPECT_EQ(key * 10, map.value(idx));
+    }
+
+    // iteration is a linear scan, from both ends
+    EXPECT_EQ(0, map.begin_index());
+    EXPECT_EQ(1, map.next_of(0));
+    EXPECT_EQ(map.invalid_index(), map.next_of(2));
+    EXPECT_EQ(2, map.prev_of(map.end_index()));
+    EXPECT_EQ(map.invalid_index(), map.prev_of(0));
+}
+
+TEST(DenseValueStorage, EraseRange)
+{
+    DenseIntIntMap10 map{};
+    for (int key = 0; key < 8; key++)
+    {
+        map.emplace(map.opaque_index_of(key), key, key);
+    }
+
+    // the values after the range (6, 7) are moved into it
+    const IT next = map.erase_range(2, 6);
+    EXPECT_EQ(2, next);
+    EXPECT_EQ(4, map.size());
+    std::array<int, 4> remaining{};
+    for (IT i = map.begin_index(); i != map.end_index(); i = map.next_of(i))
+    {
+        remaining.at(i) = map.key_at(i);
+    }
+    std::sort(remaining.begin() + 2, remaining.end());
+    EXPECT_EQ((std::array<int, 4>{0, 1, 6, 7}), remaining);
+
+    EXPECT_EQ(map.invalid_index(), map.erase_range(map.begin_index(), map.end_index()));
+    EXPECT_EQ(0, map.size());
+    EXPECT_EQ(map.invalid_index(), map.erase_range(map.begin_index(), map.end_index()));
+    for (int key = 0; key < 8; key++)
+    {
+        EXPECT_FALSE(map.exists(map.opaque_index_of(key)));
+    }
+}
+
+// Heavy collisions and wrap-around, where every erasure repoints the bucket of the moved value.
+TEST(DenseValueStorage, ChurnMatchesLinkedListStorage)
+{
+    using LinkedListMap =
+        FixedRobinhoodHashtable<int, int, 64, 64, ConvenientIntHash, std::equal_to<>>;
+    using DenseMap = FixedRobinhoodHashtable<int,
+                                             int,
+                                             64,
+                                             64,
+                                             ConvenientIntHash,
+                                             std::equal_to<>,
+                                             ModuloBucketIndexing,
+                                             DenseValueStorage>;
+    LinkedListMap reference{};
+    DenseMap map{};
+
+    const auto key_at_step = [](int step) { return 60 + ((step * 7) % 6) * 256 + (step % 11); };
+    for (int step = 0; step < 2000; step++)
+    {
+        const int key = key_at_step(step);
+        const auto reference_idx = reference.opaque_index_of(key);
+        const auto idx = map.opaque_index_of(key);
+        ASSERT_EQ(reference.exists(reference_idx), map.exists(idx));
+        if (map.exists(idx))
+        {
+            ASSERT_EQ(reference.value(reference_idx), map.value(idx));
+            reference.erase(reference_idx);
+            map.erase(idx);
+        }
+        else if (map.size() < 48)
+        {
+            reference.emplace(reference_idx, key, step);
+            map.emplace(idx, key, step);
+        }
+        ASSERT_EQ(reference.size(), map.size());
+    }
+
+    for (IT i = map.begin_index(); i != map.end_index(); i = map.next_of(i))
+    {
+        const auto reference_idx = reference.opaque_index_of(map.key_at(i));
+        ASSERT_TRUE(reference.exists(reference_idx));
+        EXPECT_EQ(reference.value(reference_idx), map.value_at(i));
+        EXPECT_EQ(i, map.iterated_index_from(map.opaque_index_of(map.key_at(i))));
+    }
+}
+
+TEST(DenseValueStorage, Constexpr)
+{
+    constexpr DenseIntIntMap10 MAP = []()
+    {
+        DenseIntIntMap10 out{};
+        for (int key = 0; key < 10; key++)
+        {
+            out.emplace(out.opaque_index_of(key), key, key * 2);
+        }
+        out.erase(out.opaque_index_of(3));
+        out.erase_range(out.begin_index(), 2);
+        return out;
+    }();
+
+    static_assert(MAP.size() == 7);
+    static_assert(MAP.key_at(0) == 7);
+    static_assert(!MAP.exists(MAP.opaque_index_of(0)));
+    static_assert(MAP.value(MAP.opaque_index_of(9)) == 18);
+}
+
 }  // namespace fixed_containers::fixed_robinhood_hashtable_detail
@@ -5,7 +5,12 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/max_size.hpp"
+#include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/set_operations.hpp"
+#include "fixed_containers/sorted_unique.hpp"
 
 #include <gtest/gtest.h>
 
@@ -15,10 +20,12 @@
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <random>
 #include <ranges>
 #include <set>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -194,6 +201,38 @@ TEST(FixedSet, EqualRangeTransparentComparator)
     static_assert(VAL.equal_range(KEY_B).second == VAL.upper_bound(KEY_B));
 }
 
+TEST(FixedSet, OrderStatistics)
+{
+    using SetType =
+        FixedSet<int,
+                 10,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedPoolStorage,
+                 customize::SetAbortChecking<int, 10>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeAugmentation::SUBTREE_SIZE>;
+
+    constexpr SetType VAL1 = []()
+    {
+        SetType var{1, 2, 3, 4, 5, 6, 7, 8};
+        erase_if(var, [](const int key) { return key % 2 == 1; });
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<4, VAL1.size()>);
+    static_assert(*VAL1.nth(0) == 2);
+    static_assert(*VAL1.nth(3) == 8);
+    static_assert(VAL1.nth(4) == VAL1.cend());
+
+    static_assert(VAL1.rank(2) == 0);
+    static_assert(VAL1.rank(5) == 2);
+    static_assert(VAL1.rank(9) == 4);
+
+    static_assert(VAL1.count_range(2, 8) == 3);
+    static_assert(VAL1.count_range(3, 4) == 0);
+    static_assert(VAL1.count_range(8, 2) == 0);
+}
+
 TEST(FixedSet, MaxSize)
 {
     constexpr FixedSet<int, 10> VAL1{2, 4};
@@ -355,6 +394,57 @@ TEST(FixedSet, InsertIterators)
     static_assert(std::is_same_v<decltype(*s_non_const.begin()), const int&>);
 }
 
+TEST(FixedSet, InsertWithHint)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var{};
+        // Monotonically increasing keys, hinted at the end
+        for (int i = 0; i < 5; i++)
+        {
+            var.insert(var.cend(), i * 10);
+        }
+        // The right hint, a wrong hint, and an existing key
+        var.insert(var.find(20), 15);
+        var.emplace_hint(var.begin(), 35);
+        var.insert(var.end(), 20);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 7);
+    static_assert(std::ranges::equal(VAL1, std::array{0, 10, 15, 20, 30, 35, 40}));
+}
+
+TEST(FixedSet, InsertSortedUnique)
+{
+    static constexpr std::array<int, 3> ENTRIES{1, 3, 5};
+
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var{std_transition::sorted_unique, ENTRIES.begin(), ENTRIES.end()};
+        // Not empty anymore, so these are inserted one by one.
+        const std::array<int, 3> more_entries{0, 3, 4};
+        var.insert(std_transition::sorted_unique, more_entries.begin(), more_entries.end());
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 5);
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 3, 4, 5}));
+
+    FixedSet<int, 100> var{};
+    std::array<int, 100> expected{};
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        expected[i] = static_cast<int>(i * 3);
+    }
+    var.insert(std_transition::sorted_unique, expected.begin(), expected.end());
+    ASSERT_TRUE(std::ranges::equal(var, expected));
+    ASSERT_EQ(*var.lower_bound(100), 102);
+    var.erase(var.begin(), var.lower_bound(200));
+    ASSERT_EQ(var.size(), 33);
+    ASSERT_EQ(*var.begin(), 201);
+}
+
 TEST(FixedSet, Emplace)
 {
     {
@@ -572,6 +662,120 @@ TEST(FixedSet, EraseIf)
     static_assert(!VAL1.contains(4));
 }
 
+TEST(FixedSet, SetOperations)
+{
+    constexpr FixedSet<int, 10> VAL1{1, 3, 5, 7};
+    constexpr FixedSet<int, 5> VAL2{3, 4, 5, 9};
+
+    constexpr auto UNION = set_union(VAL1, VAL2);
+    static_assert(std::is_same_v<const FixedSet<int, 10>, decltype(UNION)>);
+    static_assert(std::ranges::equal(UNION, std::array{1, 3, 4, 5, 7, 9}));
+    static_assert(std::ranges::equal(set_intersection(VAL1, VAL2), std::array{3, 5}));
+    static_assert(std::ranges::equal(set_difference(VAL1, VAL2), std::array{1, 7}));
+    static_assert(std::ranges::equal(set_difference(VAL2, VAL1), std::array{4, 9}));
+
+    static_assert(set_union(VAL1, FixedSet<int, 3>{}) == VAL1);
+    static_assert(set_intersection(VAL1, FixedSet<int, 3>{}).empty());
+    static_assert(set_difference(FixedSet<int, 3>{}, VAL1).empty());
+
+    static_assert(includes(VAL1, FixedSet<int, 3>{1, 7}));
+    static_assert(includes(VAL1, FixedSet<int, 3>{}));
+    static_assert(!includes(VAL1, FixedSet<int, 3>{1, 2}));
+}
+
+TEST(FixedSet, SetOperationsMatchStdAlgorithms)
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> key_distribution(0, 60);
+    for (std::size_t iteration = 0; iteration < 100; iteration++)
+    {
+        FixedSet<int, 40> var1{};
+        FixedSet<int, 40> var2{};
+        for (std::size_t i = 0; i < 20; i++)
+        {
+            var1.insert(key_distribution(rng));
+            var2.insert(key_distribution(rng));
+        }
+
+        std::vector<int> expected{};
+        std::ranges::set_union(var1, var2, std::back_inserter(expected));
+        ASSERT_TRUE(std::ranges::equal(expected, set_union(var1, var2)));
+
+        expected.clear();
+        std::ranges::set_intersection(var1, var2, std::back_inserter(expected));
+        ASSERT_TRUE(std::ranges::equal(expected, set_intersection(var1, var2)));
+
+        expected.clear();
+        std::ranges::set_difference(var1, var2, std::back_inserter(expected));
+        ASSERT_TRUE(std::ranges::equal(expected, set_difference(var1, var2)));
+
+        ASSERT_EQ(std::ranges::includes(var1, var2), includes(var1, var2));
+        ASSERT_TRUE(includes(var1, set_intersection(var1, var2)));
+    }
+}
+
+TEST(FixedSet, SetUnionExceedsCapacity)
+{
+    const FixedSet<int, 3> var1{1, 2, 3};
+    const FixedSet<int, 3> var2{4};
+    EXPECT_DEATH((void)set_union(var1, var2), "");
+}
+
+TEST(FixedSet, Compact)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var1{};
+        for (int i = 0; i < 10; i++)
+        {
+            var1.insert((i * 3) % 10);
+        }
+        var1.erase(0);
+        var1.erase(5);
+        var1.compact();
+        var1.insert(20);
+        return var1;
+    }();
+
+    static_assert(VAL1 == FixedSet<int, 10>{1, 2, 3, 4, 6, 7, 8, 9, 20});
+
+    FixedSet<int, 50> var2{};
+    for (int i = 0; i < 50; i++)
+    {
+        var2.insert((i * 13) % 50);
+    }
+    erase_if(var2, [](const int key) { return key % 3 == 0; });
+    const FixedSet<int, 50> before_compaction{var2};
+    var2.compact();
+    EXPECT_EQ(before_compaction, var2);
+
+    // Iterating visits ascending addresses
+    const int* previous = nullptr;
+    for (const int& key : var2)
+    {
+        if (previous != nullptr)
+        {
+            EXPECT_TRUE(std::less<const int*>{}(previous, &key));
+        }
+        previous = &key;
+    }
+}
+
+TEST(FixedSet, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var1{2, 3, 8};
+        FixedSet<int, 5> var2{1, 3, 5, 9};
+        var1.merge(var2);
+        assert_or_abort(std::ranges::equal(var2, std::array{3}));
+        var1.merge(var1);
+        return var1;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{1, 2, 3, 5, 8, 9}));
+}
+
 TEST(FixedSet, IteratorBasic)
 {
     constexpr FixedSet<int, 10> VAL1{1, 2, 3, 4};
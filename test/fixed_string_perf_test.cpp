@@ -0,0 +1,168 @@
+#include "benchmark_utils.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+using benchmark_utils::element_count;
+using benchmark_utils::make_heap_allocated;
+
+template <typename StringType>
+void fill(StringType& instance, std::size_t count)
+{
+    instance.clear();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        instance.push_back(static_cast<char>('a' + (i % 26)));
+    }
+}
+
+template <typename StringType, std::size_t CAPACITY>
+void benchmark_push_back(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<StringType>();
+
+    for (auto _ : state)
+    {
+        fill(*instance, count);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename StringType, std::size_t CAPACITY>
+void benchmark_append(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto source = make_heap_allocated<StringType>();
+    auto instance = make_heap_allocated<StringType>();
+    fill(*source, count / 2);
+    const std::string_view half{source->data(), source->size()};
+
+    for (auto _ : state)
+    {
+        instance->clear();
+        instance->append(half);
+        instance->append(half);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename StringType, std::size_t CAPACITY>
+void benchmark_find(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<StringType>();
+    fill(*instance, count);
+    // Not present, so the whole string is scanned
+    constexpr std::string_view NEEDLE = "abcz";
+
+    for (auto _ : state)
+    {
+        auto pos = instance->find(NEEDLE);
+        benchmark::DoNotOptimize(pos);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename StringType, std::size_t CAPACITY>
+void benchmark_rfind(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<StringType>();
+    fill(*instance, count);
+
+    for (auto _ : state)
+    {
+        // Not present, so the whole string is scanned
+        auto pos = instance->rfind('#');
+        benchmark::DoNotOptimize(pos);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename StringType, std::size_t CAPACITY>
+void benchmark_equality(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto first = make_heap_allocated<StringType>();
+    auto second = make_heap_allocated<StringType>();
+    fill(*first, count);
+    fill(*second, count);
+
+    for (auto _ : state)
+    {
+        bool are_equal = *first == *second;
+        benchmark::DoNotOptimize(are_equal);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename StringType, std::size_t CAPACITY>
+void benchmark_copy(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto source = make_heap_allocated<StringType>();
+    auto destination = make_heap_allocated<StringType>();
+    fill(*source, count);
+
+    for (auto _ : state)
+    {
+        *destination = *source;
+        benchmark::ClobberMemory();
+    }
+}
+
+template <std::size_t CAPACITY>
+bool register_string_benchmarks()
+{
+    const auto register_for = [&]<typename StringType>(std::string_view container_name)
+    {
+        const auto name = [&](std::string_view operation)
+        {
+            return std::string{operation} + "/" + std::string{container_name} + "<" +
+                   std::to_string(CAPACITY) + ">";
+        };
+
+        benchmark::RegisterBenchmark(name("push_back").c_str(),
+                                     benchmark_push_back<StringType, CAPACITY>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("append").c_str(),
+                                     benchmark_append<StringType, CAPACITY>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("find").c_str(), benchmark_find<StringType, CAPACITY>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("rfind").c_str(), benchmark_rfind<StringType, CAPACITY>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("equality").c_str(),
+                                     benchmark_equality<StringType, CAPACITY>)
+            ->Apply(benchmark_utils::fill_ratios);
+        benchmark::RegisterBenchmark(name("copy").c_str(), benchmark_copy<StringType, CAPACITY>)
+            ->Apply(benchmark_utils::fill_ratios);
+    };
+
+    register_for.template operator()<std::string>("std::string");
+    register_for.template operator()<FixedString<CAPACITY>>("FixedString");
+    return true;
+}
+
+[[maybe_unused]] const bool REGISTERED =
+    register_string_benchmarks<16>() && register_string_benchmarks<31>() &&
+    register_string_benchmarks<256>() &&
+    register_string_benchmarks<4096>() && register_string_benchmarks<65536>();
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -16,6 +16,7 @@
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -24,6 +25,7 @@ namespace
 using FixedStringType = FixedString<5>;
 // Static assert for expected type properties
 static_assert(TriviallyCopyable<FixedStringType>);
+static_assert(TriviallyRelocatable<FixedStringType>);
 static_assert(NotTrivial<FixedStringType>);
 static_assert(StandardLayout<FixedStringType>);
 static_assert(IsStructuralType<FixedStringType>);
@@ -31,6 +33,10 @@ static_assert(IsStructuralType<FixedStringType>);
 static_assert(std::contiguous_iterator<FixedStringType::iterator>);
 static_assert(std::contiguous_iterator<FixedStringType::const_iterator>);
 
+// The length is stored in a single byte for short strings
+static_assert(sizeof(FixedString<15>) == 17);
+static_assert(sizeof(FixedString<23>) == 25);
+
 void const_span_ref(const std::span<char>& /*unused*/) {}
 void const_span_of_const_ref(const std::span<const char>& /*unused*/) {}
 
@@ -1048,6 +1054,28 @@ TEST(FixedString, PushBackExceedsCapacity)
     EXPECT_DEATH(var.push_back('2'), "");
 }
 
+TEST(FixedString, UncheckedAppends)
+{
+    // For off-by-one issues, make the capacity just fit
+    constexpr auto VAL1 = []()
+    {
+        FixedString<6> var{"01"};
+        var.push_back_unchecked('2');
+        var.append_unchecked("345");
+        return var;
+    }();
+
+    static_assert(VAL1 == "012345");
+    static_assert(VAL1.size() == 6);
+    static_assert(*std::next(VAL1.data(), 6) == '\0');
+
+    FixedString<7> var{"0123"};
+    auto& self = var.append_unchecked("ae");
+    EXPECT_EQ(var, "0123ae");
+    EXPECT_EQ(self, var);
+    EXPECT_EQ(std::string_view{var.c_str()}, "0123ae");
+}
+
 TEST(FixedString, PopBack)
 {
     constexpr auto VAL1 = []()
@@ -1843,6 +1871,130 @@ TEST(FixedString, ResizeExceedsCapacity)
     EXPECT_DEATH(var1.resize(to_size, 5), "");
 }
 
+TEST(FixedString, ResizeAndOverwrite)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedString<8> var{"012"};
+        var.resize_for_overwrite(5);
+        var[3] = '3';
+        var[4] = '4';
+        return var;
+    }();
+    static_assert(VAL1 == "01234");
+    static_assert(*std::next(VAL1.data(), 5) == '\0');
+
+    constexpr auto VAL2 = []()
+    {
+        FixedString<8> var{"012"};
+        var.resize_and_overwrite(var.max_size(),
+                                 [](char* data, std::size_t /*count*/)
+                                 {
+                                     data[3] = 'a';
+                                     data[4] = 'b';
+                                     return 5;
+                                 });
+        return var;
+    }();
+    static_assert(VAL2 == "012ab");
+    static_assert(*std::next(VAL2.data(), 5) == '\0');
+
+    FixedString<8> var{"01234"};
+    var.resize_and_overwrite(3, [](char* /*data*/, std::size_t count) { return count - 1; });
+    EXPECT_EQ(var, "01");
+    EXPECT_EQ(std::string_view{var.c_str()}, "01");
+}
+
+TEST(FixedString, ResizeAndOverwriteExceedsCapacity)
+{
+    FixedString<3> var1{};
+    EXPECT_DEATH(var1.resize_for_overwrite(4), "");
+    EXPECT_DEATH(var1.resize_and_overwrite(4, [](char*, std::size_t count) { return count; }), "");
+    EXPECT_DEATH(var1.resize_and_overwrite(2, [](char*, std::size_t count) { return count + 1; }),
+                 "");
+}
+
+namespace
+{
+// Runtime searches and comparisons read the buffer in whole blocks, so check them against
+// `std::string_view` for every length, including ones that end in the middle of a block
+template <std::size_t MAXIMUM_LENGTH, std::size_t OTHER_MAXIMUM_LENGTH>
+void expect_same_search_and_comparison_as_string_view()
+{
+    static constexpr std::string_view ALPHABET = "abcab_cabzab";
+    static constexpr std::string_view CHARACTERS = "abz_x";
+    static constexpr std::array<std::string_view, 6> OTHER_NEEDLES{
+        "zz", "ab", "bza", "x_", "", "b"};
+
+    for (std::size_t length = 0; length <= MAXIMUM_LENGTH; length++)
+    {
+        FixedString<MAXIMUM_LENGTH> var1{};
+        for (std::size_t i = 0; i < length; i++)
+        {
+            var1.push_back(ALPHABET[(i * 5 + length) % ALPHABET.size()]);
+        }
+        const std::string_view view = var1;
+
+        std::vector<std::string_view> needles(OTHER_NEEDLES.begin(), OTHER_NEEDLES.end());
+        for (std::size_t needle_length = 2; needle_length <= 5 && needle_length <= length;
+             needle_length++)
+        {
+            needles.push_back(view.substr(length - needle_length));
+            needles.push_back(view.substr(length / 2, needle_length));
+        }
+
+        for (std::size_t pos = 0; pos <= length + 1; pos++)
+        {
+            for (const char character : CHARACTERS)
+            {
+                ASSERT_EQ(view.find(character, pos), var1.find(character, pos));
+                ASSERT_EQ(view.rfind(character, pos), var1.rfind(character, pos));
+            }
+            for (const std::string_view& needle : needles)
+            {
+                ASSERT_EQ(view.find(needle, pos), var1.find(needle, pos));
+            }
+        }
+        for (const char character : CHARACTERS)
+        {
+            ASSERT_EQ(view.rfind(character), var1.rfind(character));
+        }
+
+        const FixedString<OTHER_MAXIMUM_LENGTH> prefix{
+            view.substr(0, (std::min)(length, OTHER_MAXIMUM_LENGTH))};
+        ASSERT_EQ(view == std::string_view{prefix}, var1 == prefix);
+        ASSERT_EQ(view <=> std::string_view{prefix}, var1 <=> prefix);
+        ASSERT_EQ(std::string_view{prefix} <=> view, prefix <=> var1);
+        for (std::size_t index = 0; index < prefix.length(); index++)
+        {
+            // Also checks that characters are compared as unsigned chars
+            for (const char replacement : {'a', 'z', '\xF0'})
+            {
+                FixedString<OTHER_MAXIMUM_LENGTH> other = prefix;
+                other[index] = replacement;
+                ASSERT_EQ(view == std::string_view{other}, var1 == other);
+                ASSERT_EQ(view <=> std::string_view{other}, var1 <=> other);
+                ASSERT_EQ(view.compare(other) < 0, var1.compare(other) < 0);
+                ASSERT_EQ(view.compare(other) > 0, var1.compare(other) > 0);
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(FixedString, SearchAndComparisonMatchStringView)
+{
+    expect_same_search_and_comparison_as_string_view<5, 5>();
+    expect_same_search_and_comparison_as_string_view<15, 15>();
+    expect_same_search_and_comparison_as_string_view<15, 31>();
+    expect_same_search_and_comparison_as_string_view<31, 31>();
+    expect_same_search_and_comparison_as_string_view<32, 20>();
+    expect_same_search_and_comparison_as_string_view<63, 64>();
+    expect_same_search_and_comparison_as_string_view<64, 63>();
+    expect_same_search_and_comparison_as_string_view<100, 100>();
+    expect_same_search_and_comparison_as_string_view<100, 40>();
+}
+
 TEST(FixedString, Full)
 {
     constexpr auto VAL1 = []()
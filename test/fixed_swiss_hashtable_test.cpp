@@ -0,0 +1,380 @@
+#include "fixed_containers/fixed_swiss_hashtable.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+namespace fixed_containers::fixed_swiss_hashtable_detail
+{
+namespace
+{
+
+// The hash is the value itself, so keys can be built to land in a specific group with a specific
+// fingerprint and overflow bit. See `make_key()`.
+struct IdentityIntHash
+{
+    constexpr std::uint64_t operator()(const int& value) const
+    {
+        return static_cast<std::uint64_t>(value);
+    }
+};
+
+constexpr int make_key(int group, int overflow_bit_index, int fingerprint)
+{
+    return (group << (GroupControl::FINGERPRINT_BITS + GroupControl::OVERFLOW_BITS)) |
+           (overflow_bit_index << GroupControl::FINGERPRINT_BITS) | fingerprint;
+}
+
+// map ints to ints, with 2 groups of 15 slots
+using IntIntMap30 = FixedSwissHashtable<int, int, 30, 30, IdentityIntHash, std::equal_to<>>;
+using OIT = typename IntIntMap30::OpaqueIndexType;
+
+static_assert(IntIntMap30::NUM_GROUPS == 2);
+static_assert(IntIntMap30::INTERNAL_SLOT_COUNT == 30);
+
+static_assert(IsStructuralType<IntIntMap30>);
+
+#if defined(__clang__) && __clang_major__ >= 16
+static_assert(TriviallyCopyable<IntIntMap30>);
+#endif
+static_assert(TriviallyCopyAssignable<IntIntMap30>);
+static_assert(TriviallyMoveAssignable<IntIntMap30>);
+static_assert(StandardLayout<IntIntMap30>);
+
+template <typename MapType>
+constexpr OIT emplace_new(MapType& map, int key, int value)
+{
+    const OIT idx = map.opaque_index_of(key);
+    assert_or_abort(!map.exists(idx));
+    return map.emplace(idx, key, value);
+}
+
+}  // namespace
+
+TEST(GroupOperations, ControlBytes)
+{
+    static_assert(IsStructuralType<GroupControl>);
+    static_assert(StandardLayout<GroupControl>);
+    static_assert(TriviallyCopyable<GroupControl>);
+    static_assert(alignof(GroupControl) == 16);
+
+    static_assert(GroupControl::control_from_hash(0x00) == 0x80);
+    static_assert(GroupControl::control_from_hash(0x7F) == 0xFF);
+    static_assert(GroupControl::control_from_hash(0x1234) == (0x80 | 0x34));
+    // Bits 7 to 9 select the overflow bit
+    static_assert(GroupControl::overflow_bit_from_hash(0x7F) == 0b1);
+    static_assert(GroupControl::overflow_bit_from_hash(0x80) == 0b10);
+    static_assert(GroupControl::overflow_bit_from_hash(0x380) == 0b10000000);
+    static_assert(GroupControl::overflow_bit_from_hash(0x400) == 0b1);
+
+    static_assert(IntIntMap30::group_index_from_hash(make_key(0, 5, 100)) == 0);
+    static_assert(IntIntMap30::group_index_from_hash(make_key(1, 5, 100)) == 1);
+    static_assert(IntIntMap30::group_index_from_hash(make_key(2, 5, 100)) == 0);
+    static_assert(IntIntMap30::next_group_index(0) == 1);
+    static_assert(IntIntMap30::next_group_index(1) == 0);
+}
+
+TEST(GroupOperations, Match)
+{
+    constexpr auto MATCHES = []()
+    {
+        GroupControl group{};
+        group.control_bytes_[0] = 0x81;
+        group.control_bytes_[3] = 0x90;
+        group.control_bytes_[7] = 0x81;
+        group.control_bytes_[14] = 0x81;
+        // The overflow byte is never a match, even if it happens to look like one
+        group.mark_overflow(0x81);
+        return std::array<GroupControl::MaskType, 3>{
+            group.match(0x81), group.match(0x90), group.match_empty()};
+    }();
+    static_assert(MATCHES[0] == 0b100'0000'1000'0001);
+    static_assert(MATCHES[1] == 0b000'0000'0000'1000);
+    static_assert(MATCHES[2] == 0b011'1111'0111'0110);
+
+    // Same at runtime, which may be vectorized
+    GroupControl group{};
+    group.control_bytes_[0] = 0x81;
+    group.control_bytes_[3] = 0x90;
+    group.control_bytes_[7] = 0x81;
+    group.control_bytes_[14] = 0x81;
+    group.mark_overflow(0x81);
+    EXPECT_EQ(MATCHES[0], group.match(0x81));
+    EXPECT_EQ(MATCHES[1], group.match(0x90));
+    EXPECT_EQ(MATCHES[2], group.match_empty());
+
+    EXPECT_TRUE(group.has_overflowed(0x01));
+    EXPECT_TRUE(group.has_overflowed(0x80));
+    EXPECT_FALSE(group.has_overflowed(0x02));
+}
+
+TEST(MapOperations, EmplaceAndSearch)
+{
+    constexpr IntIntMap30 MAP = []()
+    {
+        IntIntMap30 map{};
+        emplace_new(map, make_key(1, 0, 3), 1);
+        emplace_new(map, make_key(0, 0, 3), 2);
+        emplace_new(map, make_key(1, 2, 3), 3);
+        return map;
+    }();
+
+    static_assert(MAP.size() == 3);
+    // Slots are filled in order within the home group
+    static_assert(MAP.opaque_index_of(make_key(1, 0, 3)).slot_index == 15);
+    static_assert(MAP.opaque_index_of(make_key(0, 0, 3)).slot_index == 0);
+    static_assert(MAP.opaque_index_of(make_key(1, 2, 3)).slot_index == 16);
+    static_assert(MAP.value(MAP.opaque_index_of(make_key(1, 2, 3))) == 3);
+
+    static_assert(!MAP.exists(MAP.opaque_index_of(make_key(1, 0, 4))));
+    static_assert(!MAP.exists(MAP.opaque_index_of(make_key(0, 0, 4))));
+
+    // Iteration is in slot order
+    static_assert(MAP.begin_index() == 0);
+    static_assert(MAP.key_at(MAP.begin_index()) == make_key(0, 0, 3));
+    static_assert(MAP.next_of(MAP.begin_index()) == 15);
+    static_assert(MAP.key_at(MAP.next_of(MAP.begin_index())) == make_key(1, 0, 3));
+    static_assert(MAP.next_of(16) == MAP.end_index());
+}
+
+TEST(MapOperations, Overflow)
+{
+    IntIntMap30 map{};
+
+    // 20 keys that want group 0. The last 5 spill into group 1.
+    for (int i = 0; i < 20; i++)
+    {
+        const OIT idx = emplace_new(map, make_key(0, i % 2, i), i);
+        EXPECT_EQ(i < 15 ? 0 : 1, idx.slot_index / GroupControl::SLOTS_PER_GROUP);
+    }
+
+    EXPECT_EQ(0, map.group_at(0).match_empty());
+    // Both overflow bits that were used are set, and only those
+    EXPECT_TRUE(map.group_at(0).has_overflowed(0b01));
+    EXPECT_TRUE(map.group_at(0).has_overflowed(0b10));
+    EXPECT_FALSE(map.group_at(0).has_overflowed(0b11111100));
+    EXPECT_FALSE(map.group_at(1).has_overflowed(0xFF));
+
+    for (int i = 0; i < 20; i++)
+    {
+        const OIT idx = map.opaque_index_of(make_key(0, i % 2, i));
+        ASSERT_TRUE(map.exists(idx));
+        EXPECT_EQ(i, map.value(idx));
+    }
+
+    // Misses that share an overflow bit have to look at group 1, the others stop at group 0
+    EXPECT_FALSE(map.exists(map.opaque_index_of(make_key(0, 1, 100))));
+    EXPECT_FALSE(map.exists(map.opaque_index_of(make_key(0, 5, 100))));
+
+    // Erasing from the full group leaves a hole that the next insertion reuses, and the keys
+    // that overflowed are still found
+    const OIT erased = map.opaque_index_of(make_key(0, 1, 3));
+    map.erase(erased);
+    EXPECT_FALSE(map.exists(map.opaque_index_of(make_key(0, 1, 3))));
+    for (int i = 15; i < 20; i++)
+    {
+        EXPECT_TRUE(map.exists(map.opaque_index_of(make_key(0, i % 2, i))));
+    }
+
+    const OIT reinserted = emplace_new(map, make_key(0, 4, 50), 50);
+    EXPECT_EQ(erased.slot_index, reinserted.slot_index);
+    EXPECT_EQ(20, map.size());
+}
+
+TEST(MapOperations, FullTable)
+{
+    constexpr IntIntMap30 MAP = []()
+    {
+        IntIntMap30 map{};
+        // Everything wants group 1, so group 0 fills up by wrapping around
+        for (int i = 0; i < 30; i++)
+        {
+            emplace_new(map, make_key(1, i % 8, i), i);
+        }
+        return map;
+    }();
+
+    static_assert(MAP.size() == 30);
+    static_assert(MAP.group_at(0).match_empty() == 0);
+    static_assert(MAP.group_at(1).match_empty() == 0);
+    static_assert(MAP.value(MAP.opaque_index_of(make_key(1, 29 % 8, 29))) == 29);
+    // Group 1 has overflowed on every overflow bit, so misses continue into group 0
+    static_assert(MAP.group_at(1).has_overflowed(0xFF));
+    static_assert(!MAP.group_at(0).has_overflowed(0xFF));
+    static_assert(!MAP.exists(MAP.opaque_index_of(make_key(1, 0, 100))));
+
+    IntIntMap30 map = MAP;
+    for (int i = 0; i < 30; i++)
+    {
+        EXPECT_EQ(i, map.value(map.opaque_index_of(make_key(1, i % 8, i))));
+    }
+
+    // Make room in group 1 and insert a key that wants group 0. Now both groups have overflowed
+    // on the same bit, and misses with that bit can only stop after visiting every group.
+    map.erase(map.opaque_index_of(make_key(1, 0, 0)));
+    const OIT idx = emplace_new(map, make_key(0, 0, 50), 50);
+    EXPECT_EQ(15, idx.slot_index);
+    EXPECT_TRUE(map.group_at(0).has_overflowed(0b1));
+    EXPECT_TRUE(map.group_at(1).has_overflowed(0b1));
+    EXPECT_FALSE(map.exists(map.opaque_index_of(make_key(0, 0, 100))));
+    EXPECT_FALSE(map.exists(map.opaque_index_of(make_key(1, 0, 100))));
+    EXPECT_EQ(50, map.value(map.opaque_index_of(make_key(0, 0, 50))));
+}
+
+TEST(MapOperations, Clear)
+{
+    IntIntMap30 map{};
+    for (int i = 0; i < 20; i++)
+    {
+        emplace_new(map, make_key(0, 0, i), i);
+    }
+    EXPECT_TRUE(map.group_at(0).has_overflowed(0b1));
+
+    map.clear();
+    EXPECT_EQ(0, map.size());
+    EXPECT_FALSE(map.group_at(0).has_overflowed(0xFF));
+    EXPECT_EQ(GroupControl::SLOTS_MASK, map.group_at(0).match_empty());
+    EXPECT_EQ(GroupControl::SLOTS_MASK, map.group_at(1).match_empty());
+    EXPECT_FALSE(map.exists(map.opaque_index_of(make_key(0, 0, 3))));
+}
+
+TEST(MapCornerCases, StaleOverflowRebuild)
+{
+    static_assert(IntIntMap30::STALE_OVERFLOW_LIMIT == 15);
+
+    IntIntMap30 map{};
+    for (int i = 0; i < 20; i++)
+    {
+        emplace_new(map, make_key(0, 0, i), i);
+    }
+    for (int i = 0; i < 15; i++)
+    {
+        map.erase(map.opaque_index_of(make_key(0, 0, i)));
+    }
+    // The keys that overflowed are still where they were, and group 0 still claims an overflow
+    EXPECT_TRUE(map.group_at(0).has_overflowed(0b1));
+    EXPECT_EQ(15, map.IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_);
+
+    // The next insertion rebuilds the control bytes, which moves the survivors to their home group
+    const OIT idx = emplace_new(map, make_key(1, 0, 100), 100);
+    EXPECT_EQ(0, map.IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_);
+    EXPECT_FALSE(map.group_at(0).has_overflowed(0xFF));
+    EXPECT_EQ(15, idx.slot_index);
+    for (int i = 15; i < 20; i++)
+    {
+        const OIT survivor = map.opaque_index_of(make_key(0, 0, i));
+        ASSERT_TRUE(map.exists(survivor));
+        EXPECT_EQ(0, survivor.slot_index / GroupControl::SLOTS_PER_GROUP);
+        EXPECT_EQ(i, map.value(survivor));
+    }
+
+    // The survivors were re-placed in slot order
+    EXPECT_EQ(make_key(0, 0, 15), map.key_at(map.begin_index()));
+    EXPECT_EQ(6, map.size());
+}
+
+TEST(MapCornerCases, RebuildSwapsEntriesBetweenGroups)
+{
+    // Group 0 ends up holding keys that want group 1, and group 1 keys that want group 0, so
+    // re-placing them in place has to swap them
+    IntIntMap30 map{};
+    for (int i = 0; i < 30; i++)
+    {
+        emplace_new(map, make_key(1, 0, i), i);
+    }
+    for (int i = 1; i < 15; i++)
+    {
+        map.erase(map.opaque_index_of(make_key(1, 0, i)));
+    }
+    for (int i = 0; i < 14; i++)
+    {
+        const OIT idx = emplace_new(map, make_key(0, 1, i), 100 + i);
+        EXPECT_EQ(1, idx.slot_index / GroupControl::SLOTS_PER_GROUP);
+    }
+    EXPECT_LT(map.IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_,
+              IntIntMap30::STALE_OVERFLOW_LIMIT);
+
+    map.rebuild_control_array();
+    EXPECT_EQ(30, map.size());
+    EXPECT_EQ(0, map.IMPLEMENTATION_DETAIL_DO_NOT_USE_stale_overflow_count_);
+
+    // 16 keys want group 1, so one of them is pushed into group 0. None want to go past group 0.
+    EXPECT_TRUE(map.group_at(1).has_overflowed(0b1));
+    EXPECT_FALSE(map.group_at(0).has_overflowed(0xFF));
+    for (int i = 0; i < 14; i++)
+    {
+        const OIT idx = map.opaque_index_of(make_key(0, 1, i));
+        ASSERT_TRUE(map.exists(idx));
+        EXPECT_EQ(0, idx.slot_index / GroupControl::SLOTS_PER_GROUP);
+        EXPECT_EQ(100 + i, map.value(idx));
+    }
+    for (int i : {0, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29})
+    {
+        const OIT idx = map.opaque_index_of(make_key(1, 0, i));
+        ASSERT_TRUE(map.exists(idx));
+        EXPECT_EQ(i, map.value(idx));
+    }
+
+    std::size_t iterated_count = 0;
+    for (auto slot_index = map.begin_index(); slot_index != map.end_index();
+         slot_index = map.next_of(slot_index))
+    {
+        iterated_count++;
+    }
+    EXPECT_EQ(30, iterated_count);
+}
+
+TEST(MapCornerCases, EraseHeavyChurn)
+{
+    // Keep a sliding window of keys, so every insertion is a new key. Compare against a reference.
+    using IntIntMap100 =
+        FixedSwissHashtable<int, int, 100, 110, std::hash<int>, std::equal_to<>>;
+    IntIntMap100 map{};
+    std::unordered_map<int, int> reference{};
+
+    std::uint32_t state = 12345;
+    const auto next_key = [&state]()
+    {
+        state = (state * 1103515245U) + 12345U;
+        return static_cast<int>(state >> 8U);
+    };
+
+    for (int round = 0; round < 5000; round++)
+    {
+        if (reference.size() < 100)
+        {
+            const int key = next_key();
+            const auto idx = map.opaque_index_of(key);
+            ASSERT_EQ(reference.contains(key), map.exists(idx));
+            if (!map.exists(idx))
+            {
+                map.emplace(idx, key, round);
+                reference.emplace(key, round);
+            }
+        }
+        if (reference.size() == 100 || round % 3 == 0)
+        {
+            const int key = reference.begin()->first;
+            const auto idx = map.opaque_index_of(key);
+            ASSERT_TRUE(map.exists(idx));
+            map.erase(idx);
+            reference.erase(key);
+        }
+    }
+
+    ASSERT_EQ(reference.size(), map.size());
+    for (const auto& [key, value] : reference)
+    {
+        const auto idx = map.opaque_index_of(key);
+        ASSERT_TRUE(map.exists(idx));
+        EXPECT_EQ(value, map.value(idx));
+    }
+}
+
+}  // namespace fixed_containers::fixed_swiss_hashtable_detail
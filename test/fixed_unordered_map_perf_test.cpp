@@ -0,0 +1,317 @@
+#include "benchmark_utils.hpp"
+
+#include "fixed_containers/fixed_flat_hash_map.hpp"
+#include "fixed_containers/fixed_flat_hash_set.hpp"
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/fixed_unordered_set.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace fixed_containers
+{
+namespace
+{
+using benchmark_utils::PayloadHash;
+
+template <typename T, std::size_t /*CAPACITY*/>
+using StdUnorderedMap = std::unordered_map<std::uint32_t, T, wyhash::hash<std::uint32_t>>;
+template <typename T, std::size_t CAPACITY>
+using FixedUnorderedMapAlias = FixedUnorderedMap<std::uint32_t, T, CAPACITY>;
+template <typename T, std::size_t CAPACITY, typename BucketIndexing>
+using FixedUnorderedMapWithBucketIndexing =
+    FixedUnorderedMap<std::uint32_t,
+                      T,
+                      CAPACITY,
+                      wyhash::hash<std::uint32_t>,
+                      std::equal_to<std::uint32_t>,
+                      fixed_robinhood_hashtable_detail::default_bucket_count(CAPACITY),
+                      customize::MapAbortChecking<std::uint32_t, T, CAPACITY>,
+                      BucketIndexing>;
+template <typename T, std::size_t CAPACITY>
+using PowerOfTwoFixedUnorderedMap =
+    FixedUnorderedMapWithBucketIndexing<T,
+                                        CAPACITY,
+                                        fixed_robinhood_hashtable_detail::PowerOfTwoBucketIndexing>;
+template <typename T, std::size_t CAPACITY>
+using FastRangeFixedUnorderedMap =
+    FixedUnorderedMapWithBucketIndexing<T,
+                                        CAPACITY,
+                                        fixed_robinhood_hashtable_detail::FastRangeBucketIndexing>;
+template <typename T, std::size_t CAPACITY>
+using DenseFixedUnorderedMap =
+    FixedUnorderedMap<std::uint32_t,
+                      T,
+                      CAPACITY,
+                      wyhash::hash<std::uint32_t>,
+                      std::equal_to<std::uint32_t>,
+                      fixed_robinhood_hashtable_detail::default_bucket_count(CAPACITY),
+                      customize::MapAbortChecking<std::uint32_t, T, CAPACITY>,
+                      fixed_robinhood_hashtable_detail::ModuloBucketIndexing,
+                      fixed_robinhood_hashtable_detail::DenseValueStorage>;
+template <typename T, std::size_t CAPACITY>
+using FixedFlatHashMapAlias = FixedFlatHashMap<std::uint32_t, T, CAPACITY>;
+
+template <typename T, std::size_t /*CAPACITY*/>
+using StdUnorderedSet = std::unordered_set<T, PayloadHash>;
+template <typename T, std::size_t CAPACITY>
+using FixedUnorderedSetAlias = FixedUnorderedSet<T, CAPACITY, PayloadHash>;
+template <typename T, std::size_t CAPACITY>
+using FixedFlatHashSetAlias = FixedFlatHashSet<T, CAPACITY, PayloadHash>;
+
+// Probing at 100% bucket occupancy, where the probe sequences are the longest. Compares the
+// scalar probe against the default (possibly vectorized) one, for hits and for misses.
+template <std::size_t CAPACITY>
+using FullyLoadedHashtable = fixed_robinhood_hashtable_detail::FixedRobinhoodHashtable<
+    std::uint32_t,
+    std::uint32_t,
+    CAPACITY,
+    CAPACITY,
+    wyhash::hash<std::uint32_t>,
+    std::equal_to<std::uint32_t>>;
+
+enum class ProbeMode
+{
+    SCALAR,
+    DEFAULT,
+};
+
+template <std::size_t CAPACITY, ProbeMode PROBE_MODE, bool HIT>
+void benchmark_probe(benchmark::State& state)
+{
+    using Table = FullyLoadedHashtable<CAPACITY>;
+    auto table = benchmark_utils::make_heap_allocated<Table>();
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        const auto key = benchmark_utils::key_at<std::uint32_t>(i);
+        table->emplace(table->opaque_index_of(key), key, key);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        // Keys past CAPACITY were never inserted
+        const auto key = benchmark_utils::key_at<std::uint32_t>(
+            benchmark_utils::scattered_index(i++, CAPACITY) + (HIT ? 0 : CAPACITY));
+        if constexpr (PROBE_MODE == ProbeMode::SCALAR)
+        {
+            const std::uint64_t key_hash = table->hash(key);
+            auto index = table->probe_scalar(
+                key,
+                Table::bucket_index_from_hash(key_hash),
+                fixed_robinhood_hashtable_detail::Bucket::dist_and_fingerprint_from_hash(
+                    key_hash));
+            benchmark::DoNotOptimize(index);
+        }
+        else
+        {
+            auto index = table->opaque_index_of(key);
+            benchmark::DoNotOptimize(index);
+        }
+    }
+}
+
+template <std::size_t CAPACITY>
+void register_probe_benchmarks()
+{
+    const auto name = [](std::string_view operation)
+    {
+        return benchmark_utils::benchmark_name<std::uint32_t, CAPACITY>(
+            operation, "FixedRobinhoodHashtable[full]");
+    };
+    benchmark::RegisterBenchmark(name("probe_hit_scalar").c_str(),
+                                 benchmark_probe<CAPACITY, ProbeMode::SCALAR, true>);
+    benchmark::RegisterBenchmark(name("probe_hit").c_str(),
+                                 benchmark_probe<CAPACITY, ProbeMode::DEFAULT, true>);
+    benchmark::RegisterBenchmark(name("probe_miss_scalar").c_str(),
+                                 benchmark_probe<CAPACITY, ProbeMode::SCALAR, false>);
+    benchmark::RegisterBenchmark(name("probe_miss").c_str(),
+                                 benchmark_probe<CAPACITY, ProbeMode::DEFAULT, false>);
+}
+
+bool register_all_probe_benchmarks()
+{
+    register_probe_benchmarks<256>();
+    register_probe_benchmarks<4096>();
+    register_probe_benchmarks<65536>();
+    return true;
+}
+
+// Lookups in tables filled up to the maximum load factor of each tuning, reporting the mean probe
+// length and the number of `key_equal` calls per lookup along with the time. The calls stand in for
+// the cost of comparing expensive keys.
+struct CountingKeyEqual
+{
+    static inline std::size_t call_count = 0;
+
+    bool operator()(std::uint32_t lhs, std::uint32_t rhs) const
+    {
+        call_count++;
+        return lhs == rhs;
+    }
+};
+
+template <std::size_t CAPACITY, typename Tuning>
+using TunedHashtable = fixed_robinhood_hashtable_detail::FixedRobinhoodHashtable<
+    std::uint32_t,
+    std::uint32_t,
+    CAPACITY,
+    fixed_robinhood_hashtable_detail::resolve_bucket_count<Tuning>(
+        fixed_robinhood_hashtable_detail::AUTO_BUCKET_COUNT, CAPACITY),
+    wyhash::hash<std::uint32_t>,
+    CountingKeyEqual,
+    fixed_robinhood_hashtable_detail::ModuloBucketIndexing,
+    fixed_robinhood_hashtable_detail::LinkedListValueStorage,
+    Tuning>;
+
+template <std::size_t CAPACITY, typename Tuning, bool HIT>
+void benchmark_tuned_lookup(benchmark::State& state)
+{
+    using Table = TunedHashtable<CAPACITY, Tuning>;
+    auto table = benchmark_utils::make_heap_allocated<Table>();
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        const auto key = benchmark_utils::key_at<std::uint32_t>(i);
+        table->emplace(table->opaque_index_of(key), key, key);
+    }
+    const auto key_for = [](std::size_t i)
+    {
+        // Keys past CAPACITY were never inserted
+        return benchmark_utils::key_at<std::uint32_t>(i + (HIT ? 0 : CAPACITY));
+    };
+
+    // The probe length of a lookup is the distance of the bucket where it stops
+    std::size_t total_probe_length = 0;
+    for (std::size_t i = 0; i < CAPACITY; i++)
+    {
+        const auto index = table->opaque_index_of(key_for(i));
+        total_probe_length +=
+            HIT ? table->bucket_at(index.bucket_index).dist()
+                : index.dist_and_fingerprint >> Table::BucketType::FINGERPRINT_BITS;
+    }
+
+    CountingKeyEqual::call_count = 0;
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        auto index =
+            table->opaque_index_of(key_for(benchmark_utils::scattered_index(i++, CAPACITY)));
+        benchmark::DoNotOptimize(index);
+    }
+
+    state.counters["probe_length"] =
+        static_cast<double>(total_probe_length) / static_cast<double>(CAPACITY);
+    state.counters["key_equal_calls"] = benchmark::Counter(
+        static_cast<double>(CountingKeyEqual::call_count), benchmark::Counter::kAvgIterations);
+    state.counters["bytes"] = static_cast<double>(sizeof(Table));
+}
+
+template <std::size_t CAPACITY, std::size_t BUCKET_COUNT_PERCENT, std::uint32_t FINGERPRINT_BITS>
+void register_tuned_lookup_benchmarks()
+{
+    using Tuning =
+        fixed_robinhood_hashtable_detail::HashtableTuning<BUCKET_COUNT_PERCENT, FINGERPRINT_BITS>;
+    const auto name = [](std::string_view operation)
+    {
+        return benchmark_utils::benchmark_name<std::uint32_t, CAPACITY>(
+            operation,
+            "FixedRobinhoodHashtable[" + std::to_string(BUCKET_COUNT_PERCENT) + "% buckets," +
+                std::to_string(FINGERPRINT_BITS) + "-bit fingerprints]");
+    };
+    benchmark::RegisterBenchmark(name("tuned_lookup").c_str(),
+                                 benchmark_tuned_lookup<CAPACITY, Tuning, true>);
+    benchmark::RegisterBenchmark(name("tuned_lookup_miss").c_str(),
+                                 benchmark_tuned_lookup<CAPACITY, Tuning, false>);
+}
+
+template <std::size_t CAPACITY>
+void register_tuned_lookup_benchmarks()
+{
+    register_tuned_lookup_benchmarks<CAPACITY, 130, 8>();
+    register_tuned_lookup_benchmarks<CAPACITY, 110, 8>();
+    register_tuned_lookup_benchmarks<CAPACITY, 130, 16>();
+    register_tuned_lookup_benchmarks<CAPACITY, 110, 16>();
+}
+
+bool register_all_tuned_lookup_benchmarks()
+{
+    register_tuned_lookup_benchmarks<4096>();
+    register_tuned_lookup_benchmarks<65536>();
+    return true;
+}
+
+// Clearing a large table that holds only a few entries, e.g. scratch space reused across
+// requests, must not pay for a pass over every bucket. Each iteration inserts `state.range(0)`
+// entries and clears them.
+template <typename ContainerType>
+void benchmark_sparse_clear(benchmark::State& state)
+{
+    using K = typename ContainerType::key_type;
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto instance = benchmark_utils::make_heap_allocated<ContainerType>();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            benchmark_utils::insert_key(*instance, benchmark_utils::key_at<K>(i));
+        }
+        instance->clear();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <template <typename, std::size_t> typename ContainerTemplate>
+void register_sparse_clear_benchmark(std::string_view container_name)
+{
+    static constexpr std::size_t CAPACITY = 65536;
+    benchmark::RegisterBenchmark(
+        benchmark_utils::benchmark_name<std::uint32_t, CAPACITY>("sparse_clear", container_name)
+            .c_str(),
+        benchmark_sparse_clear<ContainerTemplate<std::uint32_t, CAPACITY>>)
+        ->Arg(1)
+        ->Arg(16)
+        ->Arg(256)
+        ->Arg(4096)
+        ->Arg(CAPACITY);
+}
+
+bool register_all_sparse_clear_benchmarks()
+{
+    register_sparse_clear_benchmark<StdUnorderedMap>("std::unordered_map");
+    register_sparse_clear_benchmark<FixedUnorderedMapAlias>("FixedUnorderedMap");
+    register_sparse_clear_benchmark<DenseFixedUnorderedMap>("FixedUnorderedMap[DenseValueStorage]");
+    return true;
+}
+
+[[maybe_unused]] const bool REGISTERED =
+    benchmark_utils::register_associative_benchmarks<StdUnorderedMap>("std::unordered_map") &&
+    benchmark_utils::register_associative_benchmarks<FixedUnorderedMapAlias>(
+        "FixedUnorderedMap") &&
+    benchmark_utils::register_associative_benchmarks<PowerOfTwoFixedUnorderedMap>(
+        "FixedUnorderedMap[PowerOfTwoBucketIndexing]") &&
+    benchmark_utils::register_associative_benchmarks<FastRangeFixedUnorderedMap>(
+        "FixedUnorderedMap[FastRangeBucketIndexing]") &&
+    benchmark_utils::register_associative_benchmarks<DenseFixedUnorderedMap>(
+        "FixedUnorderedMap[DenseValueStorage]") &&
+    benchmark_utils::register_associative_benchmarks<FixedFlatHashMapAlias>("FixedFlatHashMap") &&
+    benchmark_utils::register_associative_benchmarks<StdUnorderedSet>("std::unordered_set") &&
+    benchmark_utils::register_associative_benchmarks<FixedUnorderedSetAlias>(
+        "FixedUnorderedSet") &&
+    benchmark_utils::register_associative_benchmarks<FixedFlatHashSetAlias>("FixedFlatHashSet") &&
+    register_all_probe_benchmarks() && register_all_tuned_lookup_benchmarks() &&
+    register_all_sparse_clear_benchmarks();
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -9,6 +9,7 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/fixed_map_adapter.hpp"
+#include "fixed_containers/fixed_string.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
 
@@ -20,6 +21,7 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -1218,6 +1220,92 @@ TEST(FixedUnorderedMap, Contains)
     static_assert(VAL1.at(4) == 40);
 }
 
+TEST(FixedUnorderedMap, FindBatch)
+{
+    {
+        constexpr bool RESULT = []()
+        {
+            FixedUnorderedMap<int, int, 10> var{{2, 20}, {4, 40}};
+            const std::array<int, 4> keys{4, 1, 2, 4};
+            std::array<FixedUnorderedMap<int, int, 10>::iterator, 4> out{};
+            var.find_batch(keys, out);
+            out[0]->second = 41;
+            return out[1] == var.end() && out[2]->second == 20 && out[3]->second == 41 &&
+                   var.at(4) == 41;
+        }();
+        static_assert(RESULT);
+    }
+
+    // More keys than a single batch, half of them missing
+    FixedUnorderedMap<int, int, 100> var{};
+    for (int i = 0; i < 100; i += 2)
+    {
+        var[i] = i * 10;
+    }
+    std::array<int, 70> keys{};
+    std::iota(keys.begin(), keys.end(), 30);
+    std::array<FixedUnorderedMap<int, int, 100>::const_iterator, 70> out{};
+    std::as_const(var).find_batch(keys, out);
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        const auto expected = std::as_const(var).find(keys.at(i));
+        EXPECT_EQ(expected, out.at(i));
+        EXPECT_EQ(keys.at(i) % 2 == 0 && keys.at(i) < 100, out.at(i) != var.cend());
+    }
+}
+
+TEST(FixedUnorderedMap, ContainsBatch)
+{
+    constexpr std::array<bool, 4> RESULT = []()
+    {
+        const FixedUnorderedMap<int, int, 10> var{{2, 20}, {4, 40}};
+        const std::array<int, 4> keys{1, 2, 3, 4};
+        std::array<bool, 4> out{};
+        var.contains_batch(keys, out);
+        return out;
+    }();
+    static_assert(RESULT == std::array<bool, 4>{false, true, false, true});
+}
+
+namespace
+{
+template <typename MapType>
+concept HasTransparentContains = requires(const MapType& map, std::string_view key) {
+    map.template contains<std::string_view>(key);
+};
+}  // namespace
+
+TEST(FixedUnorderedMap, TransparentLookup)
+{
+    using TransparentMap =
+        FixedUnorderedMap<FixedString<16>, int, 10, wyhash::hash<FixedString<16>>, std::equal_to<>>;
+
+    constexpr TransparentMap VAL1{{"one", 1}, {"three", 3}};
+    static_assert(VAL1.contains(std::string_view{"one"}));
+    static_assert(VAL1.contains("three"));
+    static_assert(!VAL1.contains("two"));
+    static_assert(VAL1.count(std::string_view{"three"}) == 1);
+    static_assert(VAL1.find("three")->second == 3);
+    static_assert(VAL1.find(std::string_view{"two"}) == VAL1.cend());
+
+    TransparentMap var{{"one", 1}, {"three", 3}};
+    var.find(std::string_view{"one"})->second = 10;
+    EXPECT_EQ(10, var.at("one"));
+    EXPECT_EQ(0, var.erase(std::string_view{"two"}));
+    EXPECT_EQ(1, var.erase(std::string_view{"one"}));
+    EXPECT_EQ(1, var.erase("three"));
+    EXPECT_TRUE(var.empty());
+
+    // Iterators still pick the non-transparent overload
+    var["four"] = 4;
+    var.erase(var.begin());
+    EXPECT_TRUE(var.empty());
+
+    // Without a transparent hash and equality, only `K` is accepted
+    static_assert(HasTransparentContains<TransparentMap>);
+    static_assert(!HasTransparentContains<FixedUnorderedMap<FixedString<16>, int, 10>>);
+}
+
 // TEST(FixedUnorderedMap, Contains_TransparentComparator)
 // {
 //     constexpr FixedUnorderedMap<MockAComparableToB, int, 5, std::less<>> var{
@@ -1248,6 +1336,205 @@ TEST(FixedUnorderedMap, Count)
 //     static_assert(var.count(b) == 1);
 // }
 
+TEST(FixedUnorderedMap, BucketIndexing)
+{
+    using PowerOfTwoMap =
+        FixedUnorderedMap<int,
+                          int,
+                          10,
+                          wyhash::hash<int>,
+                          std::equal_to<int>,
+                          fixed_robinhood_hashtable_detail::default_bucket_count(10),
+                          customize::MapAbortChecking<int, int, 10>,
+                          fixed_robinhood_hashtable_detail::PowerOfTwoBucketIndexing>;
+    using FastRangeMap =
+        FixedUnorderedMap<int,
+                          int,
+                          10,
+                          wyhash::hash<int>,
+                          std::equal_to<int>,
+                          fixed_robinhood_hashtable_detail::default_bucket_count(10),
+                          customize::MapAbortChecking<int, int, 10>,
+                          fixed_robinhood_hashtable_detail::FastRangeBucketIndexing>;
+
+    static_assert(TriviallyCopyable<PowerOfTwoMap>);
+    static_assert(TriviallyCopyable<FastRangeMap>);
+
+    const auto exercise = []<typename MapType>()
+    {
+        MapType var{};
+        for (int i = 0; i < 10; i++)
+        {
+            var.try_emplace(i * 7, i);
+        }
+        var.erase(21);
+        var.erase(49);
+        var[21] = 100;
+        return var;
+    };
+
+    {
+        constexpr PowerOfTwoMap VAL1 = exercise.template operator()<PowerOfTwoMap>();
+        static_assert(VAL1.size() == 9);
+        static_assert(VAL1.at(0) == 0);
+        static_assert(VAL1.at(21) == 100);
+        static_assert(!VAL1.contains(49));
+        static_assert(VAL1.at(63) == 9);
+    }
+    {
+        constexpr FastRangeMap VAL1 = exercise.template operator()<FastRangeMap>();
+        static_assert(VAL1.size() == 9);
+        static_assert(VAL1.at(0) == 0);
+        static_assert(VAL1.at(21) == 100);
+        static_assert(!VAL1.contains(49));
+        static_assert(VAL1.at(63) == 9);
+    }
+
+    // Maps with different bucket indexing are still comparable
+    constexpr FixedUnorderedMap<int, int, 10> VAL2{{1, 10}, {4, 40}};
+    constexpr PowerOfTwoMap VAL3{{4, 40}, {1, 10}};
+    static_assert(VAL2 == VAL3);
+}
+
+TEST(FixedUnorderedMap, DenseValueStorage)
+{
+    using DenseMap = FixedUnorderedMap<int,
+                                       int,
+                                       10,
+                                       wyhash::hash<int>,
+                                       std::equal_to<int>,
+                                       fixed_robinhood_hashtable_detail::default_bucket_count(10),
+                                       customize::MapAbortChecking<int, int, 10>,
+                                       fixed_robinhood_hashtable_detail::ModuloBucketIndexing,
+                                       fixed_robinhood_hashtable_detail::DenseValueStorage>;
+
+    static_assert(TriviallyCopyable<DenseMap>);
+    static_assert(sizeof(DenseMap) < sizeof(FixedUnorderedMap<int, int, 10>));
+
+    {
+        constexpr DenseMap VAL1 = []()
+        {
+            DenseMap var{};
+            for (int i = 0; i < 10; i++)
+            {
+                var.try_emplace(i * 7, i);
+            }
+            var.erase(21);
+            var.erase(49);
+            var[21] = 100;
+            return var;
+        }();
+        static_assert(VAL1.size() == 9);
+        static_assert(VAL1.at(0) == 0);
+        static_assert(VAL1.at(21) == 100);
+        static_assert(!VAL1.contains(49));
+        static_assert(VAL1.at(63) == 9);
+    }
+
+    // Maps with different value storage are still comparable
+    {
+        constexpr FixedUnorderedMap<int, int, 10> VAL2{{1, 10}, {4, 40}};
+        constexpr DenseMap VAL3{{4, 40}, {1, 10}};
+        static_assert(VAL2 == VAL3);
+    }
+
+    // Erasing while iterating visits every value, even though erasures move values around
+    {
+        FixedUnorderedMap<int,
+                          std::string,
+                          20,
+                          wyhash::hash<int>,
+                          std::equal_to<int>,
+                          fixed_robinhood_hashtable_detail::default_bucket_count(20),
+                          customize::MapAbortChecking<int, std::string, 20>,
+                          fixed_robinhood_hashtable_detail::ModuloBucketIndexing,
+                          fixed_robinhood_hashtable_detail::DenseValueStorage>
+            var{};
+        for (int i = 0; i < 20; i++)
+        {
+            var.try_emplace(i, std::to_string(i));
+        }
+
+        int visited = 0;
+        for (auto it = var.begin(); it != var.end();)
+        {
+            visited++;
+            it = it->first % 3 == 0 ? var.erase(it) : std::next(it);
+        }
+        EXPECT_EQ(20, visited);
+        EXPECT_EQ(13, var.size());
+        for (int i = 0; i < 20; i++)
+        {
+            EXPECT_EQ(i % 3 != 0, var.contains(i));
+        }
+        EXPECT_EQ("19", var.at(19));
+
+        var.erase(std::next(var.begin(), 2), std::next(var.begin(), 5));
+        EXPECT_EQ(10, var.size());
+        EXPECT_EQ(10, std::distance(var.begin(), var.end()));
+        for (const auto& [key, value] : var)
+        {
+            EXPECT_EQ(std::to_string(key), value);
+        }
+
+        var.clear();
+        EXPECT_TRUE(var.empty());
+        EXPECT_EQ(var.begin(), var.end());
+    }
+}
+
+TEST(FixedUnorderedMap, HashtableTuning)
+{
+    // 1.1x buckets and 16-bit fingerprints
+    using TunedMap =
+        FixedUnorderedMap<int,
+                          int,
+                          10,
+                          wyhash::hash<int>,
+                          std::equal_to<int>,
+                          fixed_robinhood_hashtable_detail::AUTO_BUCKET_COUNT,
+                          customize::MapAbortChecking<int, int, 10>,
+                          fixed_robinhood_hashtable_detail::ModuloBucketIndexing,
+                          fixed_robinhood_hashtable_detail::LinkedListValueStorage,
+                          fixed_robinhood_hashtable_detail::HashtableTuning<110, 16>>;
+
+    static_assert(TriviallyCopyable<TunedMap>);
+    static_assert(sizeof(TunedMap) < sizeof(FixedUnorderedMap<int, int, 10>));
+
+    // The default bucket count is spelled out, so explicitly passing it names the same type
+    static_assert(std::is_same_v<
+                  FixedUnorderedMap<int, int, 10>,
+                  FixedUnorderedMap<int,
+                                    int,
+                                    10,
+                                    wyhash::hash<int>,
+                                    std::equal_to<int>,
+                                    fixed_robinhood_hashtable_detail::default_bucket_count(10)>>);
+
+    constexpr TunedMap VAL1 = []()
+    {
+        TunedMap var{};
+        for (int i = 0; i < 10; i++)
+        {
+            var.try_emplace(i * 7, i);
+        }
+        var.erase(21);
+        var.erase(49);
+        var[21] = 100;
+        return var;
+    }();
+    static_assert(VAL1.size() == 9);
+    static_assert(VAL1.at(0) == 0);
+    static_assert(VAL1.at(21) == 100);
+    static_assert(!VAL1.contains(49));
+    static_assert(VAL1.at(63) == 9);
+
+    // Maps with different tunings are still comparable
+    constexpr FixedUnorderedMap<int, int, 10> VAL2{{1, 10}, {4, 40}};
+    constexpr TunedMap VAL3{{4, 40}, {1, 10}};
+    static_assert(VAL2 == VAL3);
+}
+
 TEST(FixedUnorderedMap, Equality)
 {
     {
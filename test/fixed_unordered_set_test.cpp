@@ -6,6 +6,7 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/fixed_set_adapter.hpp"
+#include "fixed_containers/fixed_string.hpp"
 #include "fixed_containers/max_size.hpp"
 
 #include <gtest/gtest.h>
@@ -15,6 +16,7 @@
 #include <cmath>
 #include <cstddef>
 #include <iterator>
+#include <numeric>
 #include <ranges>
 #include <string>
 #include <type_traits>
@@ -107,6 +109,57 @@ TEST(FixedUnorderedSet, Contains)
     static_assert(VAL1.contains(4));
 }
 
+TEST(FixedUnorderedSet, ContainsBatch)
+{
+    constexpr std::array<bool, 4> RESULT = []()
+    {
+        const FixedUnorderedSet<int, 10> var{2, 4};
+        const std::array<int, 4> keys{1, 2, 3, 4};
+        std::array<bool, 4> out{};
+        var.contains_batch(keys, out);
+        return out;
+    }();
+    static_assert(RESULT == std::array<bool, 4>{false, true, false, true});
+
+    // More keys than a single batch, half of them missing
+    FixedUnorderedSet<int, 100> var{};
+    for (int i = 0; i < 100; i += 2)
+    {
+        var.insert(i);
+    }
+    std::array<int, 70> keys{};
+    std::iota(keys.begin(), keys.end(), 30);
+    std::array<bool, 70> contained{};
+    var.contains_batch(keys, contained);
+    std::array<FixedUnorderedSet<int, 100>::const_iterator, 70> found{};
+    var.find_batch(keys, found);
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(var.contains(keys.at(i)), contained.at(i));
+        EXPECT_EQ(var.find(keys.at(i)), found.at(i));
+    }
+}
+
+TEST(FixedUnorderedSet, TransparentLookup)
+{
+    using TransparentSet =
+        FixedUnorderedSet<FixedString<16>, 10, wyhash::hash<FixedString<16>>, std::equal_to<>>;
+
+    constexpr TransparentSet VAL1{"one", "three"};
+    static_assert(VAL1.contains(std::string_view{"one"}));
+    static_assert(VAL1.contains("three"));
+    static_assert(!VAL1.contains("two"));
+    static_assert(VAL1.count(std::string_view{"three"}) == 1);
+    static_assert(*VAL1.find("three") == "three");
+    static_assert(VAL1.find(std::string_view{"two"}) == VAL1.cend());
+
+    TransparentSet var{"one", "three"};
+    EXPECT_EQ(0, var.erase(std::string_view{"two"}));
+    EXPECT_EQ(1, var.erase(std::string_view{"one"}));
+    EXPECT_EQ(1, var.erase("three"));
+    EXPECT_TRUE(var.empty());
+}
+
 // TEST(FixedUnorderedSet, Contains_TransparentComparator)
 // {
 //     constexpr FixedUnorderedSet<MockAComparableToB, 5, std::less<>> var{
@@ -586,6 +639,101 @@ TEST(FixedUnorderedSet, IteratorInvalidation)
     }
 }
 
+TEST(FixedUnorderedSet, BucketIndexing)
+{
+    using PowerOfTwoSet =
+        FixedUnorderedSet<int,
+                          10,
+                          wyhash::hash<int>,
+                          std::equal_to<int>,
+                          fixed_robinhood_hashtable_detail::default_bucket_count(10),
+                          customize::SetAbortChecking<int, 10>,
+                          fixed_robinhood_hashtable_detail::PowerOfTwoBucketIndexing>;
+    using FastRangeSet =
+        FixedUnorderedSet<int,
+                          10,
+                          wyhash::hash<int>,
+                          std::equal_to<int>,
+                          fixed_robinhood_hashtable_detail::default_bucket_count(10),
+                          customize::SetAbortChecking<int, 10>,
+                          fixed_robinhood_hashtable_detail::FastRangeBucketIndexing>;
+
+    constexpr PowerOfTwoSet VAL1{1, 4, 9, 16};
+    static_assert(VAL1.size() == 4);
+    static_assert(VAL1.contains(9));
+    static_assert(!VAL1.contains(2));
+
+    constexpr FastRangeSet VAL2{1, 4, 9, 16};
+    static_assert(VAL2.size() == 4);
+    static_assert(VAL2.contains(16));
+    static_assert(!VAL2.contains(3));
+
+    static_assert(VAL1 == VAL2);
+}
+
+TEST(FixedUnorderedSet, DenseValueStorage)
+{
+    using DenseSet = FixedUnorderedSet<int,
+                                       10,
+                                       wyhash::hash<int>,
+                                       std::equal_to<int>,
+                                       fixed_robinhood_hashtable_detail::default_bucket_count(10),
+                                       customize::SetAbortChecking<int, 10>,
+                                       fixed_robinhood_hashtable_detail::ModuloBucketIndexing,
+                                       fixed_robinhood_hashtable_detail::DenseValueStorage>;
+
+    static_assert(TriviallyCopyable<DenseSet>);
+    static_assert(sizeof(DenseSet) < sizeof(FixedUnorderedSet<int, 10>));
+
+    constexpr DenseSet VAL1 = []()
+    {
+        DenseSet var{1, 4, 9, 16, 25};
+        var.erase(4);
+        var.erase(25);
+        var.insert(36);
+        return var;
+    }();
+    static_assert(VAL1.size() == 4);
+    static_assert(VAL1.contains(9));
+    static_assert(VAL1.contains(16));
+    static_assert(!VAL1.contains(4));
+    static_assert(VAL1 == FixedUnorderedSet<int, 10>{1, 9, 16, 36});
+
+    DenseSet var{1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(3, erase_if(var, [](int key) { return key % 2 == 0; }));
+    EXPECT_EQ((FixedUnorderedSet<int, 10>{1, 3, 5}), var);
+}
+
+TEST(FixedUnorderedSet, HashtableTuning)
+{
+    // 1.1x buckets and 16-bit fingerprints
+    using TunedSet = FixedUnorderedSet<int,
+                                       10,
+                                       wyhash::hash<int>,
+                                       std::equal_to<int>,
+                                       fixed_robinhood_hashtable_detail::AUTO_BUCKET_COUNT,
+                                       customize::SetAbortChecking<int, 10>,
+                                       fixed_robinhood_hashtable_detail::ModuloBucketIndexing,
+                                       fixed_robinhood_hashtable_detail::LinkedListValueStorage,
+                                       fixed_robinhood_hashtable_detail::HashtableTuning<110, 16>>;
+
+    static_assert(TriviallyCopyable<TunedSet>);
+    static_assert(sizeof(TunedSet) < sizeof(FixedUnorderedSet<int, 10>));
+
+    constexpr TunedSet VAL1 = []()
+    {
+        TunedSet var{1, 4, 9, 16, 25};
+        var.erase(4);
+        var.erase(25);
+        var.insert(36);
+        return var;
+    }();
+    static_assert(VAL1.size() == 4);
+    static_assert(VAL1.contains(9));
+    static_assert(!VAL1.contains(4));
+    static_assert(VAL1 == FixedUnorderedSet<int, 10>{1, 9, 16, 36});
+}
+
 TEST(FixedUnorderedSet, Equality)
 {
     constexpr FixedUnorderedSet<int, 10> VAL1{{1, 4}};
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <ranges>
@@ -64,6 +65,12 @@ static_assert(std::is_same_v<int, typename ConstVecType::iterator::value_type>);
 static_assert(std::is_same_v<int, typename ConstVecType::const_iterator::value_type>);
 }  // namespace trivially_copyable_vector
 
+// The size is stored in the smallest unsigned integral type that can hold the maximum size
+static_assert(sizeof(FixedVector<char, 255>) == sizeof(std::uint8_t) + 255);
+static_assert(sizeof(FixedVector<char, 256>) == sizeof(std::uint16_t) + 256);
+static_assert(sizeof(FixedVector<std::uint16_t, 70000>) == sizeof(std::uint32_t) + (2 * 70000));
+static_assert(sizeof(FixedVector<int, 5>) == sizeof(int) * 6);
+
 namespace trivially_copyable_but_not_copyable_or_moveable_vector
 {
 using VecType = FixedVector<MockTriviallyCopyableButNotCopyableOrMoveable, 5>;
@@ -586,6 +593,38 @@ TEST(FixedVector, EmplaceBackExceedsCapacity)
     EXPECT_DEATH(var.emplace_back(2), "");
 }
 
+TEST(FixedVector, UncheckedAppends)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 6> var{0};
+        var.push_back_unchecked(1);
+        const int value = 2;
+        var.push_back_unchecked(value);
+        var.emplace_back_unchecked(3);
+        const std::array<int, 2> tail{4, 5};
+        var.append_unchecked(tail);
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 3, 4, 5}));
+    static_assert(is_full(VAL1));
+
+    FixedVector<ComplexStruct, 11> var2{};
+    auto& ref = var2.emplace_back_unchecked(101, 202, 303, 404);
+    EXPECT_EQ(1, var2.size());
+    EXPECT_EQ(101, ref.a);
+    EXPECT_EQ(404, ref.c);
+
+    FixedVector<std::vector<int>, 5> var3{};
+    var3.push_back_unchecked(std::vector<int>{1, 2});
+    const std::vector<std::vector<int>> values{{3}, {}, {4, 5, 6}};
+    var3.append_unchecked(values);
+    var3.append_unchecked({});
+    EXPECT_TRUE(
+        std::ranges::equal(var3, std::vector<std::vector<int>>{{1, 2}, {3}, {}, {4, 5, 6}}));
+}
+
 TEST(FixedVector, CapacityAndMaxSize)
 {
     {
@@ -1214,6 +1253,72 @@ TEST(FixedVector, ResizeExceedsCapacity)
     EXPECT_DEATH(var1.resize(to_size, 5), "");
 }
 
+namespace
+{
+template <class VectorType>
+concept CanResizeForOverwrite =
+    requires(VectorType var) { var.resize_for_overwrite(std::size_t{1}); };
+}  // namespace
+
+TEST(FixedVector, ResizeForOverwrite)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 8> var{0, 1, 2};
+        var.resize_for_overwrite(5);
+        var[3] = 3;
+        var[4] = 4;
+        var.resize_for_overwrite(4);
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 3}));
+
+    static_assert(CanResizeForOverwrite<FixedVector<int, 8>>);
+    static_assert(!CanResizeForOverwrite<FixedVector<std::vector<int>, 8>>);
+}
+
+TEST(FixedVector, ResizeAndOverwrite)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 8> var{0, 1, 2};
+        var.resize_and_overwrite(6,
+                                 [](int* data, std::size_t count)
+                                 {
+                                     // The existing entries are kept
+                                     data[3] = data[2] + 1;
+                                     data[4] = data[2] + 2;
+                                     return count - 1;
+                                 });
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 3, 4}));
+
+    FixedVector<std::byte, 64> var2{std::byte{1}};
+    const std::array<std::byte, 3> packet{std::byte{2}, std::byte{3}, std::byte{4}};
+    var2.resize_and_overwrite(var2.max_size(),
+                              [&packet](std::byte* data, std::size_t /*count*/)
+                              {
+                                  std::ranges::copy(packet, std::next(data, 1));
+                                  return 1 + packet.size();
+                              });
+    EXPECT_TRUE(std::ranges::equal(
+        var2, std::array{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}}));
+
+    // Shrinking keeps the entries that are not overwritten
+    var2.resize_and_overwrite(2, [](std::byte* /*data*/, std::size_t count) { return count; });
+    EXPECT_TRUE(std::ranges::equal(var2, std::array{std::byte{1}, std::byte{2}}));
+}
+
+TEST(FixedVector, ResizeAndOverwriteExceedsCapacity)
+{
+    FixedVector<int, 3> var1{};
+    EXPECT_DEATH(var1.resize_for_overwrite(4), "");
+    EXPECT_DEATH(var1.resize_and_overwrite(4, [](int*, std::size_t count) { return count; }), "");
+    EXPECT_DEATH(var1.resize_and_overwrite(2, [](int*, std::size_t count) { return count + 1; }),
+                 "");
+}
+
 TEST(FixedVector, Size)
 {
     {
@@ -1715,6 +1820,53 @@ TEST(FixedVector, EraseOne)
     }
 }
 
+TEST(FixedVector, TriviallyRelocatableEntriesAreNotMoved)
+{
+    static_assert(TriviallyRelocatable<FixedVector<int, 8>>);
+    static_assert(TriviallyRelocatable<FixedVector<MockTriviallyRelocatable, 8>>);
+    static_assert(NotTriviallyRelocatable<FixedVector<std::vector<int>, 8>>);
+
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<MockTriviallyRelocatable, 8> var{0, 1, 2, 3};
+        var.insert(std::next(var.begin(), 1), MockTriviallyRelocatable{9});
+        var.erase(std::next(var.begin(), 3));
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array<MockTriviallyRelocatable, 4>{0, 9, 1, 3}));
+
+    FixedVector<MockTriviallyRelocatable, 8> var{0, 1, 2, 3, 4, 5};
+    var.insert(std::next(var.begin(), 2), {6, 7});
+    EXPECT_TRUE(std::ranges::equal(
+        var, std::array<MockTriviallyRelocatable, 8>{0, 1, 6, 7, 2, 3, 4, 5}));
+    var.erase(std::next(var.begin(), 1), std::next(var.begin(), 4));
+    EXPECT_TRUE(std::ranges::equal(var, std::array<MockTriviallyRelocatable, 5>{0, 2, 3, 4, 5}));
+    EXPECT_TRUE(std::ranges::all_of(var, [](const auto& entry) { return entry.move_count == 0; }));
+}
+
+TEST(FixedVector, SizeAtTheLimitOfTheSizeStorage)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<char, 255> var{};
+        var.resize(255, 'a');
+        return var;
+    }();
+    static_assert(VAL1.size() == 255);
+    static_assert(is_full(VAL1));
+
+    FixedVector<int, 256> var2{};
+    for (int i = 0; i < 256; i++)
+    {
+        var2.push_back(i);
+    }
+    EXPECT_EQ(256, var2.size());
+    EXPECT_EQ(255, var2.back());
+    var2.erase(var2.begin(), std::next(var2.begin(), 200));
+    EXPECT_EQ(56, var2.size());
+    EXPECT_EQ(200, var2.front());
+}
+
 TEST(FixedVector, EraseEmpty)
 {
     {
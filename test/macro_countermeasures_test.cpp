@@ -22,10 +22,16 @@ error: expected unqualified-id if (const auto __len = std::min(__d1, __d2))
 #include "fixed_containers/enum_map.hpp"
 #include "fixed_containers/enum_set.hpp"
 #include "fixed_containers/enum_utils.hpp"
+#include "fixed_containers/fixed_b_tree_map.hpp"
+#include "fixed_containers/fixed_b_tree_set.hpp"
 #include "fixed_containers/fixed_bitset.hpp"
 #include "fixed_containers/fixed_circular_deque.hpp"
 #include "fixed_containers/fixed_circular_queue.hpp"
 #include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_flat_hash_map.hpp"
+#include "fixed_containers/fixed_flat_hash_set.hpp"
+#include "fixed_containers/fixed_flat_map.hpp"
+#include "fixed_containers/fixed_flat_set.hpp"
 #include "fixed_containers/fixed_map.hpp"
 #include "fixed_containers/fixed_set.hpp"
 #include "fixed_containers/fixed_stack.hpp"
@@ -87,6 +93,14 @@ TEST(MacroCountermeasures, DummyUsagesOfContainers)
         const FixedBitset<5> instance{};
         (void)instance;
     }
+    {
+        const FixedBTreeMap<int, int, 5> instance{};
+        (void)instance;
+    }
+    {
+        const FixedBTreeSet<int, 5> instance{};
+        (void)instance;
+    }
     {
         const FixedCircularDeque<int, 5> instance{};
         (void)instance;
@@ -99,6 +113,22 @@ TEST(MacroCountermeasures, DummyUsagesOfContainers)
         const FixedDeque<int, 5> instance{};
         (void)instance;
     }
+    {
+        const FixedFlatHashMap<int, int, 5> instance{};
+        (void)instance;
+    }
+    {
+        const FixedFlatHashSet<int, 5> instance{};
+        (void)instance;
+    }
+    {
+        const FixedFlatMap<int, int, 5> instance{};
+        (void)instance;
+    }
+    {
+        const FixedFlatSet<int, 5> instance{};
+        (void)instance;
+    }
     {
         const FixedMap<int, int, 5> instance{};
         (void)instance;
@@ -430,6 +430,58 @@ public:
 static_assert(alignof(MockAligned64) == 64);
 static_assert(sizeof(MockAligned64) == 64);
 
+// Opts into trivial relocation despite its non-trivial copy/move. The move constructor keeps count,
+// which shows whether a container relocated an entry element-wise or with its bytes.
+struct MockTriviallyRelocatable
+{
+    int value = 0;
+    int move_count = 0;
+
+    constexpr MockTriviallyRelocatable() = default;
+    constexpr MockTriviallyRelocatable(int val)
+      : value{val}
+    {
+    }
+
+    constexpr MockTriviallyRelocatable(const MockTriviallyRelocatable& other) noexcept
+      : value{other.value}
+    {
+    }
+    constexpr MockTriviallyRelocatable(MockTriviallyRelocatable&& other) noexcept
+      : value{other.value}
+      , move_count{other.move_count + 1}
+    {
+    }
+    constexpr MockTriviallyRelocatable& operator=(const MockTriviallyRelocatable& other) noexcept
+    {
+        value = other.value;
+        return *this;
+    }
+    constexpr MockTriviallyRelocatable& operator=(MockTriviallyRelocatable&& other) noexcept
+    {
+        value = other.value;
+        move_count = other.move_count + 1;
+        return *this;
+    }
+    constexpr ~MockTriviallyRelocatable()
+    {
+        mock_testing_types_detail::noop_constexpr_function_to_induce_non_triviality();
+    }
+
+    constexpr bool operator==(const MockTriviallyRelocatable& other) const
+    {
+        return value == other.value;
+    }
+};
+
+template <>
+struct IsTriviallyRelocatable<MockTriviallyRelocatable> : std::true_type
+{
+};
+
+static_assert(NotTriviallyCopyable<MockTriviallyRelocatable>);
+static_assert(TriviallyRelocatable<MockTriviallyRelocatable>);
+
 struct MockTypeWithConstAndNonConstFunctions
 {
     constexpr void const_function() const {}
@@ -0,0 +1,199 @@
+#include "benchmark_utils.hpp"
+
+#include "fixed_containers/fixed_circular_deque.hpp"
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_list.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <string_view>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using benchmark_utils::element_count;
+using benchmark_utils::make_heap_allocated;
+
+template <typename T, std::size_t /*CAPACITY*/>
+using StdVector = std::vector<T>;
+template <typename T, std::size_t /*CAPACITY*/>
+using StdDeque = std::deque<T>;
+template <typename T, std::size_t /*CAPACITY*/>
+using StdList = std::list<T>;
+template <typename T, std::size_t CAPACITY>
+using FixedVectorAlias = FixedVector<T, CAPACITY>;
+template <typename T, std::size_t CAPACITY>
+using FixedDequeAlias = FixedDeque<T, CAPACITY>;
+template <typename T, std::size_t CAPACITY>
+using FixedCircularDequeAlias = FixedCircularDeque<T, CAPACITY>;
+template <typename T, std::size_t CAPACITY>
+using FixedListAlias = FixedList<T, CAPACITY>;
+
+template <typename SequenceType>
+void fill(SequenceType& instance, std::size_t count)
+{
+    using T = typename SequenceType::value_type;
+    instance.clear();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        instance.push_back(T{i});
+    }
+}
+
+template <typename SequenceType, std::size_t CAPACITY>
+void benchmark_push_back(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<SequenceType>();
+
+    for (auto _ : state)
+    {
+        fill(*instance, count);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename SequenceType, std::size_t CAPACITY>
+void benchmark_push_back_unchecked(benchmark::State& state)
+{
+    using T = typename SequenceType::value_type;
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<SequenceType>();
+
+    for (auto _ : state)
+    {
+        instance->clear();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            instance->push_back_unchecked(T{i});
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename SequenceType, std::size_t CAPACITY>
+void benchmark_erase_and_insert_middle(benchmark::State& state)
+{
+    using T = typename SequenceType::value_type;
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<SequenceType>();
+    fill(*instance, count);
+
+    auto it = std::next(instance->begin(), static_cast<std::ptrdiff_t>(count / 2));
+    for (auto _ : state)
+    {
+        it = instance->erase(it);
+        it = instance->insert(it, T{count});
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename SequenceType, std::size_t CAPACITY>
+void benchmark_random_access(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<SequenceType>();
+    fill(*instance, count);
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        auto& entry = (*instance)[benchmark_utils::scattered_index(i++, count)];
+        benchmark::DoNotOptimize(entry);
+    }
+}
+
+template <typename SequenceType, std::size_t CAPACITY>
+void benchmark_iterate(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto instance = make_heap_allocated<SequenceType>();
+    fill(*instance, count);
+
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const auto& entry : *instance)
+        {
+            sum += entry.data[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <typename SequenceType, std::size_t CAPACITY>
+void benchmark_copy(benchmark::State& state)
+{
+    const std::size_t count = element_count(state, CAPACITY);
+    auto source = make_heap_allocated<SequenceType>();
+    auto destination = make_heap_allocated<SequenceType>();
+    fill(*source, count);
+
+    for (auto _ : state)
+    {
+        *destination = *source;
+        benchmark::ClobberMemory();
+    }
+}
+
+template <template <typename, std::size_t> class SequenceType>
+bool register_sequence_benchmarks(std::string_view container_name)
+{
+    benchmark_utils::for_each_shape(
+        [&]<typename T, std::size_t CAPACITY>()
+        {
+            using Instance = SequenceType<T, CAPACITY>;
+            const auto name = [&](std::string_view operation)
+            { return benchmark_utils::benchmark_name<T, CAPACITY>(operation, container_name); };
+
+            benchmark::RegisterBenchmark(name("push_back").c_str(),
+                                         benchmark_push_back<Instance, CAPACITY>)
+                ->Apply(benchmark_utils::fill_ratios);
+            if constexpr (requires(Instance& instance) { instance.push_back_unchecked(T{}); })
+            {
+                benchmark::RegisterBenchmark(name("push_back_unchecked").c_str(),
+                                             benchmark_push_back_unchecked<Instance, CAPACITY>)
+                    ->Apply(benchmark_utils::fill_ratios);
+            }
+            benchmark::RegisterBenchmark(name("erase_and_insert_middle").c_str(),
+                                         benchmark_erase_and_insert_middle<Instance, CAPACITY>)
+                ->Apply(benchmark_utils::fill_ratios);
+            if constexpr (requires(Instance& instance) { instance[0]; })
+            {
+                benchmark::RegisterBenchmark(name("random_access").c_str(),
+                                             benchmark_random_access<Instance, CAPACITY>)
+                    ->Apply(benchmark_utils::fill_ratios);
+            }
+            benchmark::RegisterBenchmark(name("iterate").c_str(),
+                                         benchmark_iterate<Instance, CAPACITY>)
+                ->Apply(benchmark_utils::fill_ratios);
+            benchmark::RegisterBenchmark(name("copy").c_str(), benchmark_copy<Instance, CAPACITY>)
+                ->Apply(benchmark_utils::fill_ratios);
+        });
+    return true;
+}
+
+[[maybe_unused]] const bool REGISTERED =
+    register_sequence_benchmarks<StdVector>("std::vector") &&
+    register_sequence_benchmarks<FixedVectorAlias>("FixedVector") &&
+    register_sequence_benchmarks<StdDeque>("std::deque") &&
+    register_sequence_benchmarks<FixedDequeAlias>("FixedDeque") &&
+    register_sequence_benchmarks<FixedCircularDequeAlias>("FixedCircularDeque") &&
+    register_sequence_benchmarks<StdList>("std::list") &&
+    register_sequence_benchmarks<FixedListAlias>("FixedList");
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
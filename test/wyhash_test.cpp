@@ -0,0 +1,95 @@
+#include "fixed_containers/wyhash.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_string.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace fixed_containers
+{
+namespace
+{
+// Covers every branch of the byte hash: 0, 1-3, 4-16, 17-48 and >48 bytes
+constexpr std::string_view LONG_STRING =
+    "the quick brown fox jumps over the lazy dog, then jumps over it again and again";
+
+constexpr std::uint64_t hash_prefix(std::size_t length)
+{
+    return wyhash::hash<std::string_view>{}(LONG_STRING.substr(0, length));
+}
+}  // namespace
+
+TEST(Wyhash, StringHashIsConstexpr)
+{
+    constexpr std::uint64_t HASH = hash_prefix(5);
+    static_assert(HASH != hash_prefix(4));
+    static_assert(HASH == wyhash::hash<FixedString<8>>{}(FixedString<8>{"the q"}));
+
+    // The constexpr path reads the bytes one at a time, and must agree with the runtime one
+    for (std::size_t length = 0; length <= LONG_STRING.size(); length++)
+    {
+        const std::string_view prefix = LONG_STRING.substr(0, length);
+        EXPECT_EQ(hash_prefix(length),
+                  wyhash_detail::hash(prefix.data(), static_cast<std::int64_t>(prefix.size())));
+    }
+    static_assert(hash_prefix(0) != hash_prefix(1));
+    static_assert(hash_prefix(3) != hash_prefix(16));
+    static_assert(hash_prefix(17) != hash_prefix(48));
+    static_assert(hash_prefix(49) != hash_prefix(LONG_STRING.size()));
+}
+
+TEST(Wyhash, StringHashIsTransparent)
+{
+    static_assert(IsTransparent<wyhash::hash<std::string_view>>);
+    static_assert(IsTransparent<wyhash::hash<std::string>>);
+    static_assert(IsTransparent<wyhash::hash<FixedString<32>>>);
+
+    const std::uint64_t expected = wyhash::hash<std::string_view>{}("hello");
+    EXPECT_EQ(expected, wyhash::hash<FixedString<32>>{}(FixedString<32>{"hello"}));
+    EXPECT_EQ(expected, wyhash::hash<FixedString<32>>{}(std::string_view{"hello"}));
+    EXPECT_EQ(expected, wyhash::hash<FixedString<32>>{}("hello"));
+    EXPECT_EQ(expected, wyhash::hash<std::string>{}(std::string{"hello"}));
+    EXPECT_EQ(expected, wyhash::hash<std::string>{}(FixedString<8>{"hello"}));
+}
+
+TEST(Wyhash, CharArraysHashTheirContents)
+{
+    const std::uint64_t expected = wyhash::hash<std::string_view>{}("hello");
+    const char array[] = "hello";  // NOLINT(modernize-avoid-c-arrays)
+    EXPECT_EQ(expected, wyhash::hash<char[6]>{}(array));
+    EXPECT_EQ(expected, wyhash::hash<const char[6]>{}("hello"));
+}
+
+namespace
+{
+// Converts both to an integer and to a string, e.g. an id with a name
+struct IntegerAndStringConvertible
+{
+    std::uint64_t id;
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    constexpr operator std::uint64_t() const { return id; }
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    constexpr operator std::string_view() const { return "name"; }
+};
+}  // namespace
+
+TEST(Wyhash, OnlyLibraryStringTypesHashAsStrings)
+{
+    // Not ambiguous: only the integral hash applies to user types
+    static_assert(wyhash::hash<IntegerAndStringConvertible>{}(IntegerAndStringConvertible{7}) ==
+                  wyhash::hash<std::uint64_t>{}(7));
+}
+
+TEST(Wyhash, PointersHashTheirAddress)
+{
+    static constexpr std::string_view STR = "hello";
+    const char* first = STR.data();
+    const std::string copy{STR};
+    EXPECT_NE(wyhash::hash<const char*>{}(first), wyhash::hash<const char*>{}(copy.c_str()));
+}
+
+}  // namespace fixed_containers